@@ -0,0 +1,74 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Global.benchmark.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace benchmark
+{
+namespace global
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Number of heap allocations performed so far (incremented by the global operator new)
+
+extern std::atomic<std::size_t> allocationCount ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Run a query in the benchmark loop and report its allocations per iteration
+///
+///                             The query result is kept alive through DoNotOptimize, so that the call cannot be elided.
+///                             Allocations are reported as the "allocs/op" counter, next to the default time per iteration.
+///                             Dynamic-size Eigen storage is allocated through malloc directly, and is therefore not counted.
+///
+/// @code
+///                             Measure(aState, [&] { return ellipsoid.intersects(ray) ; }) ;
+/// @endcode
+/// @param                      [in] aState A benchmark state
+/// @param                      [in] aQuery A query callable
+
+template <typename Query>
+void                            Measure                                     (           ::benchmark::State&         aState,
+                                                                                        Query&&                     aQuery                                      )
+{
+
+    const std::size_t initialAllocationCount = global::allocationCount.load(std::memory_order_relaxed) ;
+
+    for (auto _ : aState)
+    {
+        ::benchmark::DoNotOptimize(aQuery()) ;
+    }
+
+    const std::size_t allocationCount = global::allocationCount.load(std::memory_order_relaxed) - initialAllocationCount ;
+
+    aState.counters["allocs/op"] = ::benchmark::Counter(static_cast<double>(allocationCount), ::benchmark::Counter::kAvgIterations) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Main.benchmark.cxx
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <Global.benchmark.hpp>
+
+#include <cstdlib>
+#include <new>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+std::atomic<std::size_t>        ostk::math::benchmark::global::allocationCount { 0 } ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+void*                           operator new                                (           std::size_t                 aSize                                       )
+{
+
+    ostk::math::benchmark::global::allocationCount.fetch_add(1, std::memory_order_relaxed) ;
+
+    if (void* pointer = std::malloc(aSize != 0 ? aSize : 1))
+    {
+        return pointer ;
+    }
+
+    throw std::bad_alloc() ;
+
+}
+
+void*                           operator new[]                              (           std::size_t                 aSize                                       )
+{
+    return ::operator new(aSize) ;
+}
+
+void                            operator delete                             (           void*                       aPointer                                    ) noexcept
+{
+    std::free(aPointer) ;
+}
+
+void                            operator delete[]                           (           void*                       aPointer                                    ) noexcept
+{
+    std::free(aPointer) ;
+}
+
+void                            operator delete                             (           void*                       aPointer,
+                                                                                        std::size_t                                                             ) noexcept
+{
+    std::free(aPointer) ;
+}
+
+void                            operator delete[]                           (           void*                       aPointer,
+                                                                                        std::size_t                                                             ) noexcept
+{
+    std::free(aPointer) ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+int                             main                                        (           int                         argc,
+                                                                                        char**                      argv                                        )
+{
+
+    ::benchmark::Initialize(&argc, argv) ;
+
+    if (::benchmark::ReportUnrecognizedArguments(argc, argv))
+    {
+        return 1 ;
+    }
+
+    ::benchmark::RunSpecifiedBenchmarks() ;
+
+    return 0 ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,173 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::core::ctnr::Array<ostk::math::geom::d2::objects::Polygon> Footprints (const std::size_t& aFootprintCount)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    // Overlapping octagons along a sinuous ground track, swept back and forth
+
+    Array<Polygon> footprints = Array<Polygon>::Empty() ;
+
+    footprints.reserve(aFootprintCount) ;
+
+    for (std::size_t index = 0; index < aFootprintCount; ++index)
+    {
+
+        const double x = 0.3 * (index % 100) ;
+        const double y = 0.8 * (index / 100) + 0.5 * std::sin(0.1 * index) ;
+
+        Array<Polygon::Vertex> vertices = Array<Polygon::Vertex>::Empty() ;
+
+        for (std::size_t vertexIndex = 0; vertexIndex < 8; ++vertexIndex)
+        {
+
+            const double angle = 2.0 * M_PI * vertexIndex / 8.0 ;
+
+            vertices.add({ x + 0.5 * std::cos(angle), y + 0.5 * std::sin(angle) }) ;
+
+        }
+
+        footprints.add(Polygon { vertices }) ;
+
+    }
+
+    return footprints ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_UnionWith (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    const auto footprints = Footprints(aState.range(0)) ;
+
+    Measure(aState, [&] () -> MultiPolygon
+    {
+
+        MultiPolygon multiPolygon = MultiPolygon::Polygon(footprints.accessFirst()) ;
+
+        for (const auto& footprint : footprints)
+        {
+            multiPolygon = multiPolygon.unionWith(MultiPolygon::Polygon(footprint)) ;
+        }
+
+        return multiPolygon ;
+
+    }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_UnionWith)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_Union (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    const auto footprints = Footprints(aState.range(0)) ;
+
+    Measure(aState, [&] () -> MultiPolygon { return MultiPolygon::Union(footprints) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_Union)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond) ;
+
+static ostk::math::geom::d2::objects::MultiPolygon AreaOfInterest ( )
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    // Checkerboard of 200 square regions over the footprints
+
+    Array<Polygon> regions = Array<Polygon>::Empty() ;
+
+    for (std::size_t index = 0; index < 400; index += 2)
+    {
+
+        const double x = 1.5 * (index % 20) + 1.5 * ((index / 20) % 2) ;
+        const double y = 0.4 * (index / 20) ;
+
+        regions.add(Polygon { { { x, y }, { x, y + 0.4 }, { x + 1.5, y + 0.4 }, { x + 1.5, y } } }) ;
+
+    }
+
+    return { regions } ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_IntersectionWith (benchmark::State& aState)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    const auto footprints = Footprints(aState.range(0)) ;
+    const MultiPolygon areaOfInterest = AreaOfInterest() ;
+
+    Measure(aState, [&] () -> Array<MultiPolygon>
+    {
+
+        Array<MultiPolygon> clippedFootprints = Array<MultiPolygon>::Empty() ;
+
+        for (const auto& footprint : footprints)
+        {
+            clippedFootprints.add(MultiPolygon::Polygon(footprint).intersectionWith(areaOfInterest)) ;
+        }
+
+        return clippedFootprints ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * footprints.getSize()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_IntersectionWith)->Arg(1000)->Unit(benchmark::kMillisecond) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_Clip (benchmark::State& aState)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    const auto footprints = Footprints(aState.range(0)) ;
+    const MultiPolygon areaOfInterest = AreaOfInterest() ;
+
+    Measure(aState, [&] () -> Array<MultiPolygon> { return areaOfInterest.clip(footprints) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * footprints.getSize()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon_Clip)->Arg(1000)->Unit(benchmark::kMillisecond) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
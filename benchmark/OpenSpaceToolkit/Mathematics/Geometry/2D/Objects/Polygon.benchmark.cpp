@@ -0,0 +1,119 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::math::geom::d2::objects::Polygon Outline (const std::size_t& aVertexCount)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    Array<Point> vertices = Array<Point>::Empty() ;
+
+    vertices.reserve(aVertexCount) ;
+
+    for (std::size_t index = 0; index < aVertexCount; ++index)
+    {
+
+        const double angle = 2.0 * M_PI * index / aVertexCount ;
+        const double radius = 1.0 + 0.1 * std::sin(37.0 * angle) ;
+
+        vertices.add(Point(radius * std::cos(angle), radius * std::sin(angle))) ;
+
+    }
+
+    return { vertices } ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_ContainsPoint (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    const Polygon polygon = Outline(aState.range(0)) ;
+
+    if (aState.range(1) != 0)
+    {
+        polygon.buildIndex() ;
+    }
+
+    const Point point = { 0.5, 0.3 } ;
+
+    Measure(aState, [&] () -> bool { return polygon.contains(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_ContainsPoint)->Args({ 50, 0 })->Args({ 50, 1 })->Args({ 10000, 1 })->Args({ 200000, 1 }) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_ContainsPoints (benchmark::State& aState)
+{
+
+    using ostk::math::obj::VectorXb ;
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    const Polygon polygon = Outline(aState.range(0)) ;
+
+    // 100 x 100 grid over the polygon
+
+    Matrix2Xd points = Matrix2Xd::Zero(2, 10000) ;
+
+    for (Eigen::Index index = 0; index < points.cols(); ++index)
+    {
+        points.col(index) << -1.2 + 0.024 * (index / 100), -1.2 + 0.024 * (index % 100) ;
+    }
+
+    Measure(aState, [&] () -> VectorXb { return polygon.containsPoints(points) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * points.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_ContainsPoints)->Arg(50)->Arg(10000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_Simplify (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::LineString ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    const Polygon polygon = Outline(aState.range(0)) ;
+
+    const LineString::SimplificationMethod method = (aState.range(1) == 0) ? LineString::SimplificationMethod::DouglasPeucker : LineString::SimplificationMethod::Visvalingam ;
+    const bool preserveTopology = (aState.range(2) != 0) ;
+
+    const double tolerance = 1e-3 ;
+
+    Measure(aState, [&] () -> Polygon { return polygon.simplify(tolerance, method, preserveTopology) ; }) ;
+
+    aState.counters["vertices"] = static_cast<double>(polygon.simplify(tolerance, method, preserveTopology).getVertexCount()) ;
+
+    aState.SetItemsProcessed(aState.iterations() * aState.range(0)) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon_Simplify)->Args({ 10000, 0, 0 })->Args({ 10000, 1, 0 })->Args({ 10000, 0, 1 })->Args({ 10000, 1, 1 })->Args({ 200000, 0, 0 }) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,118 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::core::ctnr::Array<ostk::math::geom::d2::objects::Polygon> Cells (const std::size_t& aCellCount)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    const std::size_t columnCount = static_cast<std::size_t>(std::ceil(std::sqrt(aCellCount))) ;
+
+    Array<Polygon> cells = Array<Polygon>::Empty() ;
+
+    cells.reserve(aCellCount) ;
+
+    for (std::size_t index = 0; index < aCellCount; ++index)
+    {
+
+        const double x = static_cast<double>(index % columnCount) ;
+        const double y = static_cast<double>(index / columnCount) ;
+
+        cells.add(Polygon { { { x, y }, { x, y + 1.0 }, { x + 1.0, y + 1.0 }, { x + 1.0, y } } }) ;
+
+    }
+
+    return cells ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_Constructor (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    const auto cells = Cells(aState.range(0)) ;
+
+    Measure(aState, [&] () -> PolygonIndex { return PolygonIndex(cells) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_Constructor)->Arg(1000)->Arg(50000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_GetPolygonIndicesContaining (benchmark::State& aState)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    const PolygonIndex polygonIndex = PolygonIndex(Cells(aState.range(0))) ;
+
+    const Point point = { 10.5, 10.25 } ;
+
+    Measure(aState, [&] () -> Array<Index> { return polygonIndex.getPolygonIndicesContaining(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_GetPolygonIndicesContaining)->Arg(1000)->Arg(50000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_MultiPolygonContains (benchmark::State& aState)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    // One cell out of two, so that cells seldom share edges
+
+    const auto allCells = Cells(2 * aState.range(0)) ;
+
+    Array<Polygon> cells = Array<Polygon>::Empty() ;
+
+    for (std::size_t index = 0; index < allCells.getSize(); index += 2)
+    {
+        cells.add(allCells[index]) ;
+    }
+
+    const MultiPolygon multiPolygon = { cells } ;
+
+    if (aState.range(1) != 0)
+    {
+        multiPolygon.buildIndex() ;
+    }
+
+    const Point point = { 10.5, 10.25 } ;
+
+    Measure(aState, [&] () -> bool { return multiPolygon.contains(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex_MultiPolygonContains)->Args({ 16, 0 })->Args({ 16, 1 })->Args({ 1000, 1 })->Args({ 50000, 1 }) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
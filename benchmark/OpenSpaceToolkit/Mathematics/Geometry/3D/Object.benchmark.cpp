@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Object.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Unique.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_EqualTo (benchmark::State& aState)
+{
+
+    using ostk::core::types::Unique ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Unique<Object> objectUPtr = std::make_unique<Cone>(Cone({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0))) ;
+    const Unique<Object> anotherObjectUPtr = std::make_unique<Cone>(Cone({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0))) ;
+
+    Measure(aState, [&] () -> bool { return (*objectUPtr) == (*anotherObjectUPtr) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Object_EqualTo) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Intersects (benchmark::State& aState)
+{
+
+    using ostk::core::types::Unique ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Ray ;
+
+    const Unique<Object> objectUPtr = std::make_unique<Sphere>(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+    const Unique<Object> anotherObjectUPtr = std::make_unique<Ray>(Ray({ 0.0, 0.0, 10.0 }, Vector3d { 0.0, 0.0, -1.0 })) ;
+
+    Measure(aState, [&] () -> bool { return objectUPtr->intersects(*anotherObjectUPtr) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Intersects) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Intersects_Cone_Sphere (benchmark::State& aState)
+{
+
+    using ostk::core::types::Unique ;
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Unique<Object> objectUPtr = std::make_unique<Cone>(Cone({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0))) ;
+    const Unique<Object> anotherObjectUPtr = std::make_unique<Sphere>(Sphere({ 0.0, 0.0, 0.0 }, 3.0)) ;
+
+    Measure(aState, [&] () -> bool { return objectUPtr->intersects(*anotherObjectUPtr) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Object_Intersects_Cone_Sphere) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
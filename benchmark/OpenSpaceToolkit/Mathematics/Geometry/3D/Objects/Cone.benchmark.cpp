@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return cone.intersects(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return cone.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Ellipsoid_Miss (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Ellipsoid ellipsoid = { { 50.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return cone.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_Intersects_Ellipsoid_Miss) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return cone.intersectionWith(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return cone.intersectionWith(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid_OnlyInSight (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return cone.intersectionWith(ellipsoid, true) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid_OnlyInSight) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid_Adaptive (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return cone.intersectionWith(ellipsoid, true, Angle::Degrees(5.0)) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone_IntersectionWith_Ellipsoid_Adaptive) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,86 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return cuboid.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_PointSet (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+    const PointSet pointSet = { { { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } } ;
+
+    Measure(aState, [&] () -> bool { return cuboid.intersects(pointSet) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_PointSet) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return cuboid.intersects(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Cuboid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    const Cuboid firstCuboid = { { 0.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+    const Cuboid secondCuboid = { { 0.5, 0.5, 0.5 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+
+    Measure(aState, [&] () -> bool { return firstCuboid.intersects(secondCuboid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid_Intersects_Cuboid) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
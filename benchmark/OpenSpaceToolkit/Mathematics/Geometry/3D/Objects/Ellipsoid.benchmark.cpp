@@ -0,0 +1,282 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_PointSet (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const PointSet pointSet = { { { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(pointSet) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_PointSet) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Segment) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Plane) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Pyramid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(pyramid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Pyramid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Cone (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+
+    Measure(aState, [&] () -> bool { return ellipsoid.intersects(cone) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_Intersects_Cone) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Ray_OnlyInSight (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(ray, true) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Ray_OnlyInSight) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Segment) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Pyramid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(pyramid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Pyramid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Cone (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+
+    Measure(aState, [&] () -> Intersection { return ellipsoid.intersectionWith(cone) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectionWith_Cone) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectRays (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    const Eigen::Index rayCount = aState.range(0) ;
+
+    const Matrix3Xd origins = Matrix3Xd::Random(3, rayCount) * 10.0 ;
+    const Matrix3Xd directions = (Matrix3Xd::Random(3, rayCount)).colwise().normalized() ;
+
+    Measure(aState, [&] () -> Ellipsoid::RayIntersections { return ellipsoid.intersectRays(origins, directions) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * rayCount) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid_IntersectRays)->RangeMultiplier(8)->Range(8, 32768) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,102 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Line ;
+
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return line.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return line.intersects(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Plane) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return line.intersects(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return line.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_Intersects_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_IntersectionWith_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return line.intersectionWith(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line_IntersectionWith_Plane) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
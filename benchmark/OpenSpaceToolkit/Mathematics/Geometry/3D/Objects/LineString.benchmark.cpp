@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LineString.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::math::geom::d3::objects::LineString Track (const std::size_t& aPointCount)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::LineString ;
+
+    Array<Point> points = Array<Point>::Empty() ;
+
+    points.reserve(aPointCount) ;
+
+    for (std::size_t index = 0; index < aPointCount; ++index)
+    {
+
+        const double angle = index * 1e-3 ;
+
+        points.add(Point(std::cos(angle), std::sin(angle), angle * 1e-2)) ;
+
+    }
+
+    return { points } ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString_GetProjectionOf (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::LineString ;
+
+    const LineString lineString = Track(aState.range(0)) ;
+
+    lineString.buildIndex() ;
+
+    Measure(aState, [&] () -> LineString::Projection { return lineString.getProjectionOf({ 0.5, 0.5, 0.3 }) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString_GetProjectionOf)->Arg(1000)->Arg(200000) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,187 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return plane.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_PointSet (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const PointSet pointSet = { { { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } } ;
+
+    Measure(aState, [&] () -> bool { return plane.intersects(pointSet) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_PointSet) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return plane.intersects(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return plane.intersects(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return plane.intersects(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_Intersects_Segment) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return plane.intersectionWith(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_PointSet (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const PointSet pointSet = { { { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } } ;
+
+    Measure(aState, [&] () -> Intersection { return plane.intersectionWith(pointSet) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_PointSet) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return plane.intersectionWith(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return plane.intersectionWith(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return plane.intersectionWith(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane_IntersectionWith_Segment) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,89 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::math::geom::d3::objects::PointSet PointCloud (const std::size_t& aPointCount)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    Array<Point> points = Array<Point>::Empty() ;
+
+    points.reserve(aPointCount) ;
+
+    for (std::size_t index = 0; index < aPointCount; ++index)
+    {
+        points.add(Point(std::sin(index * 1.1), std::sin(index * 2.3), std::sin(index * 3.7))) ;
+    }
+
+    return { points } ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointClosestTo (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    const PointSet pointSet = PointCloud(aState.range(0)) ;
+
+    pointSet.buildIndex() ;
+
+    Measure(aState, [&] () -> Point { return pointSet.getPointClosestTo({ 0.1, 0.2, 0.3 }) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointClosestTo)->Arg(1000)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointsClosestTo (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    const PointSet pointSet = PointCloud(100000) ;
+
+    pointSet.buildIndex() ;
+
+    Measure(aState, [&] () -> std::size_t { return pointSet.getPointsClosestTo({ 0.1, 0.2, 0.3 }, 10).getSize() ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointsClosestTo) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointsWithinDistance (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    const PointSet pointSet = PointCloud(100000) ;
+
+    pointSet.buildIndex() ;
+
+    Measure(aState, [&] () -> std::size_t { return pointSet.getPointsWithinDistance({ 0.1, 0.2, 0.3 }, 0.05).getSize() ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet_GetPointsWithinDistance) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
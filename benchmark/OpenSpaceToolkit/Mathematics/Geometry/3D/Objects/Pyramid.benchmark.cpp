@@ -0,0 +1,186 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <memory_resource>
+#include <vector>
+#include <cstddef>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return pyramid.intersects(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return pyramid.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Ellipsoid_Miss (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 50.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return pyramid.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_Intersects_Ellipsoid_Miss) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return pyramid.intersectionWith(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return pyramid.intersectionWith(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_Arena (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::LineString ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    // The near and far footprints are concatenated into an intersection allocated from the arena
+
+    const Intersection intersection = pyramid.intersectionWith(ellipsoid) ;
+
+    const LineString nearLineString = static_cast<const LineString&>(intersection.accessComposite().accessObjectAt(0)) ;
+    const LineString farLineString = static_cast<const LineString&>(intersection.accessComposite().accessObjectAt(1)) ;
+
+    std::vector<std::byte> buffer(1 << 16) ;
+    std::pmr::monotonic_buffer_resource arena { buffer.data(), buffer.size() } ;
+
+    Measure(aState, [&] () -> bool
+    {
+
+        const bool isDefined = (Intersection::LineString(nearLineString, &arena) + Intersection::LineString(farLineString)).isDefined() ;
+
+        arena.release() ;
+
+        return isDefined ;
+
+    }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_Arena) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_OnlyInSight (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return pyramid.intersectionWith(ellipsoid, true) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_OnlyInSight) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_Adaptive (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return pyramid.intersectionWith(ellipsoid, true, Angle::Degrees(5.0)) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid_IntersectionWith_Ellipsoid_Adaptive) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Ray ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return ray.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return ray.intersects(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Plane) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return ray.intersects(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return ray.intersects(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_Intersects_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return ray.intersectionWith(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Plane) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Sphere (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return ray.intersectionWith(sphere) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Sphere) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Ellipsoid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return ray.intersectionWith(ellipsoid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Ellipsoid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Ellipsoid_OnlyInSight (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+    const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+    Measure(aState, [&] () -> Intersection { return ray.intersectionWith(ellipsoid, true) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray_IntersectionWith_Ellipsoid_OnlyInSight) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,243 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Point (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Point point = { 0.0, 0.0, 3.0 } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(point) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Point) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_PointSet (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const PointSet pointSet = { { { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(pointSet) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_PointSet) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Segment) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Plane (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Plane plane = { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(plane) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Plane) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Pyramid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(pyramid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Pyramid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Cone (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+
+    Measure(aState, [&] () -> bool { return sphere.intersects(cone) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_Intersects_Cone) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Line (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Line line = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return sphere.intersectionWith(line) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Line) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Ray (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Ray ray = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return sphere.intersectionWith(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Ray) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Segment segment = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return sphere.intersectionWith(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Segment) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Pyramid (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Pyramid pyramid = { { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 9.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } }, { 0.0, 0.0, 10.0 } } ;
+
+    Measure(aState, [&] () -> Intersection { return sphere.intersectionWith(pyramid) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Pyramid) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Cone (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+    using ostk::math::geom::d3::Intersection ;
+
+    const Sphere sphere = { { 0.0, 0.0, 0.0 }, 3.0 } ;
+    const Cone cone = { { 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }, Angle::Degrees(10.0) } ;
+
+    Measure(aState, [&] () -> Intersection { return sphere.intersectionWith(cone) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere_IntersectionWith_Cone) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
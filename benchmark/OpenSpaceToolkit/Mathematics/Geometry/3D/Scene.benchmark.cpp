@@ -0,0 +1,127 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::math::geom::d3::Scene SphereField (const std::size_t& anObjectCount)
+{
+
+    using ostk::core::types::Unique ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Scene ;
+
+    Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+    objects.reserve(anObjectCount) ;
+
+    for (std::size_t index = 0; index < anObjectCount; ++index)
+    {
+        objects.add(std::make_unique<Sphere>(Sphere({ 100.0 * std::sin(index * 1.1), 100.0 * std::sin(index * 2.3), 100.0 * std::sin(index * 3.7) }, 0.5))) ;
+    }
+
+    return Scene { std::move(objects) } ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Build (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::Scene ;
+
+    const Scene scene = SphereField(aState.range(0)) ;
+
+    Measure(aState, [&] () -> bool { scene.build() ; return true ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Build)->Arg(1000)->Arg(100000)->UseRealTime() ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_GetFirstHitOf (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Scene ;
+
+    const Scene scene = SphereField(aState.range(0)) ;
+
+    scene.build() ;
+
+    const Ray ray = { { 150.0, 20.0, 10.0 }, { -1.0, 0.0, 0.0 } } ;
+
+    Measure(aState, [&] () -> Scene::Hit { return scene.getFirstHitOf(ray) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_GetFirstHitOf)->Arg(1000)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Intersects_Segment (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Scene ;
+
+    const Scene scene = SphereField(aState.range(0)) ;
+
+    scene.build() ;
+
+    const Segment segment = { { 150.0, 20.0, 10.0 }, { -150.0, 20.0, 10.0 } } ;
+
+    Measure(aState, [&] () -> bool { return scene.intersects(segment) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Intersects_Segment)->Arg(1000)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Refit (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Transformation ;
+    using ostk::math::geom::d3::Scene ;
+
+    Scene scene = SphereField(aState.range(0)) ;
+
+    scene.build() ;
+
+    const Ray ray = { { 150.0, 20.0, 10.0 }, { -1.0, 0.0, 0.0 } } ;
+
+    std::size_t index = 0 ;
+
+    Measure(aState, [&] () -> Scene::Hit
+    {
+
+        scene.applyTransformation(index++ % scene.getObjectCount(), Transformation::Translation(Vector3d { 0.0, 0.0, 1e-3 })) ;
+
+        return scene.getFirstHitOf(ray) ;
+
+    }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene_Refit)->Arg(1000)->Arg(100000) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
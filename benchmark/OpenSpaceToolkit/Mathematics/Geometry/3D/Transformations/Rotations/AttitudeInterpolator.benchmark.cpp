@@ -0,0 +1,110 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <Global.benchmark.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static ostk::core::ctnr::Array<ostk::math::geom::d3::trf::rot::Quaternion> Attitudes (const ostk::math::obj::VectorXd& aTimeArray)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    Array<Quaternion> quaternions = Array<Quaternion>::Empty() ;
+
+    for (Eigen::Index index = 0; index < aTimeArray.size(); ++index)
+    {
+
+        const double angle = 0.01 * aTimeArray(index) ;
+
+        quaternions.add(Quaternion::XYZS(0.1 * std::sin(3.0 * angle), 0.2 * std::cos(angle), std::sin(angle), std::cos(angle)).toNormalized()) ;
+
+    }
+
+    return quaternions ;
+
+}
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator_SLERP (benchmark::State& aState)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    // Baseline: binary search and Quaternion::SLERP for each query
+
+    const VectorXd times = VectorXd::LinSpaced(1001, 0.0, 1000.0) ;
+    const Array<Quaternion> quaternions = Attitudes(times) ;
+
+    const VectorXd queryTimes = VectorXd::LinSpaced(aState.range(0), 0.0, 1000.0) ;
+
+    Measure(aState, [&] () -> Quaternion
+    {
+
+        Quaternion quaternion = Quaternion::Undefined() ;
+
+        for (Eigen::Index index = 0; index < queryTimes.size(); ++index)
+        {
+
+            const double* timeIterator = std::upper_bound(times.data(), times.data() + times.size(), queryTimes(index)) ;
+            const Eigen::Index segmentIndex = std::min<Eigen::Index>(std::max<Eigen::Index>(timeIterator - times.data() - 1, 0), times.size() - 2) ;
+
+            quaternion = Quaternion::SLERP(quaternions[segmentIndex], quaternions[segmentIndex + 1], (queryTimes(index) - times(segmentIndex)) / (times(segmentIndex + 1) - times(segmentIndex))) ;
+
+        }
+
+        return quaternion ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * queryTimes.size()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator_SLERP)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator_Evaluate (benchmark::State& aState)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::AttitudeInterpolator ;
+
+    const VectorXd times = VectorXd::LinSpaced(1001, 0.0, 1000.0) ;
+
+    const AttitudeInterpolator::Type type = static_cast<AttitudeInterpolator::Type>(aState.range(1)) ;
+
+    const AttitudeInterpolator interpolator = { times, Attitudes(times), type } ;
+
+    const VectorXd queryTimes = VectorXd::LinSpaced(aState.range(0), 0.0, 1000.0) ;
+
+    Measure(aState, [&] () -> Array<Quaternion> { return interpolator.evaluate(queryTimes) ; }) ;
+
+    aState.SetLabel(AttitudeInterpolator::StringFromType(type)) ;
+    aState.SetItemsProcessed(aState.iterations() * queryTimes.size()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator_Evaluate)->Args({ 100000, 1 })->Args({ 100000, 2 })->Args({ 100000, 3 }) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
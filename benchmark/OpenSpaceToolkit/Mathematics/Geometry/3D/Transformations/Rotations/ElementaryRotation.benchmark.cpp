@@ -0,0 +1,92 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_EulerSequence_RotationMatrix (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    const Angle psi = Angle::Degrees(-123.4) ;
+    const Angle theta = Angle::Degrees(56.7) ;
+    const Angle phi = Angle::Degrees(170.0) ;
+
+    Measure(aState, [&] () -> RotationMatrix { return RotationMatrix::RZ(psi) * RotationMatrix::RX(theta) * RotationMatrix::RZ(phi) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_EulerSequence_RotationMatrix) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_EulerSequence_ElementaryRotation (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    const Angle psi = Angle::Degrees(-123.4) ;
+    const Angle theta = Angle::Degrees(56.7) ;
+    const Angle phi = Angle::Degrees(170.0) ;
+
+    Measure(aState, [&] () -> RotationMatrix { return ElementaryRotation<Axis::Z>(psi) * ElementaryRotation<Axis::X>(theta) * ElementaryRotation<Axis::Z>(phi) ; }) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_EulerSequence_ElementaryRotation) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_RotateVector (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    const Angle angle = Angle::Degrees(23.4) ;
+
+    const RotationMatrix rotationMatrix = RotationMatrix::RX(angle) ;
+    const ElementaryRotation<Axis::X> elementaryRotation = ElementaryRotation<Axis::X>(angle) ;
+
+    const Matrix3Xd vectors = Matrix3Xd::Random(3, 1000) ;
+
+    Matrix3Xd rotatedVectors = Matrix3Xd::Zero(3, vectors.cols()) ;
+
+    Measure(aState, [&] () -> double
+    {
+
+        for (Eigen::Index index = 0; index < vectors.cols(); ++index)
+        {
+            rotatedVectors.col(index) = (aState.range(0) == 0) ? (rotationMatrix * Vector3d(vectors.col(index))) : (elementaryRotation * Vector3d(vectors.col(index))) ;
+        }
+
+        return rotatedVectors(0, 0) ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * vectors.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation_RotateVector)->Arg(0)->Arg(1) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,91 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_QuaternionsFromAngles_RotationMatrix (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::obj::Matrix4Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Matrix3Xd angles = Matrix3Xd::Random(3, aState.range(0)) ;
+
+    Matrix4Xd quaternions = Matrix4Xd::Zero(4, angles.cols()) ;
+
+    Measure(aState, [&] () -> double
+    {
+
+        for (Eigen::Index index = 0; index < angles.cols(); ++index)
+        {
+
+            const RotationMatrix rotationMatrix = RotationMatrix::RX(Angle::Radians(angles(2, index))) * RotationMatrix::RY(Angle::Radians(angles(1, index))) * RotationMatrix::RZ(Angle::Radians(angles(0, index))) ;
+
+            quaternions.col(index) = Quaternion::RotationMatrix(rotationMatrix).toVector(Quaternion::Format::XYZS) ;
+
+        }
+
+        return quaternions(0, 0) ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * angles.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_QuaternionsFromAngles_RotationMatrix)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_QuaternionsFromAngles (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::obj::Matrix4Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    const Matrix3Xd angles = Matrix3Xd::Random(3, aState.range(0)) ;
+
+    Measure(aState, [&] () -> Matrix4Xd { return EulerAngle::QuaternionsFromAngles(angles, EulerAngle::AxisSequence::ZYX) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * angles.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_QuaternionsFromAngles)->Arg(100000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_AnglesFromQuaternions (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::obj::Matrix4Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    const Matrix4Xd quaternions = Matrix4Xd::Random(4, aState.range(0)).colwise().normalized() ;
+
+    Measure(aState, [&] () -> Matrix3Xd { return EulerAngle::AnglesFromQuaternions(quaternions, EulerAngle::AxisSequence::ZYX) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * quaternions.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle_AnglesFromQuaternions)->Arg(100000) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
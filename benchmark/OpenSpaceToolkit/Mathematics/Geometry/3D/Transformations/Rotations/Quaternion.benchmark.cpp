@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.benchmark.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/QuaternionKernel.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <Global.benchmark.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVector (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Quaternion quaternion = Quaternion::XYZS(0.1, 0.2, 0.3, 0.9).toNormalized() ;
+
+    const Matrix3Xd vectors = Matrix3Xd::Random(3, aState.range(0)) ;
+
+    Matrix3Xd rotatedVectors = Matrix3Xd::Zero(3, vectors.cols()) ;
+
+    Measure(aState, [&] () -> double
+    {
+
+        for (Eigen::Index index = 0; index < vectors.cols(); ++index)
+        {
+            rotatedVectors.col(index) = quaternion.rotateVector(vectors.col(index)) ;
+        }
+
+        return rotatedVectors(0, 0) ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * vectors.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVector)->Arg(1000)->Arg(1000000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVectors (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Quaternion quaternion = Quaternion::XYZS(0.1, 0.2, 0.3, 0.9).toNormalized() ;
+
+    const Matrix3Xd vectors = Matrix3Xd::Random(3, aState.range(0)) ;
+
+    Measure(aState, [&] () -> Matrix3Xd { return quaternion.rotateVectors(vectors) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * vectors.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVectors)->Arg(1000)->Arg(1000000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVectorsInPlace (benchmark::State& aState)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Quaternion quaternion = Quaternion::XYZS(0.1, 0.2, 0.3, 0.9).toNormalized() ;
+
+    Matrix3Xd vectors = Matrix3Xd::Random(3, aState.range(0)) ;
+
+    Measure(aState, [&] () -> double { quaternion.rotateVectorsInPlace(vectors) ; return vectors(0, 0) ; }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * vectors.cols()) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_RotateVectorsInPlace)->Arg(1000)->Arg(1000000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_Propagate (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Quaternion increment = Quaternion::XYZS(1e-3, 2e-3, 3e-3, 1.0).toNormalized() ;
+
+    const Eigen::Index stepCount = aState.range(0) ;
+
+    Measure(aState, [&] () -> Quaternion
+    {
+
+        Quaternion quaternion = Quaternion::Unit() ;
+
+        for (Eigen::Index stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+        {
+            quaternion = (quaternion * increment).toNormalized() ;
+        }
+
+        return quaternion ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * stepCount) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_Propagate)->Arg(1000)->Arg(1000000) ;
+
+static void OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_Propagate_Kernel (benchmark::State& aState)
+{
+
+    using ostk::math::benchmark::Measure ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::kernel::AlignedQuaternion ;
+    using ostk::math::geom::d3::trf::rot::kernel::CrossMultiply ;
+    using ostk::math::geom::d3::trf::rot::kernel::Normalize ;
+
+    AlignedQuaternion increment = { { 1e-3, 2e-3, 3e-3, 1.0 } } ;
+
+    Normalize(increment.components) ;
+
+    const Eigen::Index stepCount = aState.range(0) ;
+
+    Measure(aState, [&] () -> double
+    {
+
+        AlignedQuaternion quaternion = { { 0.0, 0.0, 0.0, 1.0 } } ;
+
+        for (Eigen::Index stepIndex = 0; stepIndex < stepCount; ++stepIndex)
+        {
+            CrossMultiply(quaternion.components, increment.components, quaternion.components) ;
+            Normalize(quaternion.components) ;
+        }
+
+        return quaternion.components[3] ;
+
+    }) ;
+
+    aState.SetItemsProcessed(aState.iterations() * stepCount) ;
+
+}
+
+BENCHMARK (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion_Propagate_Kernel)->Arg(1000)->Arg(1000000) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
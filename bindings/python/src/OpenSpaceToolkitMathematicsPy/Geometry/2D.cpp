@@ -7,6 +7,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkitMathematicsPy/Geometry/2D/PolygonIndex.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Transformation.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Objects.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/2D/Object.cpp>
@@ -26,6 +27,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D   (
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object(d2) ; // Cannot be binded without including Transformation.cpp (uses forward declaration for Transformation)
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Objects(d2) ;
     OpenSpaceToolkitMathematicsPy_Geometry_2D_Transformation(d2) ;
+    OpenSpaceToolkitMathematicsPy_Geometry_2D_PolygonIndex(d2) ;
 
 }
 
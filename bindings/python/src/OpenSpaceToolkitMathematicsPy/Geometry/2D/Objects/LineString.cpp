@@ -23,7 +23,16 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
     using ostk::math::geom::d2::objects::Point ;
     using ostk::math::geom::d2::objects::LineString ;
 
-    class_<LineString, Object>(aModule, "LineString")
+    class_<LineString, Object> lineString(aModule, "LineString") ;
+
+    enum_<LineString::SimplificationMethod>(lineString, "SimplificationMethod")
+
+        .value("DouglasPeucker", LineString::SimplificationMethod::DouglasPeucker)
+        .value("Visvalingam", LineString::SimplificationMethod::Visvalingam)
+
+    ;
+
+    lineString
 
         .def(init<const Array<Point>&>())
 
@@ -39,11 +48,15 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
 
         .def("get_point_count", &LineString::getPointCount)
         .def("get_point_closest_to", &LineString::getPointClosestTo)
+        .def("get_projection_of", &LineString::getProjectionOf)
+        .def("simplify", &LineString::simplify, "aTolerance"_a, "aMethod"_a=LineString::SimplificationMethod::DouglasPeucker, "preserveTopology"_a=false)
         .def("to_string", &LineString::toString, "aFormat"_a=Object::Format::Standard, "aPrecision"_a=Integer::Undefined())
 
+        .def("build_index", &LineString::buildIndex)
         .def("apply_transformation", &LineString::applyTransformation)
 
         .def_static("empty", &LineString::Empty)
+        .def_static("simplify_all", &LineString::Simplify, "aLineStringArray"_a, "aTolerance"_a, "aMethod"_a=LineString::SimplificationMethod::DouglasPeucker, "preserveTopology"_a=false)
 
         .def("__len__", &LineString::getPointCount)
         .def("__getitem__", +[] (const LineString& aLineString, const size_t anIndex) -> const Point& { return aLineString.accessPointAt(anIndex) ; }, return_value_policy::reference_internal)
@@ -51,6 +64,15 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
 
     ;
 
+    class_<LineString::Projection>(lineString, "Projection")
+
+        .def_readonly("point", &LineString::Projection::point)
+        .def_readonly("segment_index", &LineString::Projection::segmentIndex)
+        .def_readonly("arc_length", &LineString::Projection::arcLength)
+        .def_readonly("distance", &LineString::Projection::distance)
+
+    ;
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
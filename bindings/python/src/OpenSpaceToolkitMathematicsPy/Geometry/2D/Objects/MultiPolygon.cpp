@@ -23,6 +23,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
     using ostk::math::geom::d2::Object ;
     using ostk::math::geom::d2::objects::Point ;
     using ostk::math::geom::d2::objects::PointSet ;
+    using ostk::math::geom::d2::objects::LineString ;
     using ostk::math::geom::d2::objects::Polygon ;
     using ostk::math::geom::d2::objects::MultiPolygon ;
 
@@ -39,16 +40,24 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
         .def("is_defined", &MultiPolygon::isDefined)
         .def("contains_point", +[] (const MultiPolygon& aMultiPolygon, const Point& aPoint) -> bool { return aMultiPolygon.contains(aPoint) ; })
         .def("contains_point_set", +[] (const MultiPolygon& aMultiPolygon, const PointSet& aPointSet) -> bool { return aMultiPolygon.contains(aPointSet) ; })
+        .def("contains_points", &MultiPolygon::containsPoints)
+        .def("build_index", &MultiPolygon::buildIndex)
 
         .def("get_polygon_count", &MultiPolygon::getPolygonCount)
         .def("get_polygons", &MultiPolygon::getPolygons)
         .def("get_convex_hull", &MultiPolygon::getConvexHull)
+        .def("intersection_with", &MultiPolygon::intersectionWith)
         .def("union_with", &MultiPolygon::unionWith)
+        .def("difference_with", &MultiPolygon::differenceWith)
+        .def("symmetric_difference_with", &MultiPolygon::symmetricDifferenceWith)
+        .def("clip", &MultiPolygon::clip)
+        .def("simplify", &MultiPolygon::simplify, "aTolerance"_a, "aMethod"_a=LineString::SimplificationMethod::DouglasPeucker, "preserveTopology"_a=false)
         .def("to_string", &MultiPolygon::toString, "aFormat"_a=Object::Format::Standard, "aPrecision"_a=Integer::Undefined())
         .def("apply_transformation", &MultiPolygon::applyTransformation)
 
         .def_static("undefined", &MultiPolygon::Undefined)
         .def_static("polygon", &MultiPolygon::Polygon)
+        .def_static("union", &MultiPolygon::Union)
 
     ;
 
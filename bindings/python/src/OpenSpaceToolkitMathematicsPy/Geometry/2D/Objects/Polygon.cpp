@@ -23,6 +23,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
     using ostk::math::geom::d2::Object ;
     using ostk::math::geom::d2::objects::Point ;
     using ostk::math::geom::d2::objects::PointSet ;
+    using ostk::math::geom::d2::objects::LineString ;
     using ostk::math::geom::d2::objects::Polygon ;
 
     class_<Polygon, Object>(aModule, "Polygon")
@@ -42,6 +43,8 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
         .def("intersects_polygon", +[] (const Polygon& aPolygon, const Polygon& anotherPolygon) -> bool { return aPolygon.intersects(anotherPolygon) ; })
         .def("contains_point", +[] (const Polygon& aPolygon, const Point& aPoint) -> bool { return aPolygon.contains(aPoint) ; })
         .def("contains_point_set", +[] (const Polygon& aPolygon, const PointSet& aPointSet) -> bool { return aPolygon.contains(aPointSet) ; })
+        .def("contains_points", &Polygon::containsPoints)
+        .def("build_index", &Polygon::buildIndex)
 
         .def("get_inner_ring_count", &Polygon::getInnerRingCount)
         .def("get_edge_count", &Polygon::getEdgeCount)
@@ -53,7 +56,11 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_Object
         .def("get_edges", &Polygon::getEdges)
         .def("get_vertices", &Polygon::getVertices)
         .def("get_convex_hull", &Polygon::getConvexHull)
+        .def("intersection_with", &Polygon::intersectionWith)
         .def("union_with", &Polygon::unionWith)
+        .def("difference_with", &Polygon::differenceWith)
+        .def("symmetric_difference_with", &Polygon::symmetricDifferenceWith)
+        .def("simplify", &Polygon::simplify, "aTolerance"_a, "aMethod"_a=LineString::SimplificationMethod::DouglasPeucker, "preserveTopology"_a=false)
         .def("to_string", &Polygon::toString, "aFormat"_a=Object::Format::Standard, "aPrecision"_a=Integer::Undefined())
         .def("apply_transformation", &Polygon::applyTransformation)
 
@@ -0,0 +1,52 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           bindings/python/src/OpenSpaceToolkitMathematicsPy/Geometry/2D/PolygonIndex.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitMathematicsPy_Geometry_2D_PolygonIndex (        pybind11::module&           aModule                                     )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    class_<PolygonIndex>(aModule, "PolygonIndex")
+
+        .def(init<const Array<Polygon>&>())
+        .def(init<const MultiPolygon&>())
+
+        .def("__str__", &(shiftToString<PolygonIndex>))
+        .def("__repr__", &(shiftToString<PolygonIndex>))
+
+        .def("is_empty", &PolygonIndex::isEmpty)
+        .def("contains", &PolygonIndex::contains)
+
+        .def("access_polygon_at", &PolygonIndex::accessPolygonAt, return_value_policy::reference_internal)
+        .def("get_polygon_count", &PolygonIndex::getPolygonCount)
+        .def("get_polygon_indices_containing", &PolygonIndex::getPolygonIndicesContaining)
+        .def("get_polygon_indices_overlapping_box", &PolygonIndex::getPolygonIndicesOverlappingBox)
+        .def("get_polygon_indices_overlapping", &PolygonIndex::getPolygonIndicesOverlapping)
+
+        .def("add_polygon", &PolygonIndex::addPolygon)
+
+        .def_static("empty", &PolygonIndex::Empty)
+
+        .def("__len__", &PolygonIndex::getPolygonCount)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
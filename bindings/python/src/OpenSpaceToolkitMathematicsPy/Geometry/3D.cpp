@@ -7,6 +7,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Scene.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Intersection.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformation.cpp>
@@ -30,6 +31,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D   (
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformation(d3) ;
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations(d3) ;
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Intersection(d3) ;
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Scene(d3) ;
 
 }
 
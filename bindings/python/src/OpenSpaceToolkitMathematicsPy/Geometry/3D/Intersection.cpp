@@ -109,7 +109,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Inters
         .def_static("undefined", &Intersection::Undefined)
         .def_static("empty", &Intersection::Empty)
         .def_static("point", &Intersection::Point)
-        .def_static("point_set", &Intersection::PointSet)
+        .def_static("point_set", +[] (const PointSet& aPointSet) -> Intersection { return Intersection::PointSet(aPointSet) ; })
         .def_static("line", &Intersection::Line)
         .def_static("ray", &Intersection::Ray)
         .def_static("segment", &Intersection::Segment)
@@ -55,6 +55,9 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
         .def("is_pyramid", +[] (const Object& anObject) -> bool { return anObject.is<Pyramid>() ; })
         .def("intersects", &Object::intersects)
         .def("contains", &Object::contains)
+        .def("get_bounding_box", &Object::getBoundingBox)
+        .def("get_oriented_bounding_box", &Object::getOrientedBoundingBox)
+        .def("get_bounding_sphere", &Object::getBoundingSphere)
 
         .def("as_point", +[] (const Object& anObject) -> Point { return anObject.as<Point>() ; })
         .def("as_point_set", +[] (const Object& anObject) -> PointSet { return anObject.as<PointSet>() ; })
@@ -76,6 +76,8 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
 
         .def_static("undefined", &Cuboid::Undefined)
         .def_static("cube", &Cuboid::Cube)
+        .def_static("bounding_box", &Cuboid::BoundingBox)
+        .def_static("oriented_bounding_box", &Cuboid::OrientedBoundingBox)
 
     ;
 
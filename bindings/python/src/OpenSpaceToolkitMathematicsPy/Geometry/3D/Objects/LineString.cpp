@@ -22,7 +22,9 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
     using ostk::math::geom::d3::objects::Point ;
     using ostk::math::geom::d3::objects::LineString ;
 
-    class_<LineString, Object>(aModule, "LineString")
+    class_<LineString, Object> lineString(aModule, "LineString") ;
+
+    lineString
 
         .def(init<const Array<Point>&>())
 
@@ -38,6 +40,8 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
 
         .def("get_point_count", &LineString::getPointCount)
         .def("get_point_closest_to", &LineString::getPointClosestTo)
+        .def("get_projection_of", &LineString::getProjectionOf)
+        .def("build_index", &LineString::buildIndex)
         .def("apply_transformation", &LineString::applyTransformation)
 
         .def_static("empty", &LineString::Empty)
@@ -48,6 +52,15 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
 
     ;
 
+    class_<LineString::Projection>(lineString, "Projection")
+
+        .def_readonly("point", &LineString::Projection::point)
+        .def_readonly("segment_index", &LineString::Projection::segmentIndex)
+        .def_readonly("arc_length", &LineString::Projection::arcLength)
+        .def_readonly("distance", &LineString::Projection::distance)
+
+    ;
+
 }
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
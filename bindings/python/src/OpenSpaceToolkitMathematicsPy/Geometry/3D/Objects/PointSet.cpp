@@ -38,6 +38,9 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
 
         .def("get_size", &PointSet::getSize)
         .def("get_point_closest_to", &PointSet::getPointClosestTo)
+        .def("get_points_closest_to", &PointSet::getPointsClosestTo)
+        .def("get_points_within_distance", &PointSet::getPointsWithinDistance)
+        .def("build_index", &PointSet::buildIndex)
         .def("apply_transformation", &PointSet::applyTransformation)
 
         .def_static("empty", &PointSet::Empty)
@@ -61,6 +61,7 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Object
 
         .def_static("undefined", &Sphere::Undefined)
         .def_static("unit", &Sphere::Unit)
+        .def_static("bounding_sphere", &Sphere::BoundingSphere)
 
     ;
 
@@ -0,0 +1,67 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           bindings/python/src/OpenSpaceToolkitMathematicsPy/Geometry/3D/Scene.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Scene (               pybind11::module&           aModule                                     )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Index ;
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Transformation ;
+    using ostk::math::geom::d3::Scene ;
+
+    class_<Scene> scene(aModule, "Scene") ;
+
+    scene
+
+        .def("__str__", &(shiftToString<Scene>))
+        .def("__repr__", &(shiftToString<Scene>))
+
+        .def("is_empty", &Scene::isEmpty)
+        .def("intersects", overload_cast<const Ray&>(&Scene::intersects, const_))
+        .def("intersects", overload_cast<const Segment&>(&Scene::intersects, const_))
+
+        .def("access_object_at", &Scene::accessObjectAt, return_value_policy::reference_internal)
+        .def("get_object_count", &Scene::getObjectCount)
+        .def("get_first_hit_of", &Scene::getFirstHitOf)
+        .def("get_object_indices_overlapping", &Scene::getObjectIndicesOverlapping)
+
+        .def("add_object", overload_cast<const Object&>(&Scene::addObject))
+        .def("build", &Scene::build)
+        .def("apply_transformation", overload_cast<const Index&, const Transformation&>(&Scene::applyTransformation))
+        .def("apply_transformation", overload_cast<const Transformation&>(&Scene::applyTransformation))
+
+        .def_static("empty", &Scene::Empty)
+
+        .def("__len__", &Scene::getObjectCount)
+
+    ;
+
+    class_<Scene::Hit>(scene, "Hit")
+
+        .def("is_defined", &Scene::Hit::isDefined)
+
+        .def_readonly("object_index", &Scene::Hit::objectIndex)
+        .def_readonly("point", &Scene::Hit::point)
+        .def_readonly("distance", &Scene::Hit::distance)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,6 +10,8 @@
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/Quaternion.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/RotationVector.cpp>
 #include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/RotationMatrix.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.cpp>
+#include <OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/EulerAngle.cpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -26,6 +28,8 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transf
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_Quaternion(rotations) ;
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_RotationVector(rotations) ;
     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_RotationMatrix(rotations) ;
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_AttitudeInterpolator(rotations) ;
+    OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_EulerAngle(rotations) ;
 
 }
 
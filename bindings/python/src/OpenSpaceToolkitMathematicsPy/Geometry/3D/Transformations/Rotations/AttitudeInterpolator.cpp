@@ -0,0 +1,57 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           bindings/python/src/OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_AttitudeInterpolator ( pybind11::module& aModule            )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::AttitudeInterpolator ;
+
+    class_<AttitudeInterpolator> attitudeInterpolator(aModule, "AttitudeInterpolator") ;
+
+    enum_<AttitudeInterpolator::Type>(attitudeInterpolator, "Type")
+
+        .value("Undefined", AttitudeInterpolator::Type::Undefined)
+        .value("NLERP", AttitudeInterpolator::Type::NLERP)
+        .value("SLERP", AttitudeInterpolator::Type::SLERP)
+        .value("SQUAD", AttitudeInterpolator::Type::SQUAD)
+
+    ;
+
+    attitudeInterpolator
+
+        .def(init<const VectorXd&, const Array<Quaternion>&, const AttitudeInterpolator::Type&>(), "aTimeArray"_a, "aQuaternionArray"_a, "aType"_a=AttitudeInterpolator::Type::SLERP)
+
+        .def("__str__", &(shiftToString<AttitudeInterpolator>))
+        .def("__repr__", &(shiftToString<AttitudeInterpolator>))
+
+        .def("get_sample_count", &AttitudeInterpolator::getSampleCount)
+        .def("get_type", &AttitudeInterpolator::getType)
+        .def("get_first_time", &AttitudeInterpolator::getFirstTime)
+        .def("get_last_time", &AttitudeInterpolator::getLastTime)
+        .def("evaluate", overload_cast<const Real&>(&AttitudeInterpolator::evaluate, const_))
+        .def("evaluate", overload_cast<const VectorXd&>(&AttitudeInterpolator::evaluate, const_))
+
+        .def_static("string_from_type", &AttitudeInterpolator::StringFromType)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,81 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           bindings/python/src/OpenSpaceToolkitMathematicsPy/Geometry/3D/Transformations/Rotations/EulerAngle.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transformations_Rotations_EulerAngle ( pybind11::module& aModule                      )
+{
+
+    using namespace pybind11 ;
+
+    using ostk::core::types::Integer ;
+    using ostk::core::types::String ;
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    class_<EulerAngle> eulerAngle(aModule, "EulerAngle") ;
+
+    enum_<EulerAngle::AxisSequence>(eulerAngle, "AxisSequence")
+
+        .value("Undefined", EulerAngle::AxisSequence::Undefined)
+        .value("XYX", EulerAngle::AxisSequence::XYX)
+        .value("XYZ", EulerAngle::AxisSequence::XYZ)
+        .value("XZX", EulerAngle::AxisSequence::XZX)
+        .value("XZY", EulerAngle::AxisSequence::XZY)
+        .value("YXY", EulerAngle::AxisSequence::YXY)
+        .value("YXZ", EulerAngle::AxisSequence::YXZ)
+        .value("YZX", EulerAngle::AxisSequence::YZX)
+        .value("YZY", EulerAngle::AxisSequence::YZY)
+        .value("ZXY", EulerAngle::AxisSequence::ZXY)
+        .value("ZXZ", EulerAngle::AxisSequence::ZXZ)
+        .value("ZYX", EulerAngle::AxisSequence::ZYX)
+        .value("ZYZ", EulerAngle::AxisSequence::ZYZ)
+
+    ;
+
+    eulerAngle
+
+        .def(init<const Angle&, const Angle&, const Angle&, const EulerAngle::AxisSequence&>(), "aFirstAngle"_a, "aSecondAngle"_a, "aThirdAngle"_a, "anAxisSequence"_a)
+
+        .def(self == self)
+        .def(self != self)
+
+        .def("__str__", &(shiftToString<EulerAngle>))
+        .def("__repr__", &(shiftToString<EulerAngle>))
+
+        .def("is_defined", &EulerAngle::isDefined)
+
+        .def("get_phi", &EulerAngle::getPhi)
+        .def("get_theta", &EulerAngle::getTheta)
+        .def("get_psi", &EulerAngle::getPsi)
+        .def("get_axis_sequence", &EulerAngle::getAxisSequence)
+        .def("to_vector", &EulerAngle::toVector, "anAngleUnit"_a)
+        .def("to_quaternion", &EulerAngle::toQuaternion)
+        .def("to_rotation_matrix", &EulerAngle::toRotationMatrix)
+        .def("to_string", +[] (const EulerAngle& anEulerAngle) -> String { return anEulerAngle.toString() ; })
+        .def("to_string", +[] (const EulerAngle& anEulerAngle, const Integer& aPrecision) -> String { return anEulerAngle.toString(aPrecision) ; })
+
+        .def_static("undefined", &EulerAngle::Undefined)
+        .def_static("vector", &EulerAngle::Vector, "aVector"_a, "anAngleUnit"_a, "anAxisSequence"_a)
+        .def_static("quaternion", &EulerAngle::Quaternion, "aQuaternion"_a, "anAxisSequence"_a)
+        .def_static("rotation_matrix", &EulerAngle::RotationMatrix, "aRotationMatrix"_a, "anAxisSequence"_a)
+        .def_static("quaternions_from_angles", &EulerAngle::QuaternionsFromAngles, "anAngleArray"_a, "anAxisSequence"_a)
+        .def_static("angles_from_quaternions", &EulerAngle::AnglesFromQuaternions, "aQuaternionArray"_a, "anAxisSequence"_a)
+        .def_static("string_from_axis_sequence", &EulerAngle::StringFromAxisSequence)
+
+    ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
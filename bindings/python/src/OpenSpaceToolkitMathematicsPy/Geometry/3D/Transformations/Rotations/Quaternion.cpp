@@ -69,13 +69,14 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transf
         .def("to_normalized", &Quaternion::toNormalized)
         .def("to_conjugate", &Quaternion::toConjugate)
         .def("to_inverse", &Quaternion::toInverse)
-        // .def("pow", &Quaternion::pow)
-        // .def("exp", &Quaternion::exp)
-        // .def("log", &Quaternion::log)
+        .def("pow", &Quaternion::pow)
+        .def("exp", &Quaternion::exp)
+        .def("log", &Quaternion::log)
         .def("norm", &Quaternion::norm)
         .def("cross_multiply", &Quaternion::crossMultiply)
         .def("dot_multiply", &Quaternion::dotMultiply)
         .def("rotate_vector", &Quaternion::rotateVector)
+        .def("rotate_vectors", &Quaternion::rotateVectors)
         .def("to_vector", &Quaternion::toVector)
         .def("to_string", +[] (const Quaternion& aQuaternion) -> String { return aQuaternion.toString() ; })
         .def("to_string", +[] (const Quaternion& aQuaternion, const Quaternion::Format aFormat) -> String { return aQuaternion.toString(aFormat) ; })
@@ -92,6 +93,10 @@ inline void                     OpenSpaceToolkitMathematicsPy_Geometry_3D_Transf
         .def_static("rotation_vector", &Quaternion::RotationVector)
         .def_static("rotation_matrix", &Quaternion::RotationMatrix)
         .def_static("parse", &Quaternion::Parse)
+        .def_static("slerp", &Quaternion::SLERP)
+        .def_static("nlerp", &Quaternion::NLERP)
+        .def_static("squad", &Quaternion::SQUAD)
+        .def_static("squad_control_point", &Quaternion::SQUADControlPoint)
 
     ;
 
@@ -176,6 +176,19 @@ def test_geometry_d2_objects_linestring_getitem ():
     assert isinstance(linestring_list[1], Point)
     assert len(linestring_list) == 2
 
+def test_geometry_d2_objects_linestring_simplify ():
+
+    linestring: LineString = LineString([Point(0.0, 0.0), Point(1.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)])
+
+    assert linestring.simplify(0.0) == LineString([Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)])
+    assert linestring.simplify(0.0, LineString.SimplificationMethod.Visvalingam) == LineString([Point(0.0, 0.0), Point(2.0, 0.0), Point(2.0, 2.0)])
+    assert linestring.simplify(1.5) == LineString([Point(0.0, 0.0), Point(2.0, 2.0)])
+
+    linestrings = LineString.simplify_all([linestring], 1.5, LineString.SimplificationMethod.DouglasPeucker, True)
+
+    assert len(linestrings) == 1
+    assert isinstance(linestrings[0], LineString)
+
 # def test_geometry_d2_objects_linestring_to_string ():
 
 # def test_geometry_d2_objects_linestring_apply_transformation ():
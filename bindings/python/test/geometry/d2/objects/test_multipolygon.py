@@ -157,6 +157,19 @@ def test_geometry_d2_objects_multipoolygon_getters ():
 
 # def test_geometry_d2_objects_multipolygon_union_with() :
 
+def test_geometry_d2_objects_multipolygon_union ():
+
+    polygon_1: Polygon = Polygon([Point(0.0, 0.0), Point(0.0, 1.0), Point(1.0, 1.0), Point(1.0, 0.0)])
+    polygon_2: Polygon = Polygon([Point(0.5, 0.0), Point(0.5, 1.0), Point(1.5, 1.0), Point(1.5, 0.0)])
+    polygon_3: Polygon = Polygon([Point(3.0, 0.0), Point(3.0, 1.0), Point(4.0, 1.0), Point(4.0, 0.0)])
+
+    multipolygon: MultiPolygon = MultiPolygon.union([polygon_1, polygon_2, polygon_3])
+
+    assert isinstance(multipolygon, MultiPolygon)
+    assert multipolygon.get_polygon_count() == 2
+    assert multipolygon.contains_point(Point(1.25, 0.5)) is True
+    assert multipolygon.contains_point(Point(2.0, 0.5)) is False
+
 # def test_geometry_d2_objects_multipolygon_to_string ():
 
 # def test_geometry_d2_objects_multipolygon_apply_transformation ():
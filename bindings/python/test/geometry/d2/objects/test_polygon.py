@@ -261,6 +261,14 @@ def test_geometry_d2_objects_polygon_contains ():
 
     assert polygon.contains_point_set(pointset)
 
+    assert polygon.contains_points(np.array([[0.0, 1.0, 10.0], [0.0, 0.5, 10.0]])).tolist() == [True, True, False]
+
+    polygon.build_index()
+
+    assert polygon.contains_point(Point.origin())
+    assert polygon.contains_point(point_1)
+    assert polygon.contains_point(Point(10.0, 10.0)) is False
+
 def test_geometry_d2_objects_polygon_getters ():
 
     # Outer Ring Vertices
@@ -0,0 +1,58 @@
+################################################################################################################################################################
+
+# @project        Open Space Toolkit ▸ Mathematics
+# @file           bindings/python/test/geometry/d3/transformations/rotations/test_attitude_interpolator.py
+# @author         Lucas Brémond <lucas@loftorbital.com>
+# @license        Apache License 2.0
+
+################################################################################################################################################################
+
+import pytest
+
+import numpy
+
+from ostk.mathematics import geometry
+
+################################################################################################################################################################
+
+Angle = geometry.Angle
+Quaternion = geometry.d3.transformations.rotations.Quaternion
+AttitudeInterpolator = geometry.d3.transformations.rotations.AttitudeInterpolator
+
+################################################################################################################################################################
+
+def test_geometry_d3_transformations_rotations_attitude_interpolator ():
+
+    times = numpy.array([0.0, 10.0, 20.0], dtype=float)
+    quaternions = [Quaternion.unit(), Quaternion.xyzs(0.0, 0.0, 1.0, 0.0), Quaternion.unit()]
+
+    interpolator: AttitudeInterpolator = AttitudeInterpolator(times, quaternions, AttitudeInterpolator.Type.SLERP)
+
+    assert interpolator.get_sample_count() == 3
+    assert interpolator.get_type() == AttitudeInterpolator.Type.SLERP
+    assert interpolator.get_first_time() == 0.0
+    assert interpolator.get_last_time() == 20.0
+
+    assert interpolator.evaluate(5.0).is_near(Quaternion.slerp(quaternions[0], quaternions[1], 0.5), Angle.radians(1e-12))
+
+    evaluated_quaternions = interpolator.evaluate(numpy.array([0.0, 5.0, 20.0], dtype=float))
+
+    assert len(evaluated_quaternions) == 3
+    assert evaluated_quaternions[0].is_near(quaternions[0], Angle.radians(1e-12))
+
+    assert AttitudeInterpolator.string_from_type(AttitudeInterpolator.Type.SQUAD) == "SQUAD"
+
+    with pytest.raises(RuntimeError):
+
+        interpolator.evaluate(30.0)
+
+def test_geometry_d3_transformations_rotations_quaternion_interpolation ():
+
+    q_1: Quaternion = Quaternion.unit()
+    q_2: Quaternion = Quaternion.xyzs(0.0, 0.0, 1.0, 0.0)
+
+    assert Quaternion.slerp(q_1, q_2, 0.0).is_near(q_1, Angle.radians(1e-12))
+    assert Quaternion.nlerp(q_1, q_2, 1.0).is_near(q_2, Angle.radians(1e-12))
+    assert Quaternion.squad(q_1, q_1, q_2, q_2, 1.0).is_near(q_2, Angle.radians(1e-12))
+
+################################################################################################################################################################
@@ -0,0 +1,49 @@
+################################################################################################################################################################
+
+# @project        Open Space Toolkit ▸ Mathematics
+# @file           bindings/python/test/geometry/d3/transformations/rotations/test_euler_angle.py
+# @author         Lucas Brémond <lucas@loftorbital.com>
+# @license        Apache License 2.0
+
+################################################################################################################################################################
+
+import pytest
+
+import numpy
+
+from ostk.mathematics import geometry
+
+################################################################################################################################################################
+
+Angle = geometry.Angle
+Quaternion = geometry.d3.transformations.rotations.Quaternion
+RotationMatrix = geometry.d3.transformations.rotations.RotationMatrix
+EulerAngle = geometry.d3.transformations.rotations.EulerAngle
+
+################################################################################################################################################################
+
+def test_geometry_d3_transformations_rotations_euler_angle ():
+
+    euler_angle: EulerAngle = EulerAngle(Angle.degrees(10.0), Angle.degrees(20.0), Angle.degrees(30.0), EulerAngle.AxisSequence.ZYX)
+
+    assert euler_angle.is_defined()
+    assert euler_angle.get_axis_sequence() == EulerAngle.AxisSequence.ZYX
+    assert euler_angle.get_phi() == Angle.degrees(10.0)
+
+    quaternion: Quaternion = euler_angle.to_quaternion()
+
+    assert quaternion.is_near(Quaternion.rotation_matrix(euler_angle.to_rotation_matrix()), Angle.radians(1e-12))
+    assert numpy.allclose(EulerAngle.quaternion(quaternion, EulerAngle.AxisSequence.ZYX).to_vector(Angle.Unit.Degree), [10.0, 20.0, 30.0])
+
+    assert EulerAngle.string_from_axis_sequence(EulerAngle.AxisSequence.ZXZ) == 'ZXZ'
+
+def test_geometry_d3_transformations_rotations_euler_angle_batch ():
+
+    angles = numpy.radians(numpy.array([[10.0, -20.0], [20.0, 45.0], [30.0, 170.0]], dtype=float))
+
+    quaternions = EulerAngle.quaternions_from_angles(angles, EulerAngle.AxisSequence.XYZ)
+
+    assert quaternions.shape == (4, 2)
+    assert numpy.allclose(EulerAngle.angles_from_quaternions(quaternions, EulerAngle.AxisSequence.XYZ), angles)
+
+################################################################################################################################################################
@@ -72,4 +72,12 @@ def test_geometry_d3_transformations_rotations_quaternion ():
     # RotationMatrix
     assert Quaternion.parse("[0.0, 0.0, 0.0, 1.0]", Quaternion.Format.XYZS).is_defined() is True
 
+def test_geometry_d3_transformations_rotations_quaternion_rotate_vectors ():
+
+    q: Quaternion = Quaternion.unit()
+
+    vectors = numpy.array([[1.0, 0.0], [0.0, 1.0], [0.0, 0.0]], dtype=float)
+
+    assert numpy.array_equal(q.rotate_vectors(vectors), vectors)
+
 ################################################################################################################################################################
@@ -14,9 +14,13 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 
+#include <mutex>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -32,7 +36,9 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Shared ;
 using ostk::core::types::Index ;
+using ostk::core::types::Real ;
 using ostk::core::types::Size ;
 using ostk::core::ctnr::Array ;
 
@@ -59,6 +65,28 @@ class LineString : public Object
 
         typedef                 Array<Point>::ConstIterator                     ConstIterator ;
 
+        /// @brief              Simplification method
+
+        enum class SimplificationMethod
+        {
+
+            DouglasPeucker,     ///< Douglas-Peucker: drop the vertices within the tolerance of the simplified line
+            Visvalingam         ///< Visvalingam-Whyatt: drop the vertices whose effective area is within the squared tolerance
+
+        } ;
+
+        /// @brief              Projection of a point onto a line string
+
+        struct Projection
+        {
+
+            Point               point ;                                     ///< Closest point on the line string
+            Index               segmentIndex ;                              ///< Index of the segment holding the closest point (between points segmentIndex and segmentIndex + 1)
+            Real                arcLength ;                                 ///< Arc length from the first point of the line string to the closest point
+            Real                distance ;                                  ///< Distance from the projected point to the closest point
+
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -69,12 +97,27 @@ class LineString : public Object
 
                                 LineString                                  (   const   Array<Point>&               aPointArray                                 ) ;
 
+        /// @brief              Copy constructor
+        ///
+        ///                     The segment index, if built, is shared with the copy.
+        ///
+        /// @param              [in] aLineString A line string
+
+                                LineString                                  (   const   LineString&                 aLineString                                 ) ;
+
         /// @brief              Clone line string
         ///
         /// @return             Pointer to cloned line string
 
         virtual LineString*     clone                                       ( ) const override ;
 
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aLineString A line string
+        /// @return             Reference to line string
+
+        LineString&             operator =                                  (   const   LineString&                 aLineString                                 ) ;
+
         /// @brief              Equal to operator
         ///
         /// @param              [in] aLineString A line string
@@ -142,6 +185,50 @@ class LineString : public Object
 
         Point                   getPointClosestTo                           (   const   Point&                      aPoint                                      ) const ;
 
+        /// @brief              Project point onto line string
+        ///
+        ///                     Finds the closest point over all segments of the line string (not only its vertices).
+        ///                     Long line strings are searched through a hierarchy of segment bounding boxes, built on first query.
+        ///
+        /// @code
+        ///                     LineString({ { 0.0, 0.0 }, { 2.0, 0.0 } }).getProjectionOf({ 1.0, 1.0 }) ; // { [1.0, 0.0], 0, 1.0, 1.0 }
+        /// @endcode
+        ///
+        /// @param              [in] aPoint A point
+        /// @return             Projection of point onto line string
+
+        LineString::Projection  getProjectionOf                             (   const   Point&                      aPoint                                      ) const ;
+
+        /// @brief              Build segment index
+        ///
+        ///                     The index brings projections down to O(log n) on average.
+        ///                     It is otherwise built on first projection, for line strings long enough to benefit from it.
+        ///                     It is shared between copies, and discarded when the line string is transformed.
+
+        void                    buildIndex                                  ( ) const ;
+
+        /// @brief              Simplify line string
+        ///
+        ///                     Removes the vertices that do not contribute to the shape of the line string, as judged by the given method.
+        ///                     End points are kept. Closed line strings are simplified as rings, and keep at least 3 distinct vertices.
+        ///
+        ///                     With topology preservation, a vertex is only removed if no other vertex lies in the triangle it forms
+        ///                     with its neighbours, so that the simplified line string does not cross itself where the original did not.
+        ///
+        /// @code
+        ///                     LineString lineString = ... ;
+        ///                     LineString simplifiedLineString = lineString.simplify(1e-3) ;
+        /// @endcode
+        ///
+        /// @param              [in] aTolerance A tolerance (distance)
+        /// @param              [in] (optional) aMethod A simplification method
+        /// @param              [in] (optional) preserveTopology If true, preserve topology
+        /// @return             Simplified line string
+
+        LineString              simplify                                    (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod                               =   LineString::SimplificationMethod::DouglasPeucker,
+                                                                                        bool                        preserveTopology                            =   false ) const ;
+
         /// @brief              Get string representation
         ///
         /// @param              [in] aFormat A format
@@ -197,10 +284,33 @@ class LineString : public Object
 
         static LineString       Segment                                     (   const   objects::Segment&           aSegment                                    ) ;
 
+        /// @brief              Simplify line strings together
+        ///
+        ///                     Same as simplify, with topology preserved between line strings as well (e.g. the rings of polygons).
+        ///
+        /// @param              [in] aLineStringArray An array of line strings
+        /// @param              [in] aTolerance A tolerance (distance)
+        /// @param              [in] aMethod A simplification method
+        /// @param              [in] preserveTopology If true, preserve topology
+        /// @return             Array of simplified line strings, in the same order
+
+        static Array<LineString> Simplify                                   (   const   Array<LineString>&          aLineStringArray,
+                                                                                const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            ) ;
+
     private:
 
+        class SegmentTree ;
+        class Simplifier ;
+
         Array<Point>            points_ ;
 
+        mutable Shared<const LineString::SegmentTree> indexSPtr_ ;
+        mutable std::mutex      indexMutex_ ;
+
+        Shared<const LineString::SegmentTree> accessIndex                   (           bool                        aForce                                      ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
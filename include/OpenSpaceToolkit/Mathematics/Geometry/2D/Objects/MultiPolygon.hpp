@@ -21,6 +21,9 @@
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 #include <OpenSpaceToolkit/Core/Types/Unique.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -32,16 +35,22 @@ namespace geom
 {
 namespace d2
 {
+
+class PolygonIndex ;
+
 namespace objects
 {
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 using ostk::core::types::Unique ;
+using ostk::core::types::Shared ;
 using ostk::core::ctnr::Index ;
 using ostk::core::ctnr::Size ;
 using ostk::core::ctnr::Array ;
 
+using ostk::math::obj::VectorXb ;
+using ostk::math::obj::Matrix2Xd ;
 using ostk::math::geom::d2::Object ;
 using ostk::math::geom::d2::objects::Point ;
 using ostk::math::geom::d2::objects::Segment ;
@@ -111,6 +120,8 @@ class MultiPolygon : public Object
 
         /// @brief              Check if multi-polygon contains point
         ///
+        ///                     Multi-polygons with many polygons are tested through a polygon index, built on first query.
+        ///
         /// @code
         ///                     MultiPolygon multiPolygon = ... ;
         ///                     Point point = ... ;
@@ -135,6 +146,33 @@ class MultiPolygon : public Object
 
         bool                    contains                                    (   const   PointSet&                   aPointSet                                   ) const ;
 
+        /// @brief              Check which points of an array are contained in multi-polygon
+        ///
+        ///                     Point i is given by aPointArray.col(i), and is contained if any polygon contains it.
+        ///
+        /// @code
+        ///                     MultiPolygon multiPolygon = ... ;
+        ///                     Matrix2Xd points = ... ;
+        ///                     VectorXb mask = multiPolygon.containsPoints(points) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPointArray A 2xN array of points
+        /// @return             Containment mask, of size N
+
+        VectorXb                containsPoints                              (   const   Matrix2Xd&                  aPointArray                                 ) const ;
+
+        /// @brief              Build polygon index
+        ///
+        ///                     The index (see PolygonIndex) restricts point containment to the polygons whose bounding box holds the point.
+        ///                     It is otherwise built on the first query once the multi-polygon has enough polygons, and is shared by copies.
+        ///
+        /// @code
+        ///                     MultiPolygon multiPolygon = ... ;
+        ///                     multiPolygon.buildIndex() ;
+        /// @endcode
+
+        void                    buildIndex                                  ( ) const ;
+
         /// @brief              Get number of polygons
         ///
         /// @return             Number of polygons
@@ -158,10 +196,67 @@ class MultiPolygon : public Object
         /// @brief              Compute intersection of multi-polygon with multi-polygon
         ///
         /// @param              [in] aMultiPolygon A multi-polygon
+        /// @return             A multi-polygon, undefined if multi-polygons do not overlap
+
+        MultiPolygon            intersectionWith                            (   const   MultiPolygon&               aMultiPolygon                               ) const ;
+
+        /// @brief              Compute union of multi-polygon with multi-polygon
+        ///
+        /// @param              [in] aMultiPolygon A multi-polygon
         /// @return             A multi-polygon
 
         MultiPolygon            unionWith                                   (   const   MultiPolygon&               aMultiPolygon                               ) const ;
 
+        /// @brief              Compute difference of multi-polygon with multi-polygon
+        ///
+        ///                     Returns the parts of this multi-polygon that lie outside of the other one.
+        ///
+        /// @param              [in] aMultiPolygon A multi-polygon
+        /// @return             A multi-polygon, undefined if multi-polygon is covered by the other one
+
+        MultiPolygon            differenceWith                              (   const   MultiPolygon&               aMultiPolygon                               ) const ;
+
+        /// @brief              Compute symmetric difference of multi-polygon with multi-polygon
+        ///
+        ///                     Returns the parts of either multi-polygon that lie outside of the other one.
+        ///
+        /// @param              [in] aMultiPolygon A multi-polygon
+        /// @return             A multi-polygon, undefined if multi-polygons are equal
+
+        MultiPolygon            symmetricDifferenceWith                     (   const   MultiPolygon&               aMultiPolygon                               ) const ;
+
+        /// @brief              Clip polygons by multi-polygon
+        ///
+        ///                     Intersects each polygon with this multi-polygon, used as a clipper. The clipper is prepared once:
+        ///                     its polygon index (see buildIndex) is built on first call and kept for the next ones,
+        ///                     so that polygons only get intersected with the clipper polygons their bounding box overlaps,
+        ///                     and polygons away from the clipper are rejected without any boolean operation.
+        ///
+        /// @code
+        ///                     MultiPolygon areaOfInterest = ... ;
+        ///                     Array<Polygon> footprints = ... ;
+        ///                     Array<MultiPolygon> clippedFootprints = areaOfInterest.clip(footprints) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPolygonArray An array of polygons
+        /// @return             Array of clipped polygons, in the same order. Polygons outside of the clipper give undefined multi-polygons.
+
+        Array<MultiPolygon>     clip                                        (   const   Array<Polygon2d>&           aPolygonArray                               ) const ;
+
+        /// @brief              Simplify multi-polygon
+        ///
+        ///                     Simplifies the rings of all polygons together, see LineString::simplify.
+        ///                     With topology preservation, rings neither cross themselves nor each other, across polygons as well.
+        ///
+        /// @param              [in] aTolerance A tolerance (distance)
+        /// @param              [in] (optional) aMethod A simplification method
+        /// @param              [in] (optional) preserveTopology If true, preserve topology
+        /// @return             Simplified multi-polygon
+
+        MultiPolygon            simplify                                    (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod                               =   LineString::SimplificationMethod::DouglasPeucker,
+                                                                                        bool                        preserveTopology                            =   false ) const ;
+
         /// @brief              Get string representation
         ///
         /// @param              [in] aFormat A format
@@ -216,12 +311,36 @@ class MultiPolygon : public Object
 
         static MultiPolygon     Polygon                                     (   const   Polygon2d&                  aPolygon                                    ) ;
 
+        /// @brief              Constructs a multi-polygon as the union of polygons
+        ///
+        ///                     Polygons are sorted along a space-filling curve, then merged pairwise up a balanced tree,
+        ///                     so that each union only involves neighbouring geometries of similar size.
+        ///                     Subtrees are merged in parallel.
+        ///
+        /// @code
+        ///                     Array<Polygon> footprints = ... ;
+        ///                     MultiPolygon coverage = MultiPolygon::Union(footprints) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPolygonArray An array of polygons
+        /// @return             Multi-polygon, undefined if the array is empty
+
+        static MultiPolygon     Union                                       (   const   Array<Polygon2d>&           aPolygonArray                               ) ;
+
     private:
 
         class Impl ;
 
         Unique<MultiPolygon::Impl> implUPtr_ ;
 
+        mutable Shared<const PolygonIndex> indexSPtr_ ;
+        mutable Shared<const Array<Polygon2d>> polygonsSPtr_ ;
+        mutable std::mutex      indexMutex_ ;
+
+        Shared<const PolygonIndex> accessIndex                              (           bool                        aForce                                      ) const ;
+
+        Shared<const Array<Polygon2d>> accessPolygons                       ( ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -15,12 +15,16 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/PointSet.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 #include <OpenSpaceToolkit/Core/Types/Unique.hpp>
 
+#include <mutex>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -40,11 +44,14 @@ class MultiPolygon ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Shared ;
 using ostk::core::types::Unique ;
 using ostk::core::ctnr::Index ;
 using ostk::core::ctnr::Size ;
 using ostk::core::ctnr::Array ;
 
+using ostk::math::obj::VectorXb ;
+using ostk::math::obj::Matrix2Xd ;
 using ostk::math::geom::d2::Object ;
 using ostk::math::geom::d2::objects::Point ;
 using ostk::math::geom::d2::objects::Segment ;
@@ -158,6 +165,9 @@ class Polygon : public Object
         ///                     polygon.contains(point) ;
         /// @endcode
         ///
+        ///                     Points on the boundary are contained.
+        ///                     Polygons with many edges are tested through an edge index, built on first query.
+        ///
         /// @param              [in] aPoint A point
         /// @return             True if polygon contains point
 
@@ -176,6 +186,37 @@ class Polygon : public Object
 
         bool                    contains                                    (   const   PointSet&                   aPointSet                                   ) const ;
 
+        /// @brief              Check which points of an array are contained in polygon
+        ///
+        ///                     Point i is given by aPointArray.col(i). Points on the boundary are contained.
+        ///                     Points are tested directly through the edge index (see buildIndex), which is built if needed.
+        ///
+        /// @code
+        ///                     Polygon polygon = ... ;
+        ///                     Matrix2Xd points = ... ;
+        ///                     VectorXb mask = polygon.containsPoints(points) ; // mask(i) is true if point i is contained
+        /// @endcode
+        ///
+        /// @param              [in] aPointArray A 2xN array of points
+        /// @return             Containment mask, of size N
+
+        VectorXb                containsPoints                              (   const   Matrix2Xd&                  aPointArray                                 ) const ;
+
+        /// @brief              Build edge index
+        ///
+        ///                     The index brings point containment down to O(log n + k), k being the number of edges crossing
+        ///                     the horizontal line through the point (typically a handful, even for large country outlines).
+        ///                     It is otherwise built on first query, for polygons with enough edges to benefit from it.
+        ///                     It is shared between copies, and discarded when the polygon is transformed.
+        ///
+        /// @code
+        ///                     Polygon polygon = ... ;
+        ///                     polygon.buildIndex() ;
+        ///                     polygon.contains(pointSet) ;
+        /// @endcode
+
+        void                    buildIndex                                  ( ) const ;
+
         /// @brief              Get number of inner rings
         ///
         /// @return             Number of inner rings
@@ -243,9 +284,9 @@ class Polygon : public Object
         /// @brief              Compute intersection of polygon with polygon
         ///
         /// @param              [in] aPolygon A polygon
-        /// @return             Intersection of polygon with polygon
+        /// @return             A multi-polygon, undefined if polygons do not overlap
 
-        // Intersection            intersectionWith                            (   const   Polygon&                    aPolygon                                    ) const ;
+        MultiPolygon            intersectionWith                            (   const   Polygon&                    aPolygon                                    ) const ;
 
         /// @brief              Compute union of polygon with polygon
         ///
@@ -254,6 +295,41 @@ class Polygon : public Object
 
         MultiPolygon            unionWith                                   (   const   Polygon&                    aPolygon                                    ) const ;
 
+        /// @brief              Compute difference of polygon with polygon
+        ///
+        ///                     Returns the parts of this polygon that lie outside of the other one.
+        ///
+        /// @param              [in] aPolygon A polygon
+        /// @return             A multi-polygon, undefined if polygon is covered by the other one
+
+        MultiPolygon            differenceWith                              (   const   Polygon&                    aPolygon                                    ) const ;
+
+        /// @brief              Compute symmetric difference of polygon with polygon
+        ///
+        /// @param              [in] aPolygon A polygon
+        /// @return             A multi-polygon, undefined if polygons are equal
+
+        MultiPolygon            symmetricDifferenceWith                     (   const   Polygon&                    aPolygon                                    ) const ;
+
+        /// @brief              Simplify polygon
+        ///
+        ///                     Simplifies the outer and inner rings of the polygon, see LineString::simplify.
+        ///                     With topology preservation, rings neither cross themselves nor each other.
+        ///
+        /// @code
+        ///                     Polygon polygon = ... ;
+        ///                     Polygon simplifiedPolygon = polygon.simplify(1e-3, LineString::SimplificationMethod::Visvalingam, true) ;
+        /// @endcode
+        ///
+        /// @param              [in] aTolerance A tolerance (distance)
+        /// @param              [in] (optional) aMethod A simplification method
+        /// @param              [in] (optional) preserveTopology If true, preserve topology
+        /// @return             Simplified polygon
+
+        Polygon                 simplify                                    (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod                               =   LineString::SimplificationMethod::DouglasPeucker,
+                                                                                        bool                        preserveTopology                            =   false ) const ;
+
         /// @brief              Get string representation
         ///
         /// @param              [in] aFormat A format
@@ -289,9 +365,15 @@ class Polygon : public Object
     private:
 
         class Impl ;
+        class EdgeIndex ;
 
         Unique<Polygon::Impl>   implUPtr_ ;
 
+        mutable Shared<const Polygon::EdgeIndex> indexSPtr_ ;
+        mutable std::mutex      indexMutex_ ;
+
+        Shared<const Polygon::EdgeIndex> accessIndex                        (           bool                        aForce                                      ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,236 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex__
+#define __OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Unique.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d2
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Unique ;
+using ostk::core::types::Index ;
+using ostk::core::types::Size ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::obj::VectorXb ;
+using ostk::math::obj::Matrix2Xd ;
+using ostk::math::geom::d2::objects::Point ;
+using ostk::math::geom::d2::objects::Polygon ;
+using ostk::math::geom::d2::objects::MultiPolygon ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Polygon index
+///
+///                             Collection of polygons (coverage cells, geofences, regions...), indexed by an R-tree over their bounding boxes,
+///                             so that point location and overlap queries only test the few polygons they may actually touch.
+///
+///                             The tree is bulk loaded on construction. Polygons added afterwards are inserted into it.
+///
+/// @code
+///                     Array<Polygon> polygons = ... ;
+///                     PolygonIndex polygonIndex = PolygonIndex(polygons) ;
+///                     Array<Index> polygonIndices = polygonIndex.getPolygonIndicesContaining({ 0.5, 0.5 }) ;
+///                     for (const auto& index : polygonIndices) { polygonIndex.accessPolygonAt(index) ; }
+/// @endcode
+
+class PolygonIndex
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aPolygonArray An array of polygons
+
+        explicit                PolygonIndex                                (   const   Array<Polygon>&             aPolygonArray                               ) ;
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aMultiPolygon A multi-polygon
+
+        explicit                PolygonIndex                                (   const   MultiPolygon&               aMultiPolygon                               ) ;
+
+        /// @brief              Copy constructor
+        ///
+        /// @param              [in] aPolygonIndex A polygon index
+
+                                PolygonIndex                                (   const   PolygonIndex&               aPolygonIndex                               ) ;
+
+        /// @brief              Move constructor
+        ///
+        /// @param              [in] aPolygonIndex A polygon index
+
+                                PolygonIndex                                (           PolygonIndex&&              aPolygonIndex                               ) ;
+
+        /// @brief              Destructor
+
+                                ~PolygonIndex                               ( ) ;
+
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aPolygonIndex A polygon index
+        /// @return             Reference to polygon index
+
+        PolygonIndex&           operator =                                  (   const   PolygonIndex&               aPolygonIndex                               ) ;
+
+        /// @brief              Move assignment operator
+        ///
+        /// @param              [in] aPolygonIndex A polygon index
+        /// @return             Reference to polygon index
+
+        PolygonIndex&           operator =                                  (           PolygonIndex&&              aPolygonIndex                               ) ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] aPolygonIndex A polygon index
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   PolygonIndex&               aPolygonIndex                               ) ;
+
+        /// @brief              Check if polygon index is empty
+        ///
+        /// @return             True if polygon index is empty
+
+        bool                    isEmpty                                     ( ) const ;
+
+        /// @brief              Check if any polygon contains point
+        ///
+        ///                     Stops at the first polygon found containing the point.
+        ///
+        /// @param              [in] aPoint A point
+        /// @return             True if any polygon contains point
+
+        bool                    contains                                    (   const   Point&                      aPoint                                      ) const ;
+
+        /// @brief              Check which points of an array are contained in any polygon
+        ///
+        ///                     Point i is given by aPointArray.col(i). Candidate polygons are selected through the tree, then each candidate
+        ///                     tests the points falling in its bounding box in a single batch (see Polygon::containsPoints).
+        ///
+        /// @param              [in] aPointArray A 2xN array of points
+        /// @return             Containment mask, of size N
+
+        VectorXb                containsPoints                              (   const   Matrix2Xd&                  aPointArray                                 ) const ;
+
+        /// @brief              Access polygon at index
+        ///
+        /// @param              [in] anIndex An index
+        /// @return             Reference to polygon
+
+        const Polygon&          accessPolygonAt                             (   const   Index&                      anIndex                                     ) const ;
+
+        /// @brief              Get number of polygons
+        ///
+        /// @return             Number of polygons
+
+        Size                    getPolygonCount                             ( ) const ;
+
+        /// @brief              Get indices of polygons containing point
+        ///
+        ///                     Points on the boundary of a polygon are contained in it.
+        ///
+        /// @code
+        ///                     PolygonIndex polygonIndex = ... ;
+        ///                     Array<Index> polygonIndices = polygonIndex.getPolygonIndicesContaining({ 0.5, 0.5 }) ;
+        /// @endcode
+        ///
+        /// @param              [in] aPoint A point
+        /// @return             Array of polygon indices, in increasing order
+
+        Array<Index>            getPolygonIndicesContaining                 (   const   Point&                      aPoint                                      ) const ;
+
+        /// @brief              Get indices of polygons overlapping box
+        ///
+        ///                     Polygons overlap the box when their bounding boxes intersect it.
+        ///
+        /// @param              [in] aMinimum A point, lower corner of the box
+        /// @param              [in] aMaximum A point, upper corner of the box
+        /// @return             Array of polygon indices, in increasing order
+
+        Array<Index>            getPolygonIndicesOverlappingBox             (   const   Point&                      aMinimum,
+                                                                                const   Point&                      aMaximum                                    ) const ;
+
+        /// @brief              Get indices of polygons overlapping another polygon
+        ///
+        ///                     Polygons overlap when their bounding boxes intersect. This is a conservative test,
+        ///                     meant to select the candidates of an exact query (e.g. Polygon::intersects).
+        ///
+        /// @param              [in] aPolygon A polygon
+        /// @return             Array of polygon indices, in increasing order
+
+        Array<Index>            getPolygonIndicesOverlapping                (   const   Polygon&                    aPolygon                                    ) const ;
+
+        /// @brief              Add polygon to index
+        ///
+        /// @param              [in] aPolygon A polygon
+        /// @return             Index of added polygon
+
+        Index                   addPolygon                                  (   const   Polygon&                    aPolygon                                    ) ;
+
+        /// @brief              Print polygon index
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           =   true ) const ;
+
+        /// @brief              Constructs an empty polygon index
+        ///
+        /// @return             Empty polygon index
+
+        static PolygonIndex     Empty                                       ( ) ;
+
+    private:
+
+        class Tree ;
+
+        Array<Polygon>          polygons_ ;
+
+        Unique<PolygonIndex::Tree> treeUPtr_ ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
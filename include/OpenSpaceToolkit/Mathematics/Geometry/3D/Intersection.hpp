@@ -33,6 +33,12 @@
 #include <OpenSpaceToolkit/Core/Types/Unique.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
+#include <memory_resource>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -57,6 +63,9 @@ using ostk::math::geom::d3::objects::Composite ;
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief                      3D intersection
+///
+///                             Empty, point, two-point, line, ray and segment intersections are stored in place,
+///                             and do not allocate. Their composite is only built when it is accessed.
 
 class Intersection
 {
@@ -96,6 +105,12 @@ class Intersection
 
                                 Intersection                                (   const   Intersection&               anIntersection                              ) ;
 
+        /// @brief              Move constructor
+        ///
+        /// @param              [in] anIntersection An intersection
+
+                                Intersection                                (           Intersection&&              anIntersection                              ) ;
+
         /// @brief              Destructor
 
                                 ~Intersection                               ( ) ;
@@ -107,6 +122,13 @@ class Intersection
 
         Intersection&           operator =                                  (   const   Intersection&               anIntersection                              ) ;
 
+        /// @brief              Move assignment operator
+        ///
+        /// @param              [in] anIntersection An intersection
+        /// @return             Reference to intersection
+
+        Intersection&           operator =                                  (           Intersection&&              anIntersection                              ) ;
+
         /// @brief              Equal to operator
         ///
         /// @param              [in] anIntersection An intersection
@@ -124,6 +146,8 @@ class Intersection
         /// @brief              Addition operator (intersection concatenation)
         ///
         ///                     Concatenate (merge) intersection with another intersection.
+        ///                     Objects are allocated from the memory resource of this intersection, if it was constructed with one,
+        ///                     and from the global heap otherwise.
         ///
         /// @param              [in] anIntersection An intersection
         /// @return             Concatenated intersection
@@ -187,6 +211,31 @@ class Intersection
                 throw ostk::core::error::runtime::Undefined("Intersection") ;
             }
 
+            if (std::holds_alternative<objects::Point>(object_))
+            {
+                return std::is_base_of<Type, objects::Point>::value ;
+            }
+
+            if (std::holds_alternative<std::pair<objects::Point, objects::Point>>(object_))
+            {
+                return std::is_base_of<Type, objects::PointSet>::value ;
+            }
+
+            if (std::holds_alternative<objects::Line>(object_))
+            {
+                return std::is_base_of<Type, objects::Line>::value ;
+            }
+
+            if (std::holds_alternative<objects::Ray>(object_))
+            {
+                return std::is_base_of<Type, objects::Ray>::value ;
+            }
+
+            if (std::holds_alternative<objects::Segment>(object_))
+            {
+                return std::is_base_of<Type, objects::Segment>::value ;
+            }
+
             return composite_.is<Type>() ;
 
         }
@@ -206,7 +255,47 @@ class Intersection
                 throw ostk::core::error::runtime::Undefined("Intersection") ;
             }
 
-            return composite_.as<Type>() ;
+            if constexpr (std::is_base_of<Type, objects::Point>::value)
+            {
+
+                if (const objects::Point* pointPtr = std::get_if<objects::Point>(&object_))
+                {
+                    return *pointPtr ;
+                }
+
+            }
+
+            if constexpr (std::is_base_of<Type, objects::Line>::value)
+            {
+
+                if (const objects::Line* linePtr = std::get_if<objects::Line>(&object_))
+                {
+                    return *linePtr ;
+                }
+
+            }
+
+            if constexpr (std::is_base_of<Type, objects::Ray>::value)
+            {
+
+                if (const objects::Ray* rayPtr = std::get_if<objects::Ray>(&object_))
+                {
+                    return *rayPtr ;
+                }
+
+            }
+
+            if constexpr (std::is_base_of<Type, objects::Segment>::value)
+            {
+
+                if (const objects::Segment* segmentPtr = std::get_if<objects::Segment>(&object_))
+                {
+                    return *segmentPtr ;
+                }
+
+            }
+
+            return this->accessComposite().as<Type>() ;
 
         }
 
@@ -216,6 +305,15 @@ class Intersection
 
         const Composite&        accessComposite                             ( ) const ;
 
+        /// @brief              Access the points of a two-point intersection
+        ///
+        ///                     Only valid for point set intersections of two points, which are stored in place.
+        ///                     Points are returned in the order they were given to Intersection::PointSet.
+        ///
+        /// @return             Reference to pair of points
+
+        const std::pair<objects::Point, objects::Point>& accessPoints       ( ) const ;
+
         /// @brief              Get intersection type
         ///
         /// @return             Intersection type
@@ -258,9 +356,25 @@ class Intersection
         ///                     Intersection intersection = Intersection::PointSet({ Point(0.0, 0.0, 0.0), Point(1.0, 0.0, 0.0) }) ;
         /// @endcode
         ///
+        /// @param              [in] aPointSet A point set
+        /// @param              [in] (optional) aMemoryResource A pointer to memory resource, used if the point set is stored in a composite
+        /// @return             Point set intersection
+
+        static Intersection     PointSet                                    (   const   objects::PointSet&          aPointSet,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             =   nullptr ) ;
+
+        /// @brief              Constructs a two-point point set intersection
+        ///
+        /// @code
+        ///                     Intersection intersection = Intersection::PointSet(Point(0.0, 0.0, 0.0), Point(1.0, 0.0, 0.0)) ;
+        /// @endcode
+        ///
+        /// @param              [in] aFirstPoint A first point
+        /// @param              [in] aSecondPoint A second point
         /// @return             Point set intersection
 
-        static Intersection     PointSet                                    (   const   objects::PointSet&          aPointSet                                   ) ;
+        static Intersection     PointSet                                    (   const   objects::Point&             aFirstPoint,
+                                                                                const   objects::Point&             aSecondPoint                                ) ;
 
         /// @brief              Constructs a line string intersection
         ///
@@ -268,9 +382,12 @@ class Intersection
         ///                     Intersection intersection = Intersection::LineString({ Point(0.0, 0.0, 0.0), Point(1.0, 0.0, 0.0), Point(1.0, 0.0, 1.0) }) ;
         /// @endcode
         ///
+        /// @param              [in] aLineString A line string
+        /// @param              [in] (optional) aMemoryResource A pointer to memory resource
         /// @return             Line string intersection
 
-        static Intersection     LineString                                  (   const   objects::LineString&        aLineString                                 ) ;
+        static Intersection     LineString                                  (   const   objects::LineString&        aLineString,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             =   nullptr ) ;
 
         /// @brief              Constructs a line intersection
         ///
@@ -310,18 +427,25 @@ class Intersection
 
     private:
 
+        typedef                 std::variant<std::monostate, objects::Point, std::pair<objects::Point, objects::Point>, objects::Line, objects::Ray, objects::Segment> InPlaceObject ;
+
         Intersection::Type      type_ ;
 
-        Composite               composite_ ;
+        InPlaceObject           object_ ;
+
+        mutable Composite       composite_ ;
+        mutable std::mutex      compositeMutex_ ;
 
                                 Intersection                                ( ) ;
 
                                 Intersection                                (   const   Intersection::Type&         aType,
                                                                                 const   Array<Unique<Object>>&      anObjectArray                               ) ;
 
-        static Intersection::Type TypeFromObjects                           (   const   Array<Unique<Object>>&      anObjectArray                               ) ;
+        static Composite        CompositeFromObject                         (   const   InPlaceObject&              anInPlaceObject                             ) ;
+
+        static Intersection::Type TypeFromObjects                           (   const   Array<Object::Pointer>&     anObjectArray                               ) ;
 
-        static Intersection::Type TypeFromObject                            (   const   Unique<Object>&             anObjectUPtr                                ) ;
+        static Intersection::Type TypeFromObject                            (   const   Object&                     anObject                                    ) ;
 
 } ;
 
@@ -14,6 +14,10 @@
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
+#include <memory_resource>
+#include <memory>
+#include <cstddef>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -30,6 +34,12 @@ namespace d3
 class Transformation ;
 class Intersection ;
 
+namespace objects
+{
+class Cuboid ;
+class Sphere ;
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief                      3D object
@@ -39,6 +49,77 @@ class Object
 
     public:
 
+        /// @brief              Object type
+        ///
+        ///                     Concrete objects report their type through getType, which lets generic queries
+        ///                     between two objects resolve the underlying types without RTTI.
+
+        enum class Type
+        {
+
+            Undefined,
+            Point,
+            PointSet,
+            Line,
+            Ray,
+            Segment,
+            LineString,
+            Polygon,
+            Plane,
+            Cuboid,
+            Sphere,
+            Ellipsoid,
+            Pyramid,
+            Cone,
+            Composite
+
+        } ;
+
+        /// @brief              Object deleter
+        ///
+        ///                     Destroys an object, then returns its storage to the memory resource it was allocated from (see Object::Clone),
+        ///                     or to the global heap if there is none.
+
+        class Deleter
+        {
+
+            public:
+
+                /// @brief      Default constructor (global heap)
+
+                                Deleter                                     ( ) ;
+
+                /// @brief      Constructor
+                ///
+                /// @param      [in] aMemoryResource A pointer to memory resource
+                /// @param      [in] aSize A size in bytes of the object storage
+
+                                Deleter                                     (           std::pmr::memory_resource*  aMemoryResource,
+                                                                                const   std::size_t                 aSize                                       ) ;
+
+                /// @brief      Delete object
+                ///
+                /// @param      [in] anObjectPtr A pointer to object
+
+                void            operator ()                                 (           Object*                     anObjectPtr                                 ) const ;
+
+                /// @brief      Get memory resource
+                ///
+                /// @return     Pointer to memory resource (nullptr if global heap)
+
+                std::pmr::memory_resource* getMemoryResource                ( ) const ;
+
+            private:
+
+                std::pmr::memory_resource* memoryResourcePtr_ ;
+                std::size_t     size_ ;
+
+        } ;
+
+        /// @brief              Unique pointer to object, owning the memory resource of its storage
+
+        typedef                 std::unique_ptr<Object, Object::Deleter>        Pointer ;
+
         /// @brief              Default constructor (default)
 
                                 Object                                      ( ) = default ;
@@ -82,6 +163,12 @@ class Object
 
         virtual bool            isDefined                                   ( ) const = 0 ;
 
+        /// @brief              Get object type (pure virtual)
+        ///
+        /// @return             Object type
+
+        virtual Object::Type    getType                                     ( ) const = 0 ;
+
         /// @brief              Returns true if object can be converted to type
         ///
         /// @return             True if object can be converted to type
@@ -150,6 +237,39 @@ class Object
 
         virtual Intersection    intersectionWith                            (   const   Object&                     anObject                                    ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        ///                     Smallest cuboid aligned with the frame axes that contains the object. As in the cuboid intersection
+        ///                     queries, the extents of the returned cuboid are half-lengths along its axes.
+        ///
+        /// @code
+        ///                     Unique<Object> objectUPtr = ... ;
+        ///                     Cuboid boundingBox = objectUPtr->getBoundingBox() ;
+        /// @endcode
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual objects::Cuboid getBoundingBox                              ( ) const ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        ///                     Cuboid of arbitrary orientation that contains the object. It follows the object's own axes when it has some
+        ///                     (cuboids, ellipsoids, segments), is the minimum-area rectangle of planar polygons, and otherwise the smaller of
+        ///                     a principal axes fit of the vertices and of the axis-aligned bounding box.
+        ///
+        /// @return             Oriented bounding box
+
+        virtual objects::Cuboid getOrientedBoundingBox                      ( ) const ;
+
+        /// @brief              Get bounding sphere
+        ///
+        ///                     Sphere that contains the object. It is exact for spheres, cuboids and ellipsoids, and within a few
+        ///                     percent of the minimal sphere for objects defined by their vertices.
+        ///
+        /// @return             Bounding sphere
+
+        virtual objects::Sphere getBoundingSphere                           ( ) const ;
+
         /// @brief              Print object
         ///
         /// @param              [in] anOutputStream An output stream
@@ -164,6 +284,24 @@ class Object
 
         virtual void            applyTransformation                         (   const   Transformation&             aTransformation                             ) = 0 ;
 
+        /// @brief              Clone object into memory resource
+        ///
+        ///                     The clone is allocated from the given memory resource, which must outlive it, and returns its storage there on deletion.
+        ///                     A null memory resource allocates the clone from the global heap.
+        ///                     Composites are cloned by copy, their objects are therefore allocated from the global heap (see Composite).
+        ///
+        /// @code
+        ///                     std::pmr::monotonic_buffer_resource arena ;
+        ///                     Object::Pointer objectPtr = Object::Clone(Point(1.0, 2.0, 3.0), &arena) ;
+        /// @endcode
+        ///
+        /// @param              [in] anObject An object
+        /// @param              [in] aMemoryResource A pointer to memory resource
+        /// @return             Pointer to cloned object
+
+        static Object::Pointer  Clone                                       (   const   Object&                     anObject,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -18,6 +18,8 @@
 #include <OpenSpaceToolkit/Core/Types/Unique.hpp>
 #include <OpenSpaceToolkit/Core/Error.hpp>
 
+#include <memory_resource>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -49,32 +51,50 @@ class Composite : public Object
 
     public:
 
-        typedef                 Array<Unique<Object>>::ConstIterator            ConstIterator ;
+        typedef                 Array<Object::Pointer>::ConstIterator           ConstIterator ;
 
         /// @brief              Constructor
         ///
+        ///                     When a memory resource is given, the composite allocates its objects from it, now and on later
+        ///                     concatenations (see Object::Clone). The memory resource must outlive these objects.
+        ///                     Otherwise, objects are allocated from the global heap.
+        ///
         /// @param              [in] anObject An object
+        /// @param              [in] (optional) aMemoryResource A pointer to memory resource
 
-        explicit                Composite                                   (   const   Object&                     anObject                                    ) ;
+        explicit                Composite                                   (   const   Object&                     anObject,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             =   nullptr ) ;
 
         /// @brief              Constructor
         ///
         /// @param              [in] anObjectUPtr A unique pointer to object
+        /// @param              [in] (optional) aMemoryResource A pointer to memory resource
 
-        explicit                Composite                                   (   const   Unique<Object>&             anObjectUPtr                                ) ;
+        explicit                Composite                                   (   const   Unique<Object>&             anObjectUPtr,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             =   nullptr ) ;
 
         /// @brief              Constructor
         ///
+        ///                     Takes ownership of the objects in the array.
+        ///
         /// @param              [in] anObjectArray An array of unique pointers to object
 
         explicit                Composite                                   (           Array<Unique<Object>>&&     anObjectArray                               ) ;
 
         /// @brief              Copy constructor
         ///
+        ///                     As with standard allocator-aware containers, the copy does not inherit the memory resource of the original.
+        ///
         /// @param              [in] aComposite A composite
 
                                 Composite                                   (   const   Composite&                  aComposite                                  ) ;
 
+        /// @brief              Move constructor
+        ///
+        /// @param              [in] aComposite A composite
+
+                                Composite                                   (           Composite&&                 aComposite                                  ) ;
+
         /// @brief              Clone composite
         ///
         /// @return             Pointer to cloned composite
@@ -88,6 +108,13 @@ class Composite : public Object
 
         Composite&              operator =                                  (   const   Composite&                  aComposite                                  ) ;
 
+        /// @brief              Move assignment operator
+        ///
+        /// @param              [in] aComposite A composite
+        /// @return             Reference to composite
+
+        Composite&              operator =                                  (           Composite&&                 aComposite                                  ) ;
+
         /// @brief              Equal to operator
         ///
         /// @param              [in] aComposite A composite object
@@ -105,6 +132,7 @@ class Composite : public Object
         /// @brief              Addition operator (composite concatenation)
         ///
         ///                     Concatenate (merge) composite with another composite.
+        ///                     The concatenated composite allocates its objects from the memory resource of this composite.
         ///
         /// @param              [in] aComposite A composite
         /// @return             Concatenated composite
@@ -130,6 +158,12 @@ class Composite : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Composite
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if composite is empty
         ///
         /// @code
@@ -229,7 +263,7 @@ class Composite : public Object
         ///
         /// @return             Reference to objects in composite
 
-        const Array<Unique<Object>>& accessObjects                          ( ) const ;
+        const Array<Object::Pointer>& accessObjects                         ( ) const ;
 
         /// @brief              Get number of objects in composite
         ///
@@ -263,6 +297,14 @@ class Composite : public Object
 
         Composite::ConstIterator end                                        ( ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        ///                     Union of the bounding boxes of the objects.
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
         /// @brief              Print composite
         ///
         /// @param              [in] anOutputStream An output stream
@@ -300,7 +342,10 @@ class Composite : public Object
     private:
 
         bool                    defined_ ;
-        Array<Unique<Object>>   objects_ ;
+        Array<Object::Pointer>  objects_ ;
+        std::pmr::memory_resource* memoryResourcePtr_ ;
+
+        void                    appendClonesOf                              (   const   Array<Object::Pointer>&     anObjectArray                               ) ;
 
 } ;
 
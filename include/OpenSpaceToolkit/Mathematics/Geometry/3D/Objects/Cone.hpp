@@ -15,9 +15,13 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 
+#include <cstddef>
+#include <iterator>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -33,11 +37,14 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Real ;
 using ostk::core::ctnr::Index ;
 using ostk::core::ctnr::Size ;
 using ostk::core::ctnr::Array ;
 
 using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3d ;
+using ostk::math::obj::Matrix3Xd ;
 using ostk::math::geom::Angle ;
 using ostk::math::geom::d3::Object ;
 using ostk::math::geom::d3::objects::Point ;
@@ -66,6 +73,75 @@ class Cone : public Object
 
     public:
 
+        /// @brief              Lazy range of rays of lateral surface
+        ///
+        ///                     Rays are generated on the fly, in the same order as getRaysOfLateralSurface, without allocation.
+        ///                     Consecutive directions are obtained by applying a fixed rotation about the cone axis.
+
+        class LateralRays
+        {
+
+            public:
+
+                class ConstIterator
+                {
+
+                    public:
+
+                        typedef std::forward_iterator_tag iterator_category ;
+                        typedef Ray             value_type ;
+                        typedef std::ptrdiff_t  difference_type ;
+                        typedef const Ray*      pointer ;
+                        typedef Ray             reference ;
+
+                        bool            operator ==                         (   const   ConstIterator&              anIterator                                  ) const ;
+
+                        bool            operator !=                         (   const   ConstIterator&              anIterator                                  ) const ;
+
+                        Ray             operator *                          ( ) const ;
+
+                        ConstIterator&  operator ++                         ( ) ;
+
+                    private:
+
+                        const LateralRays* lateralRaysPtr_ ;
+                        Index           rayIndex_ ;
+                        double          cosine_ ;
+                        double          sine_ ;
+
+                                        ConstIterator                       (   const   LateralRays*                aLateralRaysPtr,
+                                                                                const   Index                       aRayIndex                                   ) ;
+
+                        friend class LateralRays ;
+
+                } ;
+
+                /// @brief      Get number of rays
+                ///
+                /// @return     Number of rays
+
+                Size            getSize                                     ( ) const ;
+
+                ConstIterator   begin                                       ( ) const ;
+
+                ConstIterator   end                                         ( ) const ;
+
+            private:
+
+                Point           apex_ ;
+                Matrix3d        basis_ ;
+                Size            rayCount_ ;
+                double          stepCosine_ ;
+                double          stepSine_ ;
+
+                                LateralRays                                 (   const   Point&                      anApex,
+                                                                                const   Matrix3d&                   aLateralSurfaceBasis,
+                                                                                const   Size                        aRayCount                                   ) ;
+
+                friend class Cone ;
+
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -109,8 +185,16 @@ class Cone : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Cone
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if cone intersects sphere
         ///
+        ///                     The lateral surface is tested analytically, the discretization level is therefore not used.
+        ///
         /// @code
         ///                     Cone cone = ... ;
         ///                     Sphere sphere = ... ;
@@ -118,7 +202,7 @@ class Cone : public Object
         /// @endcode
         ///
         /// @param              [in] aSphere A sphere
-        /// @param              [in] aDiscretizationLevel (optional) The polygonal discretization level
+        /// @param              [in] aDiscretizationLevel (optional) Unused
         /// @return             True if cone intersects sphere
 
         bool                    intersects                                  (   const   Sphere&                     aSphere,
@@ -126,6 +210,9 @@ class Cone : public Object
 
         /// @brief              Check if cone intersects ellipsoid
         ///
+        ///                     The ellipsoid is first tested against its inscribed and circumscribed spheres,
+        ///                     and the discretized lateral rays are only cast when neither test is conclusive.
+        ///
         /// @code
         ///                     Cone cone = ... ;
         ///                     Ellipsoid ellipsoid = ... ;
@@ -164,6 +251,20 @@ class Cone : public Object
 
         Array<Ray>              getRaysOfLateralSurface                     (   const   Size                        aRayCount                                   =   0 ) const ;
 
+        /// @brief              Generate rays of lateral surface
+        ///
+        /// @code
+        ///                     for (const auto& ray : cone.generateRaysOfLateralSurface(40))
+        ///                     {
+        ///                         ...
+        ///                     }
+        /// @endcode
+        ///
+        /// @param              [in] aRayCount A number of rays
+        /// @return             Lazy range of rays
+
+        LateralRays             generateRaysOfLateralSurface                (   const   Size                        aRayCount                                   ) const ;
+
         /// @brief              Compute intersection of cone with sphere
         ///
         /// @param              [in] aSphere A sphere
@@ -177,6 +278,11 @@ class Cone : public Object
 
         /// @brief              Compute intersection of cone with ellipsoid
         ///
+        ///                     The footprint is a polyline through sampled points of the cone-ellipsoid intersection curve:
+        ///                     the level gives the number of lateral generators, equally spaced around the axis, which are cast
+        ///                     as rays against the ellipsoid in a single batch (see Ellipsoid::intersectRays).
+        ///                     The curve between consecutive samples is not solved for.
+        ///
         /// @param              [in] anEllipsoid An ellipsoid
         /// @param              [in] onlyInSight (optional) If true, only return intersection points that are in sight
         /// @param              [in] aDiscretizationLevel (optional) The polygonal discretization level
@@ -186,6 +292,27 @@ class Cone : public Object
                                                                                 const   bool                        onlyInSight                                 =   false,
                                                                                 const   Size                        aDiscretizationLevel                        =   40 ) const ;
 
+        /// @brief              Compute intersection of cone with ellipsoid, with adaptive sampling
+        ///
+        ///                     The footprint is refined by subdivision of the lateral generators until the footprint polyline
+        ///                     turns by at most the angular tolerance at each vertex, up to a maximum subdivision depth.
+        ///                     Generators crossing the ellipsoid limb are always refined, so that the limb is located accurately.
+        ///
+        /// @code
+        ///                     Cone cone = ... ;
+        ///                     Ellipsoid ellipsoid = ... ;
+        ///                     Intersection intersection = cone.intersectionWith(ellipsoid, true, Angle::Degrees(1.0)) ;
+        /// @endcode
+        ///
+        /// @param              [in] anEllipsoid An ellipsoid
+        /// @param              [in] onlyInSight If true, only return intersection points that are in sight
+        /// @param              [in] anAngularTolerance A maximum turning angle between consecutive footprint segments
+        /// @return             Intersection of cone with ellipsoid
+
+        Intersection            intersectionWith                            (   const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance                          ) const ;
+
         /// @brief              Print cone
         ///
         /// @param              [in] anOutputStream An output stream
@@ -212,6 +339,13 @@ class Cone : public Object
         Vector3d                axis_ ;
         Angle                   angle_ ;
 
+        Real                    getDistanceOfLateralSurfaceTo               (   const   Point&                      aPoint                                      ) const ;
+
+        Matrix3d                getLateralSurfaceBasis                      ( ) const ;
+
+        static Vector3d         DirectionOfLateralSurfaceAt                 (   const   Matrix3d&                   aLateralSurfaceBasis,
+                                                                                const   double                      anAngle_rad                                 ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -118,6 +118,12 @@ class Cuboid : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Cuboid
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if cuboid is near another cuboid
         ///
         /// @code
@@ -379,6 +385,24 @@ class Cuboid : public Object
         Intersection            intersectionWith                            (   const   Pyramid&                    aPyramid,
                                                                                 const   bool                        onlyInSight                                 =   false ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Cuboid itself
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Sphere through the cuboid corners
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print cuboid
         ///
         /// @param              [in] anOutputStream An output stream
@@ -414,6 +438,27 @@ class Cuboid : public Object
         static Cuboid           Cube                                        (   const   Point&                      aCenter,
                                                                                 const   Real&                       anExtent                                    ) ;
 
+        /// @brief              Constructs the axis-aligned bounding box of points
+        ///
+        /// @code
+        ///                     Cuboid boundingBox = Cuboid::BoundingBox({ { 0.0, 0.0, 0.0 }, { 2.0, 4.0, 6.0 } }) ; // Center [1.0, 2.0, 3.0], extents 1.0, 2.0, 3.0
+        /// @endcode
+        ///
+        /// @param              [in] aPointArray An array of points
+        /// @return             Axis-aligned bounding box
+
+        static Cuboid           BoundingBox                                 (   const   Array<Point>&               aPointArray                                 ) ;
+
+        /// @brief              Constructs an oriented bounding box of points
+        ///
+        ///                     Fits a box along the principal axes of the points (eigenvectors of their covariance), and keeps it
+        ///                     only if it is smaller than the axis-aligned bounding box.
+        ///
+        /// @param              [in] aPointArray An array of points
+        /// @return             Oriented bounding box
+
+        static Cuboid           OrientedBoundingBox                         (   const   Array<Point>&               aPointArray                                 ) ;
+
     private:
 
         Point                   center_ ;
@@ -33,7 +33,10 @@ namespace objects
 
 using ostk::core::types::Real ;
 
+using ostk::math::obj::VectorXb ;
+using ostk::math::obj::VectorXd ;
 using ostk::math::obj::Matrix3d ;
+using ostk::math::obj::Matrix3Xd ;
 using ostk::math::geom::d3::Object ;
 using ostk::math::geom::d3::objects::Point ;
 using ostk::math::geom::d3::Intersection ;
@@ -47,6 +50,7 @@ class Ray ;
 class Segment ;
 class Plane ;
 class Polygon ;
+class Cuboid ;
 class Sphere ;
 class Pyramid ;
 class Cone ;
@@ -62,6 +66,20 @@ class Ellipsoid : public Object
 
     public:
 
+        /// @brief              Ray batch intersection
+        ///
+        ///                     Ranges are expressed as ray parameters, in units of the corresponding direction norm.
+        ///                     They are NaN for rays that do not intersect the ellipsoid.
+
+        struct RayIntersections
+        {
+
+            VectorXb            hits ;                                      ///< True if ray intersects ellipsoid
+            VectorXd            nearRanges ;                                ///< Ray parameter of first intersection in sight
+            VectorXd            farRanges ;                                 ///< Ray parameter of last intersection
+
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -118,6 +136,12 @@ class Ellipsoid : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Ellipsoid
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if ellipsoid intersects point
         ///
         /// @code
@@ -406,6 +430,47 @@ class Ellipsoid : public Object
         Intersection            intersectionWith                            (   const   Cone&                       aCone,
                                                                                 const   bool                        onlyInSight                                 =   false ) const ;
 
+        /// @brief              Compute intersections of ellipsoid with a batch of rays
+        ///
+        ///                     Ray i starts at anOriginArray.col(i) and points along aDirectionArray.col(i).
+        ///                     The ellipsoid quadric is set up once, and all rays are processed together.
+        ///                     Intersection points are given by origin + range * direction.
+        ///                     Rays with a zero direction are reported as misses.
+        ///
+        /// @code
+        ///                     Ellipsoid ellipsoid = { Point::Origin(), 1.0, 2.0, 3.0 } ;
+        ///                     Matrix3Xd origins = ... ;
+        ///                     Matrix3Xd directions = ... ;
+        ///                     Ellipsoid::RayIntersections intersections = ellipsoid.intersectRays(origins, directions) ;
+        /// @endcode
+        ///
+        /// @param              [in] anOriginArray A 3xN array of ray origins
+        /// @param              [in] aDirectionArray A 3xN array of ray directions
+        /// @param              [in] onlyInSight (optional) If true, far ranges are set to near ranges
+        /// @return             Ray intersections
+
+        RayIntersections        intersectRays                               (   const   Matrix3Xd&                  anOriginArray,
+                                                                                const   Matrix3Xd&                  aDirectionArray,
+                                                                                const   bool                        onlyInSight                                 =   false ) const ;
+
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Box along ellipsoid principal axes
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Sphere of largest principal semi-axis
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print ellipsoid
         ///
         /// @param              [in] anOutputStream An output stream
@@ -440,6 +505,12 @@ class Ellipsoid : public Object
 
         Quaternion              q_ ;
 
+        Matrix3d                axes_ ;                                     // Principal axes, as rows
+        Matrix3d                scaledAxes_ ;                               // Principal axes divided by principal semi-axes, as rows
+        Matrix3d                matrix_ ;                                   // Quadric matrix
+
+        void                    updateQuadric                               ( ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
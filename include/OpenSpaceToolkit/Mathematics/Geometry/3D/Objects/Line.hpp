@@ -104,6 +104,12 @@ class Line : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Line
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if line intersects point
         ///
         /// @code
@@ -14,9 +14,13 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 
+#include <mutex>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -32,7 +36,9 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Shared ;
 using ostk::core::types::Index ;
+using ostk::core::types::Real ;
 using ostk::core::types::Size ;
 using ostk::core::ctnr::Array ;
 
@@ -43,6 +49,8 @@ using ostk::math::geom::d3::objects::Point ;
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class Segment ;
+class Cuboid ;
+class Sphere ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,6 +63,18 @@ class LineString : public Object
 
         typedef                 Array<Point>::ConstIterator                     ConstIterator ;
 
+        /// @brief              Projection of a point onto a line string
+
+        struct Projection
+        {
+
+            Point               point ;                                     ///< Closest point on the line string
+            Index               segmentIndex ;                              ///< Index of the segment holding the closest point (between points segmentIndex and segmentIndex + 1)
+            Real                arcLength ;                                 ///< Arc length from the first point of the line string to the closest point
+            Real                distance ;                                  ///< Distance from the projected point to the closest point
+
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -65,12 +85,27 @@ class LineString : public Object
 
                                 LineString                                  (   const   Array<Point>&               aPointArray                                 ) ;
 
+        /// @brief              Copy constructor
+        ///
+        ///                     The segment index, if built, is shared with the copy.
+        ///
+        /// @param              [in] aLineString A line string
+
+                                LineString                                  (   const   LineString&                 aLineString                                 ) ;
+
         /// @brief              Clone line string
         ///
         /// @return             Pointer to cloned line string
 
         virtual LineString*     clone                                       ( ) const override ;
 
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aLineString A line string
+        /// @return             Reference to line string
+
+        LineString&             operator =                                  (   const   LineString&                 aLineString                                 ) ;
+
         /// @brief              Equal to operator
         ///
         /// @param              [in] aLineString A line string
@@ -95,6 +130,12 @@ class LineString : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::LineString
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if line string is empty
         ///
         /// @code
@@ -138,6 +179,52 @@ class LineString : public Object
 
         Point                   getPointClosestTo                           (   const   Point&                      aPoint                                      ) const ;
 
+        /// @brief              Project point onto line string
+        ///
+        ///                     Finds the closest point over all segments of the line string (not only its vertices).
+        ///                     Long line strings are searched through a hierarchy of segment bounding boxes, built on first query.
+        ///
+        /// @code
+        ///                     LineString({ { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 } }).getProjectionOf({ 1.0, 1.0, 0.0 }) ; // { [1.0, 0.0, 0.0], 0, 1.0, 1.0 }
+        /// @endcode
+        ///
+        /// @param              [in] aPoint A point
+        /// @return             Projection of point onto line string
+
+        LineString::Projection  getProjectionOf                             (   const   Point&                      aPoint                                      ) const ;
+
+        /// @brief              Build segment index
+        ///
+        ///                     The index brings projections down to O(log n) on average.
+        ///                     It is otherwise built on first projection, for line strings long enough to benefit from it.
+        ///                     It is shared between copies, and discarded when the line string is transformed.
+
+        void                    buildIndex                                  ( ) const ;
+
+        /// @brief              Get axis-aligned bounding box
+        ///
+        ///                     Computed once and cached until the line string is transformed.
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        ///                     Computed once and cached until the line string is transformed.
+        ///
+        /// @return             Oriented bounding box
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        ///                     Computed once and cached until the line string is transformed.
+        ///
+        /// @return             Bounding sphere
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print point
         ///
         /// @param              [in] anOutputStream An output stream
@@ -187,8 +274,18 @@ class LineString : public Object
 
     private:
 
+        class SegmentTree ;
+
         Array<Point>            points_ ;
 
+        mutable Shared<const LineString::SegmentTree> indexSPtr_ ;
+        mutable Shared<const Cuboid> boundingBoxSPtr_ ;
+        mutable Shared<const Cuboid> orientedBoundingBoxSPtr_ ;
+        mutable Shared<const Sphere> boundingSphereSPtr_ ;
+        mutable std::mutex      indexMutex_ ;
+
+        Shared<const LineString::SegmentTree> accessIndex                   (           bool                        aForce                                      ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
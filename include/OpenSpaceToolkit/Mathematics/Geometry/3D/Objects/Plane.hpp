@@ -104,6 +104,12 @@ class Plane : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Plane
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if plane intersects point
         ///
         /// @code
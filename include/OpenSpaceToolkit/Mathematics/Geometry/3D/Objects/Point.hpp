@@ -127,6 +127,12 @@ class Point : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Point
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if point is near another point
         ///
         /// @code
@@ -190,6 +196,24 @@ class Point : public Object
 
         String                  toString                                    (   const   Integer&                    aPrecision                                  =   Integer::Undefined() ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Degenerate box at point
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Degenerate box at point
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Sphere of null radius at point
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print point
         ///
         /// @param              [in] anOutputStream An output stream
@@ -14,10 +14,13 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 
 #include <unordered_set>
+#include <mutex>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -34,7 +37,9 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Shared ;
 using ostk::core::types::Index ;
+using ostk::core::types::Real ;
 using ostk::core::types::Size ;
 using ostk::core::ctnr::Array ;
 
@@ -91,12 +96,27 @@ class PointSet : public Object
 
                                 PointSet                                    (   const   Array<Point>&               aPointArray                                 ) ;
 
+        /// @brief              Copy constructor
+        ///
+        ///                     The spatial index, if built, is shared with the copy.
+        ///
+        /// @param              [in] aPointSet A point set
+
+                                PointSet                                    (   const   PointSet&                   aPointSet                                   ) ;
+
         /// @brief              Clone point set
         ///
         /// @return             Pointer to cloned point set
 
         virtual PointSet*       clone                                       ( ) const override ;
 
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aPointSet A point set
+        /// @return             Reference to point set
+
+        PointSet&               operator =                                  (   const   PointSet&                   aPointSet                                   ) ;
+
         /// @brief              Equal to operator
         ///
         /// @param              [in] aPointSet A point set
@@ -121,6 +141,12 @@ class PointSet : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::PointSet
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if point set is empty
         ///
         /// @code
@@ -152,11 +178,67 @@ class PointSet : public Object
 
         /// @brief              Get point closest to another point
         ///
+        ///                     Large point sets are searched through a spatial index (k-d tree), built on first query.
+        ///
         /// @param              [in] aPoint A point
         /// @return             Closest point
 
         Point                   getPointClosestTo                           (   const   Point&                      aPoint                                      ) const ;
 
+        /// @brief              Get points closest to another point
+        ///
+        /// @code
+        ///                     PointSet({ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 } }).getPointsClosestTo({ 0.0, 0.0, 0.0 }, 2) ; // [0, 0, 0], [0, 0, 1]
+        /// @endcode
+        ///
+        /// @param              [in] aPoint A point
+        /// @param              [in] aPointCount A number of points
+        /// @return             Array of (at most aPointCount) closest points, sorted by increasing distance
+
+        Array<Point>            getPointsClosestTo                          (   const   Point&                      aPoint,
+                                                                                const   Size&                       aPointCount                                 ) const ;
+
+        /// @brief              Get points within distance of another point
+        ///
+        /// @param              [in] aPoint A point
+        /// @param              [in] aDistance A distance
+        /// @return             Array of points within distance (inclusive), sorted by increasing distance
+
+        Array<Point>            getPointsWithinDistance                     (   const   Point&                      aPoint,
+                                                                                const   Real&                       aDistance                                   ) const ;
+
+        /// @brief              Build spatial index
+        ///
+        ///                     The index accelerates closest point and distance queries to O(log n) on average.
+        ///                     It is otherwise built on first query, for point sets large enough to benefit from it.
+        ///                     It is shared between copies, and discarded when the point set is transformed.
+
+        void                    buildIndex                                  ( ) const ;
+
+        /// @brief              Get axis-aligned bounding box
+        ///
+        ///                     Computed once and cached until the point set is transformed.
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        ///                     Computed once and cached until the point set is transformed.
+        ///
+        /// @return             Oriented bounding box
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        ///                     Computed once and cached until the point set is transformed.
+        ///
+        /// @return             Bounding sphere
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print point
         ///
         /// @param              [in] anOutputStream An output stream
@@ -195,8 +277,18 @@ class PointSet : public Object
 
     private:
 
+        class KdTree ;
+
         PointSet::Container     points_ ;
 
+        mutable Shared<const PointSet::KdTree> indexSPtr_ ;
+        mutable Shared<const Cuboid> boundingBoxSPtr_ ;
+        mutable Shared<const Cuboid> orientedBoundingBoxSPtr_ ;
+        mutable Shared<const Sphere> boundingSphereSPtr_ ;
+        mutable std::mutex      indexMutex_ ;
+
+        Shared<const PointSet::KdTree> accessIndex                          (           bool                        aForce                                      ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
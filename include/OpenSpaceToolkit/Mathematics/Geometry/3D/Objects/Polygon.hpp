@@ -112,6 +112,12 @@ class Polygon : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Polygon
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if polygon is near another polygon
         ///
         /// @param              [in] aPolygon A polygon
@@ -189,6 +195,24 @@ class Polygon : public Object
 
         Array<Polygon::Vertex>  getVertices                                 ( ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Flat box along the minimum-area rectangle of polygon
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Bounding sphere
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print polygon
         ///
         /// @param              [in] anOutputStream An output stream
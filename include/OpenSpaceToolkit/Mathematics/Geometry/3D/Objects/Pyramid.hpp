@@ -14,11 +14,16 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
 
 #include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
 #include <OpenSpaceToolkit/Core/Types/Index.hpp>
 
+#include <cstddef>
+#include <iterator>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -34,10 +39,15 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Real ;
 using ostk::core::ctnr::Index ;
 using ostk::core::ctnr::Size ;
 using ostk::core::ctnr::Array ;
 
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3Xd ;
+using ostk::math::geom::Angle ;
+
 using ostk::math::geom::d3::Object ;
 using ostk::math::geom::d3::objects::Point ;
 using ostk::math::geom::d3::objects::Ray ;
@@ -51,6 +61,7 @@ class Ray ;
 class Segment ;
 class Plane ;
 class Polygon ;
+class Cuboid ;
 class Sphere ;
 class Ellipsoid ;
 
@@ -68,6 +79,86 @@ class Pyramid : public Object
 
     public:
 
+        /// @brief              Lazy range of rays of lateral faces
+        ///
+        ///                     Rays are generated on the fly, face after face.
+        ///                     Each face contributes the same number of rays over the half-open angle from its first edge to its second edge,
+        ///                     so that an edge shared by two faces is generated once. Consecutive directions within a face
+        ///                     are obtained by applying a fixed rotation in the face plane.
+        ///                     The apex and the in-plane basis of each face are copied when the range is generated.
+
+        class LateralRays
+        {
+
+            public:
+
+                class ConstIterator
+                {
+
+                    public:
+
+                        typedef std::forward_iterator_tag iterator_category ;
+                        typedef Ray             value_type ;
+                        typedef std::ptrdiff_t  difference_type ;
+                        typedef const Ray*      pointer ;
+                        typedef Ray             reference ;
+
+                        bool            operator ==                         (   const   ConstIterator&              anIterator                                  ) const ;
+
+                        bool            operator !=                         (   const   ConstIterator&              anIterator                                  ) const ;
+
+                        Ray             operator *                          ( ) const ;
+
+                        ConstIterator&  operator ++                         ( ) ;
+
+                    private:
+
+                        const LateralRays* lateralRaysPtr_ ;
+                        Index           lateralFaceIndex_ ;
+                        Index           rayIndex_ ;
+                        double          cosine_ ;
+                        double          sine_ ;
+
+                                        ConstIterator                       (   const   LateralRays*                aLateralRaysPtr,
+                                                                                const   Index                       aLateralFaceIndex                           ) ;
+
+                        friend class LateralRays ;
+
+                } ;
+
+                /// @brief      Get number of rays
+                ///
+                /// @return     Number of rays
+
+                Size            getSize                                     ( ) const ;
+
+                ConstIterator   begin                                       ( ) const ;
+
+                ConstIterator   end                                         ( ) const ;
+
+            private:
+
+                struct LateralFace
+                {
+
+                    Vector3d    firstDirection ;
+                    Vector3d    inPlaneDirection ;
+                    double      stepCosine ;
+                    double      stepSine ;
+
+                } ;
+
+                Point           apex_ ;
+                Array<LateralFace> lateralFaces_ ;
+                Size            lateralRayCount_ ;
+
+                                LateralRays                                 (   const   Pyramid&                    aPyramid,
+                                                                                const   Size                        aLateralRayCount                            ) ;
+
+                friend class Pyramid ;
+
+        } ;
+
         /// @brief              Constructor
         ///
         /// @code
@@ -108,8 +199,16 @@ class Pyramid : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Pyramid
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if pyramid intersects sphere
         ///
+        ///                     Spheres clear of the pyramid are rejected against the bounding cone of the lateral faces before casting the discretized rays.
+        ///
         /// @code
         ///                     Pyramid pyramid = ... ;
         ///                     Sphere sphere = ... ;
@@ -125,6 +224,8 @@ class Pyramid : public Object
 
         /// @brief              Check if pyramid intersects ellipsoid
         ///
+        ///                     Ellipsoids whose circumscribed sphere is clear of the pyramid are rejected against the bounding cone of the lateral faces before casting the discretized rays.
+        ///
         /// @code
         ///                     Pyramid pyramid = ... ;
         ///                     Ellipsoid ellipsoid = ... ;
@@ -205,6 +306,20 @@ class Pyramid : public Object
 
         Array<Ray>              getRaysOfLateralFaces                       (   const   Size                        aRayCount                                   =   0 ) const ;
 
+        /// @brief              Generate rays of lateral faces
+        ///
+        /// @code
+        ///                     for (const auto& ray : pyramid.generateRaysOfLateralFaces(40))
+        ///                     {
+        ///                         ...
+        ///                     }
+        /// @endcode
+        ///
+        /// @param              [in] aRayCount A number of rays (at least face count)
+        /// @return             Lazy range of rays
+
+        LateralRays             generateRaysOfLateralFaces                  (   const   Size                        aRayCount                                   ) const ;
+
         /// @brief              Compute intersection of pyramid with sphere
         ///
         /// @param              [in] aSphere A sphere
@@ -218,6 +333,11 @@ class Pyramid : public Object
 
         /// @brief              Compute intersection of pyramid with ellipsoid
         ///
+        ///                     The footprint is a polyline through sampled points of the conic sections cut by the lateral face planes on the ellipsoid:
+        ///                     rays are cast from the apex within each face, and intersected with the ellipsoid in a single batch (see Ellipsoid::intersectRays).
+        ///                     Each face contributes the same number of samples, and face edges are sampled only once.
+        ///                     The conic sections between consecutive samples are not solved for.
+        ///
         /// @param              [in] anEllipsoid An ellipsoid
         /// @param              [in] onlyInSight (optional) If true, only return intersection points that are in sight
         /// @param              [in] aDiscretizationLevel (optional) The polygonal discretization level
@@ -227,6 +347,51 @@ class Pyramid : public Object
                                                                                 const   bool                        onlyInSight                                 =   false,
                                                                                 const   Size                        aDiscretizationLevel                        =   40 ) const ;
 
+        /// @brief              Compute intersection of pyramid with ellipsoid, with adaptive sampling
+        ///
+        ///                     Each lateral face is refined by subdivision until the footprint polyline turns by at most the angular tolerance
+        ///                     at each vertex within the face, up to a maximum subdivision depth.
+        ///                     Face corners are always kept, and rays crossing the ellipsoid limb are always refined.
+        ///
+        /// @code
+        ///                     Pyramid pyramid = ... ;
+        ///                     Ellipsoid ellipsoid = ... ;
+        ///                     Intersection intersection = pyramid.intersectionWith(ellipsoid, true, Angle::Degrees(1.0)) ;
+        /// @endcode
+        ///
+        /// @param              [in] anEllipsoid An ellipsoid
+        /// @param              [in] onlyInSight If true, only return intersection points that are in sight
+        /// @param              [in] anAngularTolerance A maximum turning angle between consecutive footprint segments
+        /// @return             Intersection of pyramid with ellipsoid
+
+        Intersection            intersectionWith                            (   const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance                          ) const ;
+
+        /// @brief              Get axis-aligned bounding box
+        ///
+        ///                     The pyramid is bounded by its apex and base.
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        ///                     The pyramid is bounded by its apex and base.
+        ///
+        /// @return             Oriented bounding box
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        ///                     The pyramid is bounded by its apex and base.
+        ///
+        /// @return             Bounding sphere
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print pyramid
         ///
         /// @param              [in] anOutputStream An output stream
@@ -252,6 +417,14 @@ class Pyramid : public Object
         Polygon                 base_ ;
         Point                   apex_ ;
 
+        Matrix3Xd               getDirectionsOfLateralEdges                 ( ) const ;
+
+        bool                    boundingConeExcludes                        (   const   Point&                      aCenter,
+                                                                                const   Real&                       aRadius                                     ) const ;
+
+        static Vector3d         DirectionOfLateralFacesAt                   (   const   Matrix3Xd&                  aLateralEdgeDirectionArray,
+                                                                                const   double                      aParameter                                  ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
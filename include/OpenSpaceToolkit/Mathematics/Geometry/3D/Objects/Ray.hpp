@@ -108,6 +108,12 @@ class Ray : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Ray
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if ray intersects point
         ///
         /// @code
@@ -39,6 +39,7 @@ using ostk::math::geom::d3::objects::Point ;
 
 class PointSet ;
 class Plane ;
+class Cuboid ;
 class Sphere ;
 class Ellipsoid ;
 
@@ -106,6 +107,12 @@ class Segment : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Segment
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if segment is degenerate, i.e. its length is zero
         ///
         /// @code
@@ -225,6 +232,24 @@ class Segment : public Object
 
         Intersection            intersectionWith                            (   const   Plane&                      aPlane                                      ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Axis-aligned bounding box
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Degenerate box along segment
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Sphere whose diameter is the segment
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print segment
         ///
         /// @param              [in] anOutputStream An output stream
@@ -13,6 +13,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
 
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
 #include <OpenSpaceToolkit/Core/Types/Real.hpp>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +32,7 @@ namespace objects
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 using ostk::core::types::Real ;
+using ostk::core::ctnr::Array ;
 
 using ostk::math::geom::d3::Object ;
 using ostk::math::geom::d3::objects::Point ;
@@ -43,6 +45,7 @@ class Ray ;
 class Segment ;
 class Plane ;
 class Polygon ;
+class Cuboid ;
 class Ellipsoid ;
 class Pyramid ;
 class Cone ;
@@ -110,6 +113,12 @@ class Sphere : public Object
 
         virtual bool            isDefined                                   ( ) const override ;
 
+        /// @brief              Get object type
+        ///
+        /// @return             Object::Type::Sphere
+
+        virtual Object::Type    getType                                     ( ) const override ;
+
         /// @brief              Check if sphere is unitary, i.e. its radius is equal to 1.0
         ///
         /// @code
@@ -324,6 +333,24 @@ class Sphere : public Object
         Intersection            intersectionWith                            (   const   Cone&                       aCone,
                                                                                 const   bool                        onlyInSight                                 =   false ) const ;
 
+        /// @brief              Get axis-aligned bounding box
+        ///
+        /// @return             Axis-aligned cube around sphere
+
+        virtual Cuboid          getBoundingBox                              ( ) const override ;
+
+        /// @brief              Get oriented bounding box
+        ///
+        /// @return             Axis-aligned cube around sphere
+
+        virtual Cuboid          getOrientedBoundingBox                      ( ) const override ;
+
+        /// @brief              Get bounding sphere
+        ///
+        /// @return             Sphere itself
+
+        virtual Sphere          getBoundingSphere                           ( ) const override ;
+
         /// @brief              Print sphere
         ///
         /// @param              [in] anOutputStream An output stream
@@ -360,6 +387,18 @@ class Sphere : public Object
 
         static Sphere           Unit                                        (   const   Point&                      aCenter                                     ) ;
 
+        /// @brief              Constructs a bounding sphere of points
+        ///
+        ///                     Grows a sphere seeded by the most distant pair of extreme points along the frame axes until it encloses
+        ///                     every point (Ritter's algorithm), which is typically within a few percent of the minimal sphere.
+        ///
+        /// @ref                https://en.wikipedia.org/wiki/Bounding_sphere
+        ///
+        /// @param              [in] aPointArray An array of points
+        /// @return             Bounding sphere
+
+        static Sphere           BoundingSphere                              (   const   Array<Point>&               aPointArray                                 ) ;
+
     private:
 
         Point                   center_ ;
@@ -0,0 +1,307 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Scene__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Scene__
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Object.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Types/Unique.hpp>
+#include <OpenSpaceToolkit/Core/Types/Shared.hpp>
+
+#include <mutex>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Unique ;
+using ostk::core::types::Shared ;
+using ostk::core::types::Index ;
+using ostk::core::types::Size ;
+using ostk::core::types::Real ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::geom::d3::Object ;
+using ostk::math::geom::d3::objects::Point ;
+using ostk::math::geom::d3::objects::Ray ;
+using ostk::math::geom::d3::objects::Segment ;
+
+class Transformation ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      3D scene
+///
+///                             Collection of solid objects (spheres, ellipsoids, cuboids, pyramids, polygons, and composites of these),
+///                             indexed by a bounding volume hierarchy over their axis-aligned bounding boxes, so that ray, segment and
+///                             overlap queries only test the few objects they may actually touch.
+///
+///                             The hierarchy is built on first query, in parallel for large scenes. Transforming objects refits it on the
+///                             next query, without changing its topology. Const queries may run concurrently with each other and with build:
+///                             each one holds on to the hierarchy it started with, which is never modified once built.
+///
+///                             Spheres, ellipsoids, cuboids and pyramids are treated as solids: a ray starting inside one of them hits it
+///                             at its origin. Pyramids are bounded by their base.
+///
+/// @code
+///                     Array<Unique<Object>> objects = ... ;
+///                     Scene scene = Scene(std::move(objects)) ;
+///                     Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })) ;
+///                     if (hit.isDefined()) { scene.accessObjectAt(hit.objectIndex) ; }
+/// @endcode
+
+class Scene
+{
+
+    public:
+
+        /// @brief              Ray hit
+
+        struct Hit
+        {
+
+            Index               objectIndex ;                                   ///< Index of the object hit
+            Point               point ;                                         ///< Hit point
+            Real                distance ;                                      ///< Distance from the ray origin to the hit point
+
+            /// @brief          Check if hit is defined
+            ///
+            /// @return         True if an object was hit
+
+            bool                isDefined                                   ( ) const ;
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        ///                     Clones the objects in the array.
+        ///
+        /// @param              [in] anObjectArray An array of unique pointers to object
+
+        explicit                Scene                                       (   const   Array<Unique<Object>>&      anObjectArray                               ) ;
+
+        /// @brief              Constructor
+        ///
+        ///                     Takes ownership of the objects in the array.
+        ///
+        /// @param              [in] anObjectArray An array of unique pointers to object
+
+        explicit                Scene                                       (           Array<Unique<Object>>&&     anObjectArray                               ) ;
+
+        /// @brief              Copy constructor
+        ///
+        /// @param              [in] aScene A scene
+
+                                Scene                                       (   const   Scene&                      aScene                                      ) ;
+
+        /// @brief              Move constructor
+        ///
+        /// @param              [in] aScene A scene
+
+                                Scene                                       (           Scene&&                     aScene                                      ) ;
+
+        /// @brief              Destructor
+
+                                ~Scene                                      ( ) ;
+
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] aScene A scene
+        /// @return             Reference to scene
+
+        Scene&                  operator =                                  (   const   Scene&                      aScene                                      ) ;
+
+        /// @brief              Move assignment operator
+        ///
+        /// @param              [in] aScene A scene
+        /// @return             Reference to scene
+
+        Scene&                  operator =                                  (           Scene&&                     aScene                                      ) ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] aScene A scene
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Scene&                      aScene                                      ) ;
+
+        /// @brief              Check if scene is empty
+        ///
+        /// @return             True if scene is empty
+
+        bool                    isEmpty                                     ( ) const ;
+
+        /// @brief              Check if scene intersects ray
+        ///
+        ///                     Stops at the first object found along the ray, which is not necessarily the closest one.
+        ///
+        /// @code
+        ///                     scene.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })) ;
+        /// @endcode
+        ///
+        /// @param              [in] aRay A ray
+        /// @return             True if any object of the scene intersects ray
+
+        bool                    intersects                                  (   const   Ray&                        aRay                                        ) const ;
+
+        /// @brief              Check if scene intersects segment
+        ///
+        ///                     Stops at the first object found along the segment, which is not necessarily the closest one.
+        ///
+        /// @code
+        ///                     scene.intersects(Segment({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 })) ;
+        /// @endcode
+        ///
+        /// @param              [in] aSegment A segment
+        /// @return             True if any object of the scene intersects segment
+
+        bool                    intersects                                  (   const   Segment&                    aSegment                                    ) const ;
+
+        /// @brief              Access object at index
+        ///
+        /// @param              [in] anIndex An index
+        /// @return             Reference to object
+
+        const Object&           accessObjectAt                              (   const   Index&                      anIndex                                     ) const ;
+
+        /// @brief              Get number of objects
+        ///
+        /// @return             Number of objects
+
+        Size                    getObjectCount                              ( ) const ;
+
+        /// @brief              Get first object hit by ray
+        ///
+        /// @code
+        ///                     Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })) ;
+        /// @endcode
+        ///
+        /// @param              [in] aRay A ray
+        /// @return             Closest hit along ray (undefined if no object is hit)
+
+        Scene::Hit              getFirstHitOf                               (   const   Ray&                        aRay                                        ) const ;
+
+        /// @brief              Get indices of objects overlapping another object
+        ///
+        ///                     Objects overlap when their axis-aligned bounding boxes intersect. This is a conservative test,
+        ///                     meant to select the candidates of an exact query.
+        ///
+        /// @param              [in] anObject A bounded object
+        /// @return             Array of object indices, in increasing order
+
+        Array<Index>            getObjectIndicesOverlapping                 (   const   Object&                     anObject                                    ) const ;
+
+        /// @brief              Add object to scene
+        ///
+        ///                     The hierarchy is rebuilt on next query.
+        ///
+        /// @param              [in] anObject An object
+        /// @return             Index of added object
+
+        Index                   addObject                                   (   const   Object&                     anObject                                    ) ;
+
+        /// @brief              Add object to scene, taking ownership of it
+        ///
+        ///                     The hierarchy is rebuilt on next query.
+        ///
+        /// @param              [in] anObjectUPtr A unique pointer to object
+        /// @return             Index of added object
+
+        Index                   addObject                                   (           Unique<Object>&&            anObjectUPtr                                ) ;
+
+        /// @brief              Build hierarchy
+        ///
+        ///                     Rebuilds the hierarchy from scratch. Refitting keeps the hierarchy valid as objects move, but not optimal:
+        ///                     rebuilding restores query performance after large displacements.
+
+        void                    build                                       ( ) const ;
+
+        /// @brief              Print scene
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           =   true ) const ;
+
+        /// @brief              Apply transformation to object at index
+        ///
+        ///                     The hierarchy is refitted on next query.
+        ///
+        /// @param              [in] anIndex An index
+        /// @param              [in] aTransformation A transformation
+
+        void                    applyTransformation                         (   const   Index&                      anIndex,
+                                                                                const   Transformation&             aTransformation                             ) ;
+
+        /// @brief              Apply transformation to all objects
+        ///
+        ///                     The hierarchy is refitted on next query.
+        ///
+        /// @param              [in] aTransformation A transformation
+
+        void                    applyTransformation                         (   const   Transformation&             aTransformation                             ) ;
+
+        /// @brief              Constructs an empty scene
+        ///
+        /// @return             Empty scene
+
+        static Scene            Empty                                       ( ) ;
+
+    private:
+
+        class Hierarchy ;
+
+        Array<Unique<Object>>   objects_ ;
+
+        mutable Shared<const Scene::Hierarchy> hierarchySPtr_ ;
+        mutable std::vector<Index> modifiedIndices_ ;
+        mutable bool            allModified_ ;
+        mutable std::mutex      hierarchyMutex_ ;
+
+        Shared<const Scene::Hierarchy> accessHierarchy                      ( ) const ;
+
+        static void             Validate                                    (   const   Object&                     anObject                                    ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
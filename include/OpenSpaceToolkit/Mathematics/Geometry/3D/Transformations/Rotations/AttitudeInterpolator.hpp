@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator__
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Index ;
+using ostk::core::types::Size ;
+using ostk::core::types::Real ;
+using ostk::core::types::String ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::obj::VectorXd ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Attitude interpolator
+///
+///                             Interpolates a time series of unit quaternions. The per-segment terms (shortest path orientation,
+///                             arc angle, SQUAD control points...) are computed once on construction, so that evaluating the
+///                             interpolator at a given time only involves locating the segment and a couple of trigonometric calls.
+///
+///                             When evaluating an array of times, the segment of the previous time is used as a starting guess:
+///                             sorted query times are thus streamed through the segments without any binary search.
+///
+/// @code
+///                     VectorXd times = ... ;
+///                     Array<Quaternion> quaternions = ... ;
+///                     AttitudeInterpolator interpolator = { times, quaternions, AttitudeInterpolator::Type::SLERP } ;
+///                     Quaternion quaternion = interpolator.evaluate(0.5) ;
+/// @endcode
+
+class AttitudeInterpolator
+{
+
+    public:
+
+        enum class Type
+        {
+
+            Undefined,
+            NLERP,                      ///< Normalized linear interpolation, continuous attitude
+            SLERP,                      ///< Spherical linear interpolation, continuous attitude and piecewise constant angular rate
+            SQUAD                       ///< Spherical quadrangle interpolation, continuous attitude and angular rate
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aTimeArray A vector of times, strictly increasing
+        /// @param              [in] aQuaternionArray An array of unit quaternions, one per time
+        /// @param              [in] (optional) aType An interpolation type
+
+                                AttitudeInterpolator                        (   const   VectorXd&                   aTimeArray,
+                                                                                const   Array<Quaternion>&          aQuaternionArray,
+                                                                                const   AttitudeInterpolator::Type& aType                                       =   AttitudeInterpolator::Type::SLERP ) ;
+
+        /// @brief              Copy constructor
+        ///
+        /// @param              [in] anAttitudeInterpolator An attitude interpolator
+
+                                AttitudeInterpolator                        (   const   AttitudeInterpolator&       anAttitudeInterpolator                      ) ;
+
+        /// @brief              Destructor
+
+                                ~AttitudeInterpolator                       ( ) ;
+
+        /// @brief              Copy assignment operator
+        ///
+        /// @param              [in] anAttitudeInterpolator An attitude interpolator
+        /// @return             Reference to attitude interpolator
+
+        AttitudeInterpolator&   operator =                                  (   const   AttitudeInterpolator&       anAttitudeInterpolator                      ) ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] anAttitudeInterpolator An attitude interpolator
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   AttitudeInterpolator&       anAttitudeInterpolator                      ) ;
+
+        /// @brief              Get number of samples
+        ///
+        /// @return             Number of samples
+
+        Size                    getSampleCount                              ( ) const ;
+
+        /// @brief              Get interpolation type
+        ///
+        /// @return             Interpolation type
+
+        AttitudeInterpolator::Type getType                                  ( ) const ;
+
+        /// @brief              Get first sample time
+        ///
+        /// @return             First sample time
+
+        Real                    getFirstTime                                ( ) const ;
+
+        /// @brief              Get last sample time
+        ///
+        /// @return             Last sample time
+
+        Real                    getLastTime                                 ( ) const ;
+
+        /// @brief              Evaluate interpolator at time
+        ///
+        /// @param              [in] aTime A time, within the sample times
+        /// @return             Interpolated unit quaternion
+
+        Quaternion              evaluate                                    (   const   Real&                       aTime                                       ) const ;
+
+        /// @brief              Evaluate interpolator at times
+        ///
+        ///                     Times can be in any order, sorted times being the fastest to evaluate.
+        ///
+        /// @param              [in] aTimeArray A vector of times, within the sample times
+        /// @return             Array of interpolated unit quaternions, one per time
+
+        Array<Quaternion>       evaluate                                    (   const   VectorXd&                   aTimeArray                                  ) const ;
+
+        /// @brief              Print attitude interpolator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] (optional) displayDecorators If true, display decorators
+
+        void                    print                                       (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           =   true ) const ;
+
+        /// @brief              Get string from interpolation type
+        ///
+        /// @code
+        ///                     AttitudeInterpolator::StringFromType(AttitudeInterpolator::Type::SLERP) ; // "SLERP"
+        /// @endcode
+        ///
+        /// @param              [in] aType An interpolation type
+        /// @return             String
+
+        static String           StringFromType                              (   const   AttitudeInterpolator::Type& aType                                       ) ;
+
+    private:
+
+        class Segment ;
+
+        AttitudeInterpolator::Type type_ ;
+
+        VectorXd                times_ ;
+        std::vector<AttitudeInterpolator::Segment> segments_ ;
+
+        Index                   getSegmentIndexAt                           (   const   double                      aTime,
+                                                                                const   Index&                      aSegmentIndexGuess                          ) const ;
+
+        Quaternion              evaluateSegmentAt                           (   const   Index&                      aSegmentIndex,
+                                                                                const   double                      aTime                                       ) const ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
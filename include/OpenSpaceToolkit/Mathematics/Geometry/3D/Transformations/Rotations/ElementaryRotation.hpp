@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation__
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Index ;
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3d ;
+using ostk::math::geom::Angle ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Rotation axis
+
+enum class Axis
+{
+
+    X,
+    Y,
+    Z
+
+} ;
+
+/// @brief                      Elementary rotation, around a coordinate axis known at compile time
+///
+///                             Same rotation as RotationMatrix::RX, RY or RZ, stored as the cosine and sine of its angle.
+///                             Composing elementary rotations around the same axis, or applying one to a vector, only involves
+///                             the two coordinates it actually mixes (4 multiplications). Mixing it with a rotation matrix only
+///                             updates two rows (or columns) of the matrix, so that Euler angle sequences can be composed without
+///                             any dense matrix product.
+///
+///                             Elementary rotations are promoted to RotationMatrix or Quaternion when mixed with other rotations.
+///
+/// @code
+///                     const ElementaryRotation<Axis::Z> rotation = ElementaryRotation<Axis::Z>(Angle::Degrees(30.0)) ;
+///                     const Vector3d vector = rotation * Vector3d(1.0, 0.0, 0.0) ;
+///                     const RotationMatrix rotationMatrix = ElementaryRotation<Axis::Z>(psi) * ElementaryRotation<Axis::X>(theta) * ElementaryRotation<Axis::Z>(phi) ;
+/// @endcode
+
+template <Axis anAxis>
+class ElementaryRotation
+{
+
+    public:
+
+        /// @brief              Constructor
+        ///
+        /// @param              [in] aRotationAngle A rotation angle
+
+        explicit                ElementaryRotation                          (   const   Angle&                      aRotationAngle                              ) ;
+
+        /// @brief              Composition operator, around the same axis
+        ///
+        /// @param              [in] anElementaryRotation An elementary rotation, around the same axis
+        /// @return             Elementary rotation
+
+        ElementaryRotation      operator *                                  (   const   ElementaryRotation&         anElementaryRotation                        ) const ;
+
+        /// @brief              Composition operator, around another axis
+        ///
+        /// @param              [in] anElementaryRotation An elementary rotation, around another axis
+        /// @return             Rotation matrix
+
+        template <Axis anotherAxis>
+        RotationMatrix          operator *                                  (   const   ElementaryRotation<anotherAxis>& anElementaryRotation                   ) const ;
+
+        /// @brief              Composition operator, with a rotation matrix
+        ///
+        /// @param              [in] aRotationMatrix A rotation matrix
+        /// @return             Rotation matrix
+
+        RotationMatrix          operator *                                  (   const   RotationMatrix&             aRotationMatrix                             ) const ;
+
+        /// @brief              Composition operator, with a quaternion
+        ///
+        /// @param              [in] aQuaternion A quaternion
+        /// @return             Quaternion
+
+        Quaternion              operator *                                  (   const   Quaternion&                 aQuaternion                                 ) const ;
+
+        /// @brief              Vector multiplication operator
+        ///
+        /// @param              [in] aVector A vector
+        /// @return             Rotated vector
+
+        Vector3d                operator *                                  (   const   Vector3d&                   aVector                                     ) const ;
+
+        /// @brief              Composition operator, of a rotation matrix with an elementary rotation
+        ///
+        /// @param              [in] aRotationMatrix A rotation matrix
+        /// @param              [in] anElementaryRotation An elementary rotation
+        /// @return             Rotation matrix
+
+        template <Axis anotherAxis>
+        friend RotationMatrix   operator *                                  (   const   RotationMatrix&             aRotationMatrix,
+                                                                                const   ElementaryRotation<anotherAxis>& anElementaryRotation                   ) ;
+
+        /// @brief              Composition operator, of a quaternion with an elementary rotation
+        ///
+        /// @param              [in] aQuaternion A quaternion
+        /// @param              [in] anElementaryRotation An elementary rotation
+        /// @return             Quaternion
+
+        template <Axis anotherAxis>
+        friend Quaternion       operator *                                  (   const   Quaternion&                 aQuaternion,
+                                                                                const   ElementaryRotation<anotherAxis>& anElementaryRotation                   ) ;
+
+        /// @brief              Get rotation angle
+        ///
+        /// @return             Rotation angle, in ]-180, 180] [deg]
+
+        Angle                   getAngle                                    ( ) const ;
+
+        /// @brief              Get inverse elementary rotation
+        ///
+        /// @return             Inverse elementary rotation
+
+        ElementaryRotation      toInverse                                   ( ) const ;
+
+        /// @brief              Convert elementary rotation to rotation matrix
+        ///
+        /// @return             Rotation matrix
+
+        RotationMatrix          toRotationMatrix                            ( ) const ;
+
+        /// @brief              Convert elementary rotation to quaternion
+        ///
+        /// @return             Unit quaternion
+
+        Quaternion              toQuaternion                                ( ) const ;
+
+        /// @brief              Constructs a unit elementary rotation
+        ///
+        /// @return             Unit elementary rotation
+
+        static ElementaryRotation Unit                                      ( ) ;
+
+    private:
+
+        /// Coordinates mixed by the rotation, in the (X, Y, Z) cyclic order
+
+        static constexpr Index  FirstIndex                                  =   (anAxis == Axis::X) ? 1 : ((anAxis == Axis::Y) ? 2 : 0) ;
+        static constexpr Index  SecondIndex                                 =   (FirstIndex + 1) % 3 ;
+        static constexpr Index  AxisIndex                                   =   3 - FirstIndex - SecondIndex ;
+
+        double                  cosine_ ;
+        double                  sine_ ;
+
+                                ElementaryRotation                          (   const   double                      aCosine,
+                                                                                const   double                      aSine                                       ) ;
+
+        void                    applyOnTheLeft                              (           RotationMatrix&             aRotationMatrix                             ) const ;
+
+        void                    applyOnTheRight                             (           RotationMatrix&             aRotationMatrix                             ) const ;
+
+        template <Axis anotherAxis>
+        friend class ElementaryRotation ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.tpp>
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
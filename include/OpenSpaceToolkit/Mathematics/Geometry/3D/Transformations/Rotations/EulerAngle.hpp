@@ -10,6 +10,12 @@
 #ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle__
 #define __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle__
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/String.hpp>
+#include <OpenSpaceToolkit/Core/Types/Integer.hpp>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -27,7 +33,241 @@ namespace rot
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using ostk::core::types::Integer ;
+using ostk::core::types::String ;
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3Xd ;
+using ostk::math::obj::Matrix4Xd ;
+using ostk::math::geom::Angle ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+class Quaternion ;
+class RotationMatrix ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Euler angles
+///
+///                             For an axis sequence ABC, the angles (phi, theta, psi) describe the frame obtained by rotating
+///                             a first frame around its A-axis by phi, then around the new B-axis by theta, then around the
+///                             newest C-axis by psi. The associated rotation matrix is thus:
+///
+///                                 R = RC(psi) * RB(theta) * RA(phi)
+///
+///                             with RX, RY and RZ as defined in RotationMatrix.
+///
+///                             Conversions to and from quaternions are carried out in closed form, from the half angles,
+///                             for all 12 axis sequences. Tait-Bryan sequences (ABC) return theta in [-90, 90] [deg], proper Euler
+///                             sequences (ABA) return theta in [0, 180] [deg]. At gimbal lock, psi is set to zero.
+///
+/// @ref                        https://en.wikipedia.org/wiki/Euler_angles
+/// @ref                        Bernardes E., Viollet S. (2022), Quaternion to Euler angles conversion: A direct, general and computationally efficient method
+
+class EulerAngle
+{
+
+    public:
+
+        enum class AxisSequence
+        {
+
+            Undefined,
+            XYX,
+            XYZ,
+            XZX,
+            XZY,
+            YXY,
+            YXZ,
+            YZX,
+            YZY,
+            ZXY,
+            ZXZ,
+            ZYX,
+            ZYZ
+
+        } ;
+
+        /// @brief              Constructor
+        ///
+        /// @code
+        ///                     EulerAngle eulerAngle = { Angle::Degrees(10.0), Angle::Degrees(20.0), Angle::Degrees(30.0), EulerAngle::AxisSequence::ZYX } ;
+        /// @endcode
+        ///
+        /// @param              [in] aFirstAngle A first angle (phi)
+        /// @param              [in] aSecondAngle A second angle (theta)
+        /// @param              [in] aThirdAngle A third angle (psi)
+        /// @param              [in] anAxisSequence An axis sequence
+
+                                EulerAngle                                  (   const   Angle&                      aFirstAngle,
+                                                                                const   Angle&                      aSecondAngle,
+                                                                                const   Angle&                      aThirdAngle,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Equal to operator
+        ///
+        /// @param              [in] anEulerAngle Euler angles
+        /// @return             True if Euler angles are equal
+
+        bool                    operator ==                                 (   const   EulerAngle&                 anEulerAngle                                ) const ;
+
+        /// @brief              Not equal to operator
+        ///
+        /// @param              [in] anEulerAngle Euler angles
+        /// @return             True if Euler angles are not equal
+
+        bool                    operator !=                                 (   const   EulerAngle&                 anEulerAngle                                ) const ;
+
+        /// @brief              Output stream operator
+        ///
+        /// @param              [in] anOutputStream An output stream
+        /// @param              [in] anEulerAngle Euler angles
+        /// @return             A reference to output stream
+
+        friend std::ostream&    operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   EulerAngle&                 anEulerAngle                                ) ;
+
+        /// @brief              Check if Euler angles are defined
+        ///
+        /// @return             True if Euler angles are defined
+
+        bool                    isDefined                                   ( ) const ;
+
+        /// @brief              Get first angle (phi)
+        ///
+        /// @return             First angle
+
+        Angle                   getPhi                                      ( ) const ;
+
+        /// @brief              Get second angle (theta)
+        ///
+        /// @return             Second angle
+
+        Angle                   getTheta                                    ( ) const ;
+
+        /// @brief              Get third angle (psi)
+        ///
+        /// @return             Third angle
+
+        Angle                   getPsi                                      ( ) const ;
+
+        /// @brief              Get axis sequence
+        ///
+        /// @return             Axis sequence
+
+        EulerAngle::AxisSequence getAxisSequence                            ( ) const ;
+
+        /// @brief              Convert Euler angles to vector
+        ///
+        /// @param              [in] anAngleUnit An angle unit
+        /// @return             Vector of angles (phi, theta, psi)
+
+        Vector3d                toVector                                    (   const   Angle::Unit&                anAngleUnit                                 ) const ;
+
+        /// @brief              Convert Euler angles to quaternion
+        ///
+        /// @return             Unit quaternion
+
+        rot::Quaternion         toQuaternion                                ( ) const ;
+
+        /// @brief              Convert Euler angles to rotation matrix
+        ///
+        /// @return             Rotation matrix
+
+        rot::RotationMatrix     toRotationMatrix                            ( ) const ;
+
+        /// @brief              Convert Euler angles to string
+        ///
+        /// @code
+        ///                     EulerAngle(...).toString() ; // "[10.0 [deg], 20.0 [deg], 30.0 [deg]] (ZYX)"
+        /// @endcode
+        ///
+        /// @param              [in] (optional) aPrecision A precision
+        /// @return             String representation
+
+        String                  toString                                    (   const   Integer&                    aPrecision                                  =   Integer::Undefined() ) const ;
+
+        /// @brief              Constructs undefined Euler angles
+        ///
+        /// @return             Undefined Euler angles
+
+        static EulerAngle       Undefined                                   ( ) ;
+
+        /// @brief              Constructs Euler angles from a vector
+        ///
+        /// @code
+        ///                     EulerAngle eulerAngle = EulerAngle::Vector({ 10.0, 20.0, 30.0 }, Angle::Unit::Degree, EulerAngle::AxisSequence::ZYX) ;
+        /// @endcode
+        ///
+        /// @param              [in] aVector A vector of angles (phi, theta, psi)
+        /// @param              [in] anAngleUnit An angle unit
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             Euler angles
+
+        static EulerAngle       Vector                                      (   const   Vector3d&                   aVector,
+                                                                                const   Angle::Unit&                anAngleUnit,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Constructs Euler angles from a quaternion
+        ///
+        /// @param              [in] aQuaternion A unit quaternion
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             Euler angles
+
+        static EulerAngle       Quaternion                                  (   const   rot::Quaternion&            aQuaternion,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Constructs Euler angles from a rotation matrix
+        ///
+        /// @param              [in] aRotationMatrix A rotation matrix
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             Euler angles
+
+        static EulerAngle       RotationMatrix                              (   const   rot::RotationMatrix&        aRotationMatrix,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Convert an array of Euler angles to quaternions
+        ///
+        ///                     Raw arrays are used, so that large telemetry batches are converted without per-sample objects.
+        ///
+        /// @param              [in] anAngleArray A 3xN array of angles (phi, theta, psi) [rad]
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             4xN array of unit quaternions, in XYZS format
+
+        static Matrix4Xd        QuaternionsFromAngles                       (   const   Matrix3Xd&                  anAngleArray,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Convert an array of quaternions to Euler angles
+        ///
+        ///                     Quaternions do not need to be normalized.
+        ///
+        /// @param              [in] aQuaternionArray A 4xN array of non-zero quaternions, in XYZS format
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             3xN array of angles (phi, theta, psi) [rad]
+
+        static Matrix3Xd        AnglesFromQuaternions                       (   const   Matrix4Xd&                  aQuaternionArray,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+        /// @brief              Get string from axis sequence
+        ///
+        /// @code
+        ///                     EulerAngle::StringFromAxisSequence(EulerAngle::AxisSequence::ZYX) ; // "ZYX"
+        /// @endcode
+        ///
+        /// @param              [in] anAxisSequence An axis sequence
+        /// @return             String
+
+        static String           StringFromAxisSequence                      (   const   EulerAngle::AxisSequence&   anAxisSequence                              ) ;
+
+    private:
+
+        Angle                   phi_ ;
+        Angle                   theta_ ;
+        Angle                   psi_ ;
+        EulerAngle::AxisSequence axisSequence_ ;
 
+} ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -40,6 +40,8 @@ using ostk::core::types::String ;
 
 using ostk::math::obj::Vector3d ;
 using ostk::math::obj::Vector4d ;
+using ostk::math::obj::Matrix3d ;
+using ostk::math::obj::Matrix3Xd ;
 using ostk::math::geom::Angle ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -384,6 +386,28 @@ class Quaternion
 
         Vector3d                rotateVector                                (   const   Vector3d&                   aVector                                     ) const ;
 
+        /// @brief              Rotate vectors
+        ///
+        ///                     Same as rotateVector, applied to each column of the input matrix.
+        ///                     The quaternion is converted once to a rotation matrix, so that the batch reduces to a single matrix product.
+        ///                     Columns are not checked individually: undefined vectors yield undefined columns.
+        ///
+        /// @code
+        ///                     Matrix3Xd vectors = Matrix3Xd::Random(3, 1000000) ;
+        ///                     Matrix3Xd rotatedVectors = quaternion.rotateVectors(vectors) ;
+        /// @endcode
+        ///
+        /// @param              [in] aVectorArray A 3xN matrix of vectors, one per column
+        /// @return             3xN matrix of rotated vectors
+
+        Matrix3Xd               rotateVectors                               (   const   Matrix3Xd&                  aVectorArray                                ) const ;
+
+        /// @brief              Rotate vectors in place
+        ///
+        /// @param              [in,out] aVectorArray A 3xN matrix of vectors, one per column
+
+        void                    rotateVectorsInPlace                        (           Matrix3Xd&                  aVectorArray                                ) const ;
+
         /// @brief              Convert quaternion to its vector representation
         ///
         /// @code
@@ -537,6 +561,67 @@ class Quaternion
         static Quaternion       Parse                                       (   const   String&                     aString,
                                                                                 const   Quaternion::Format&         aFormat                                     =   Quaternion::Format::XYZS ) ;
 
+        /// @brief              Spherical linear interpolation (SLERP)
+        ///
+        ///                     Interpolates at constant angular rate along the shortest path between two unit quaternions.
+        ///
+        /// @code
+        ///                     Quaternion quaternion = Quaternion::SLERP(Quaternion::Unit(), Quaternion::XYZS(0.0, 0.0, 1.0, 0.0), 0.5) ; // [0.0, 0.0, 0.70710678118, 0.70710678118]
+        /// @endcode
+        ///
+        /// @param              [in] aFirstQuaternion A first unit quaternion
+        /// @param              [in] aSecondQuaternion A second unit quaternion
+        /// @param              [in] aRatio An interpolation ratio, in [0, 1]
+        /// @return             Interpolated unit quaternion
+
+        static Quaternion       SLERP                                       (   const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Real&                       aRatio                                      ) ;
+
+        /// @brief              Normalized linear interpolation (NLERP)
+        ///
+        ///                     Cheaper than SLERP, along the same path but at a non constant angular rate.
+        ///
+        /// @param              [in] aFirstQuaternion A first unit quaternion
+        /// @param              [in] aSecondQuaternion A second unit quaternion
+        /// @param              [in] aRatio An interpolation ratio, in [0, 1]
+        /// @return             Interpolated unit quaternion
+
+        static Quaternion       NLERP                                       (   const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Real&                       aRatio                                      ) ;
+
+        /// @brief              Spherical quadrangle interpolation (SQUAD)
+        ///
+        ///                     Interpolates between the second and third quaternions of a sequence of four,
+        ///                     so that the angular rate is continuous across successive segments of the sequence.
+        ///
+        /// @param              [in] aPreviousQuaternion A unit quaternion, preceding the first one
+        /// @param              [in] aFirstQuaternion A first unit quaternion
+        /// @param              [in] aSecondQuaternion A second unit quaternion
+        /// @param              [in] aNextQuaternion A unit quaternion, following the second one
+        /// @param              [in] aRatio An interpolation ratio, in [0, 1]
+        /// @return             Interpolated unit quaternion
+
+        static Quaternion       SQUAD                                       (   const   Quaternion&                 aPreviousQuaternion,
+                                                                                const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Quaternion&                 aNextQuaternion,
+                                                                                const   Real&                       aRatio                                      ) ;
+
+        /// @brief              SQUAD control point
+        ///
+        ///                     Intermediate quaternion of a sample in a SQUAD sequence, given its neighbors.
+        ///
+        /// @param              [in] aPreviousQuaternion A unit quaternion, preceding the sample
+        /// @param              [in] aQuaternion A unit quaternion, the sample
+        /// @param              [in] aNextQuaternion A unit quaternion, following the sample
+        /// @return             Control point, as a unit quaternion
+
+        static Quaternion       SQUADControlPoint                           (   const   Quaternion&                 aPreviousQuaternion,
+                                                                                const   Quaternion&                 aQuaternion,
+                                                                                const   Quaternion&                 aNextQuaternion                             ) ;
+
     private:
 
         Real                    x_ ;
@@ -544,6 +629,8 @@ class Quaternion
         Real                    z_ ;
         Real                    s_ ;
 
+        Matrix3d                toVectorRotationMatrix                      ( ) const ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
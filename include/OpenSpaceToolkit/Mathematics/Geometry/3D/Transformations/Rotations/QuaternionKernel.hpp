@@ -0,0 +1,194 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/QuaternionKernel.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel__
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+namespace kernel
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Unchecked quaternion arithmetic, over plain doubles
+///
+///                             Quaternions are arrays of 4 doubles in the XYZS format, with the same conventions as Quaternion
+///                             (in particular, CrossMultiply(q1, q2) matches q1.crossMultiply(q2)). Nothing is checked: components
+///                             must be defined, and norms non-zero (or unitary, where stated). Outputs may alias inputs.
+///
+///                             Any XYZS storage can be used: the Quaternion class delegates to these functions, and hot loops
+///                             can call them directly on Vector4d::data(), on the columns of a Matrix4Xd, or on AlignedQuaternion.
+///
+/// @code
+///                     AlignedQuaternion q = { { 0.0, 0.0, 0.0, 1.0 } } ;
+///                     kernel::CrossMultiply(q.components, increment.components, q.components) ;
+///                     kernel::Normalize(q.components) ;
+/// @endcode
+
+/// @brief                      Quaternion storage (XYZS), aligned on 32 bytes so that it fits a single AVX register
+
+struct alignas(32) AlignedQuaternion
+{
+
+    double                      components[4] ;
+
+} ;
+
+/// @brief                      Squared norm
+
+inline double                   SquaredNorm                                 (   const   double*                     aQuaternion                                 ) noexcept
+{
+    return (aQuaternion[0] * aQuaternion[0]) + (aQuaternion[1] * aQuaternion[1]) + (aQuaternion[2] * aQuaternion[2]) + (aQuaternion[3] * aQuaternion[3]) ;
+}
+
+/// @brief                      Cross product: v = s2 v1 + s1 v2 - v1 x v2, s = s1 s2 - v1 . v2
+
+inline void                     CrossMultiply                               (   const   double*                     aLeftQuaternion,
+                                                                                const   double*                     aRightQuaternion,
+                                                                                        double*                     aResult                                     ) noexcept
+{
+
+    const double x_1 = aLeftQuaternion[0] ;
+    const double y_1 = aLeftQuaternion[1] ;
+    const double z_1 = aLeftQuaternion[2] ;
+    const double s_1 = aLeftQuaternion[3] ;
+
+    const double x_2 = aRightQuaternion[0] ;
+    const double y_2 = aRightQuaternion[1] ;
+    const double z_2 = aRightQuaternion[2] ;
+    const double s_2 = aRightQuaternion[3] ;
+
+    aResult[0] = (s_2 * x_1) + (s_1 * x_2) - ((y_1 * z_2) - (z_1 * y_2)) ;
+    aResult[1] = (s_2 * y_1) + (s_1 * y_2) - ((z_1 * x_2) - (x_1 * z_2)) ;
+    aResult[2] = (s_2 * z_1) + (s_1 * z_2) - ((x_1 * y_2) - (y_1 * x_2)) ;
+    aResult[3] = (s_1 * s_2) - ((x_1 * x_2) + (y_1 * y_2) + (z_1 * z_2)) ;
+
+}
+
+/// @brief                      Dot product: v = s2 v1 + s1 v2 + v1 x v2, s = s1 s2 - v1 . v2
+
+inline void                     DotMultiply                                 (   const   double*                     aLeftQuaternion,
+                                                                                const   double*                     aRightQuaternion,
+                                                                                        double*                     aResult                                     ) noexcept
+{
+
+    const double x_1 = aLeftQuaternion[0] ;
+    const double y_1 = aLeftQuaternion[1] ;
+    const double z_1 = aLeftQuaternion[2] ;
+    const double s_1 = aLeftQuaternion[3] ;
+
+    const double x_2 = aRightQuaternion[0] ;
+    const double y_2 = aRightQuaternion[1] ;
+    const double z_2 = aRightQuaternion[2] ;
+    const double s_2 = aRightQuaternion[3] ;
+
+    aResult[0] = (s_2 * x_1) + (s_1 * x_2) + ((y_1 * z_2) - (z_1 * y_2)) ;
+    aResult[1] = (s_2 * y_1) + (s_1 * y_2) + ((z_1 * x_2) - (x_1 * z_2)) ;
+    aResult[2] = (s_2 * z_1) + (s_1 * z_2) + ((x_1 * y_2) - (y_1 * x_2)) ;
+    aResult[3] = (s_1 * s_2) - ((x_1 * x_2) + (y_1 * y_2) + (z_1 * z_2)) ;
+
+}
+
+/// @brief                      Conjugate, in place
+
+inline void                     Conjugate                                   (           double*                     aQuaternion                                 ) noexcept
+{
+
+    aQuaternion[0] = -aQuaternion[0] ;
+    aQuaternion[1] = -aQuaternion[1] ;
+    aQuaternion[2] = -aQuaternion[2] ;
+
+}
+
+/// @brief                      Normalize, in place (non-zero norm)
+
+inline void                     Normalize                                   (           double*                     aQuaternion                                 ) noexcept
+{
+
+    const double inverseNorm = 1.0 / std::sqrt(SquaredNorm(aQuaternion)) ;
+
+    aQuaternion[0] *= inverseNorm ;
+    aQuaternion[1] *= inverseNorm ;
+    aQuaternion[2] *= inverseNorm ;
+    aQuaternion[3] *= inverseNorm ;
+
+}
+
+/// @brief                      Inverse, in place (non-zero norm)
+
+inline void                     Inverse                                     (           double*                     aQuaternion                                 ) noexcept
+{
+
+    const double inverseSquaredNorm = 1.0 / SquaredNorm(aQuaternion) ;
+
+    aQuaternion[0] *= -inverseSquaredNorm ;
+    aQuaternion[1] *= -inverseSquaredNorm ;
+    aQuaternion[2] *= -inverseSquaredNorm ;
+    aQuaternion[3] *= +inverseSquaredNorm ;
+
+}
+
+/// @brief                      Rotate vector: q v q* (unit quaternion)
+///
+///                             Expanded as v + s t - u x t, with t = 2 (v x u): 18 multiplications instead of two quaternion products.
+
+inline void                     RotateVector                                (   const   double*                     aQuaternion,
+                                                                                const   double*                     aVector,
+                                                                                        double*                     aResult                                     ) noexcept
+{
+
+    const double x = aQuaternion[0] ;
+    const double y = aQuaternion[1] ;
+    const double z = aQuaternion[2] ;
+    const double s = aQuaternion[3] ;
+
+    const double v_x = aVector[0] ;
+    const double v_y = aVector[1] ;
+    const double v_z = aVector[2] ;
+
+    const double t_x = 2.0 * ((v_y * z) - (v_z * y)) ;
+    const double t_y = 2.0 * ((v_z * x) - (v_x * z)) ;
+    const double t_z = 2.0 * ((v_x * y) - (v_y * x)) ;
+
+    aResult[0] = v_x + (s * t_x) - ((y * t_z) - (z * t_y)) ;
+    aResult[1] = v_y + (s * t_y) - ((z * t_x) - (x * t_z)) ;
+    aResult[2] = v_z + (s * t_z) - ((x * t_y) - (y * t_x)) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -44,6 +44,11 @@ using ostk::math::geom::Angle ;
 class Quaternion ;
 class RotationVector ;
 
+enum class Axis ;
+
+template <Axis anAxis>
+class ElementaryRotation ;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 /// @brief                      Rotation matrix
@@ -337,6 +342,9 @@ class RotationMatrix
 
                                 RotationMatrix                              ( ) ;
 
+        template <Axis anAxis>
+        friend class ElementaryRotation ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -39,6 +39,8 @@ namespace obj
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+using VectorXb = Eigen::Matrix<bool, Eigen::Dynamic, 1> ;
+
 using Vector2i = Eigen::Vector2i ;
 using Vector3i = Eigen::Vector3i ;
 using Vector4i = Eigen::Vector4i ;
@@ -63,6 +65,10 @@ using Matrix2d = Eigen::Matrix2d ;
 using Matrix3d = Eigen::Matrix3d ;
 using Matrix4d = Eigen::Matrix4d ;
 
+using Matrix2Xd = Eigen::Matrix2Xd ;
+using Matrix3Xd = Eigen::Matrix3Xd ;
+using Matrix4Xd = Eigen::Matrix4Xd ;
+
 using MatrixXd = Eigen::MatrixXd ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
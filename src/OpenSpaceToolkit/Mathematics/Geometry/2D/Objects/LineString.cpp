@@ -7,6 +7,7 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/LineString.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Segment.hpp>
@@ -14,6 +15,20 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <queue>
+#include <utility>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -27,13 +42,510 @@ namespace d2
 namespace objects
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Line strings with fewer segments than this are projected onto linearly, unless an index is built explicitly
+
+constexpr std::size_t IndexingThreshold = 64 ;
+
+}
+
+/// @brief                      Bounding volume hierarchy over the segments of a line string
+
+class LineString::SegmentTree : public geom::SegmentTree<Point>
+{
+
+    public:
+
+        using                   geom::SegmentTree<Point>::SegmentTree ;
+
+} ;
+
+/// @brief                      Vertex elimination over a set of line strings
+///
+///                             Vertices are removed in increasing order of importance, as long as it is within the tolerance. Douglas-Peucker
+///                             importance is the distance at which the recursion would keep a vertex, capped by that of its parent so that
+///                             elimination reproduces the recursion. Visvalingam-Whyatt importance is the effective area of a vertex, updated
+///                             as its neighbours go. With topology preservation, live vertices are held in an R-tree, queried for the triangle
+///                             that each removal sweeps.
+
+class LineString::Simplifier
+{
+
+    public:
+
+                                Simplifier                                  (   const   Array<LineString>&          aLineStringArray                            ) ;
+
+        void                    simplify                                    (   const   double&                     aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            ) ;
+
+        Array<LineString>       getLineStrings                              ( ) const ;
+
+    private:
+
+        typedef                 boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian> BoostPoint ;
+        typedef                 std::pair<Simplifier::BoostPoint, std::size_t>  Value ;
+
+        struct Chain
+        {
+
+            std::size_t         beginIndex ;
+            std::size_t         endIndex ;
+            std::size_t         vertexCount ;
+            bool                isClosed ;
+
+        } ;
+
+        struct Candidate
+        {
+
+            double              importance ;
+            std::size_t         vertexIndex ;
+            std::size_t         version ;
+
+            bool                operator >                                  (   const   Candidate&                  aCandidate                                  ) const { return importance > aCandidate.importance ; }
+
+        } ;
+
+        static constexpr std::size_t NoVertex = std::numeric_limits<std::size_t>::max() ;
+
+        std::vector<Vector2d>   vertices_ ;
+        std::vector<std::size_t> previousIndices_ ;
+        std::vector<std::size_t> nextIndices_ ;
+        std::vector<std::size_t> chainIndices_ ;
+        std::vector<std::size_t> versions_ ;
+        std::vector<bool>       removed_ ;
+        std::vector<Chain>      chains_ ;
+
+        void                    rankDouglasPeucker                          (   const   Chain&                      aChain,
+                                                                                        std::vector<double>&        anImportanceArray                           ) const ;
+
+        double                  getArea                                     (   const   std::size_t&                aVertexIndex                                ) const ;
+
+        bool                    isSweepEmpty                                (   const   std::size_t&                aVertexIndex,
+                                                                                const   boost::geometry::index::rtree<Simplifier::Value, boost::geometry::index::quadratic<16>>& anRtree ) const ;
+
+        static double           GetDistance                                 (   const   Vector2d&                   aPoint,
+                                                                                const   Vector2d&                   aFirstPoint,
+                                                                                const   Vector2d&                   aSecondPoint                                ) ;
+
+} ;
+
+                                LineString::Simplifier::Simplifier          (   const   Array<LineString>&          aLineStringArray                            )
+{
+
+    for (const auto& lineString : aLineStringArray)
+    {
+
+        // Closed line strings are stored without their closing point, and wrap around
+
+        const bool isClosed = (lineString.getPointCount() >= 4) && (lineString.points_.accessFirst() == lineString.points_.accessLast()) ;
+        const std::size_t vertexCount = lineString.getPointCount() - (isClosed ? 1 : 0) ;
+        const std::size_t beginIndex = vertices_.size() ;
+
+        for (std::size_t index = 0; index < vertexCount; ++index)
+        {
+
+            const std::size_t vertexIndex = beginIndex + index ;
+
+            vertices_.push_back(lineString.points_[index].asVector()) ;
+
+            previousIndices_.push_back((index > 0) ? (vertexIndex - 1) : (isClosed ? (beginIndex + vertexCount - 1) : NoVertex)) ;
+            nextIndices_.push_back((index + 1 < vertexCount) ? (vertexIndex + 1) : (isClosed ? beginIndex : NoVertex)) ;
+            chainIndices_.push_back(chains_.size()) ;
+
+        }
+
+        chains_.push_back({ beginIndex, beginIndex + vertexCount, vertexCount, isClosed }) ;
+
+    }
+
+    versions_.assign(vertices_.size(), 0) ;
+    removed_.assign(vertices_.size(), false) ;
+
+}
+
+void                            LineString::Simplifier::simplify            (   const   double&                     aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            )
+{
+
+    const bool isVisvalingam = (aMethod == LineString::SimplificationMethod::Visvalingam) ;
+    const double threshold = isVisvalingam ? (aTolerance * aTolerance) : aTolerance ;
+
+    std::vector<double> importances(vertices_.size(), std::numeric_limits<double>::infinity()) ;
+
+    for (const auto& chain : chains_)
+    {
+
+        if (isVisvalingam)
+        {
+
+            for (std::size_t vertexIndex = chain.beginIndex; vertexIndex < chain.endIndex; ++vertexIndex)
+            {
+
+                if ((previousIndices_[vertexIndex] != NoVertex) && (nextIndices_[vertexIndex] != NoVertex))
+                {
+                    importances[vertexIndex] = this->getArea(vertexIndex) ;
+                }
+
+            }
+
+        }
+        else
+        {
+            this->rankDouglasPeucker(chain, importances) ;
+        }
+
+    }
+
+    std::priority_queue<Candidate, std::vector<Candidate>, std::greater<Candidate>> candidates ;
+
+    for (std::size_t vertexIndex = 0; vertexIndex < vertices_.size(); ++vertexIndex)
+    {
+
+        if (importances[vertexIndex] <= threshold)
+        {
+            candidates.push({ importances[vertexIndex], vertexIndex, 0 }) ;
+        }
+
+    }
+
+    boost::geometry::index::rtree<Simplifier::Value, boost::geometry::index::quadratic<16>> rtree ;
+
+    if (preserveTopology)
+    {
+
+        std::vector<Simplifier::Value> values ;
+
+        values.reserve(vertices_.size()) ;
+
+        for (std::size_t vertexIndex = 0; vertexIndex < vertices_.size(); ++vertexIndex)
+        {
+            values.emplace_back(Simplifier::BoostPoint(vertices_[vertexIndex].x(), vertices_[vertexIndex].y()), vertexIndex) ;
+        }
+
+        rtree = boost::geometry::index::rtree<Simplifier::Value, boost::geometry::index::quadratic<16>>(values) ;
+
+    }
+
+    double lastArea = 0.0 ;
+
+    while (!candidates.empty())
+    {
+
+        const Candidate candidate = candidates.top() ;
+
+        candidates.pop() ;
+
+        const std::size_t vertexIndex = candidate.vertexIndex ;
+
+        if (removed_[vertexIndex] || (candidate.version != versions_[vertexIndex]))
+        {
+            continue ;
+        }
+
+        Chain& chain = chains_[chainIndices_[vertexIndex]] ;
+
+        if (chain.vertexCount <= (chain.isClosed ? 3 : 2))
+        {
+            continue ;
+        }
+
+        if (preserveTopology && (!this->isSweepEmpty(vertexIndex, rtree)))
+        {
+            continue ;
+        }
+
+        const std::size_t previousIndex = previousIndices_[vertexIndex] ;
+        const std::size_t nextIndex = nextIndices_[vertexIndex] ;
+
+        nextIndices_[previousIndex] = nextIndex ;
+        previousIndices_[nextIndex] = previousIndex ;
+
+        removed_[vertexIndex] = true ;
+
+        --chain.vertexCount ;
+
+        if (preserveTopology)
+        {
+            rtree.remove(Simplifier::Value(Simplifier::BoostPoint(vertices_[vertexIndex].x(), vertices_[vertexIndex].y()), vertexIndex)) ;
+        }
+
+        if (isVisvalingam)
+        {
+
+            // Effective areas never decrease, so that a vertex does not go before the ones whose removal exposed it
+
+            lastArea = std::max(lastArea, candidate.importance) ;
+
+            for (const std::size_t neighbourIndex : { previousIndex, nextIndex })
+            {
+
+                if ((previousIndices_[neighbourIndex] != NoVertex) && (nextIndices_[neighbourIndex] != NoVertex))
+                {
+
+                    const double area = std::max(this->getArea(neighbourIndex), lastArea) ;
+
+                    ++versions_[neighbourIndex] ;
+
+                    if (area <= threshold)
+                    {
+                        candidates.push({ area, neighbourIndex, versions_[neighbourIndex] }) ;
+                    }
+
+                }
+
+            }
+
+        }
+
+    }
+
+}
+
+Array<LineString>               LineString::Simplifier::getLineStrings      ( ) const
+{
+
+    Array<LineString> lineStrings = Array<LineString>::Empty() ;
+
+    lineStrings.reserve(chains_.size()) ;
+
+    for (const auto& chain : chains_)
+    {
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        points.reserve(chain.vertexCount + 1) ;
+
+        std::size_t firstIndex = chain.beginIndex ;
+
+        while ((firstIndex < chain.endIndex) && removed_[firstIndex])
+        {
+            ++firstIndex ;
+        }
+
+        for (std::size_t index = 0, vertexIndex = firstIndex; index < chain.vertexCount; ++index, vertexIndex = nextIndices_[vertexIndex])
+        {
+            points.add(Point(vertices_[vertexIndex].x(), vertices_[vertexIndex].y())) ;
+        }
+
+        if (chain.isClosed)
+        {
+            points.add(points.accessFirst()) ;
+        }
+
+        lineStrings.add(LineString(points)) ;
+
+    }
+
+    return lineStrings ;
+
+}
+
+void                            LineString::Simplifier::rankDouglasPeucker  (   const   Chain&                      aChain,
+                                                                                        std::vector<double>&        anImportanceArray                           ) const
+{
+
+    const std::size_t vertexCount = aChain.endIndex - aChain.beginIndex ;
+
+    if (vertexCount < 3)
+    {
+        return ;
+    }
+
+    // Ranges are given as positions along the chain, wrapping around closed chains
+
+    struct Range
+    {
+
+        std::size_t     firstPosition ;
+        std::size_t     lastPosition ;
+        double          importance ;
+
+    } ;
+
+    const auto vertexAt = [&aChain, vertexCount] (const std::size_t aPosition) -> std::size_t { return aChain.beginIndex + (aPosition % vertexCount) ; } ;
+
+    std::vector<Range> ranges ;
+
+    if (aChain.isClosed)
+    {
+
+        // Split rings at their first vertex and the vertex farthest from it
+
+        std::size_t farthestPosition = 1 ;
+        double farthestDistance = -1.0 ;
+
+        for (std::size_t position = 1; position < vertexCount; ++position)
+        {
+
+            const double distance = (vertices_[vertexAt(position)] - vertices_[aChain.beginIndex]).norm() ;
+
+            if (distance > farthestDistance)
+            {
+                farthestPosition = position ;
+                farthestDistance = distance ;
+            }
+
+        }
+
+        ranges.push_back({ 0, farthestPosition, std::numeric_limits<double>::infinity() }) ;
+        ranges.push_back({ farthestPosition, vertexCount, std::numeric_limits<double>::infinity() }) ;
+
+    }
+    else
+    {
+        ranges.push_back({ 0, vertexCount - 1, std::numeric_limits<double>::infinity() }) ;
+    }
+
+    while (!ranges.empty())
+    {
+
+        const Range range = ranges.back() ;
+
+        ranges.pop_back() ;
+
+        if ((range.lastPosition - range.firstPosition) < 2)
+        {
+            continue ;
+        }
+
+        const Vector2d& firstVertex = vertices_[vertexAt(range.firstPosition)] ;
+        const Vector2d& lastVertex = vertices_[vertexAt(range.lastPosition)] ;
+
+        std::size_t farthestPosition = range.firstPosition + 1 ;
+        double farthestDistance = -1.0 ;
+
+        for (std::size_t position = range.firstPosition + 1; position < range.lastPosition; ++position)
+        {
+
+            const double distance = Simplifier::GetDistance(vertices_[vertexAt(position)], firstVertex, lastVertex) ;
+
+            if (distance > farthestDistance)
+            {
+                farthestPosition = position ;
+                farthestDistance = distance ;
+            }
+
+        }
+
+        const double importance = std::min(farthestDistance, range.importance) ;
+
+        anImportanceArray[vertexAt(farthestPosition)] = importance ;
+
+        ranges.push_back({ range.firstPosition, farthestPosition, importance }) ;
+        ranges.push_back({ farthestPosition, range.lastPosition, importance }) ;
+
+    }
+
+}
+
+double                          LineString::Simplifier::getArea             (   const   std::size_t&                aVertexIndex                                ) const
+{
+
+    const Vector2d& previousVertex = vertices_[previousIndices_[aVertexIndex]] ;
+    const Vector2d& vertex = vertices_[aVertexIndex] ;
+    const Vector2d& nextVertex = vertices_[nextIndices_[aVertexIndex]] ;
+
+    const Vector2d firstSide = vertex - previousVertex ;
+    const Vector2d secondSide = nextVertex - previousVertex ;
+
+    return 0.5 * std::abs(firstSide.x() * secondSide.y() - firstSide.y() * secondSide.x()) ;
+
+}
+
+bool                            LineString::Simplifier::isSweepEmpty        (   const   std::size_t&                aVertexIndex,
+                                                                                const   boost::geometry::index::rtree<Simplifier::Value, boost::geometry::index::quadratic<16>>& anRtree ) const
+{
+
+    // The new edge crosses another one only if the triangle swept by the removal holds some other vertex (boundary included)
+
+    const std::size_t previousIndex = previousIndices_[aVertexIndex] ;
+    const std::size_t nextIndex = nextIndices_[aVertexIndex] ;
+
+    const Vector2d& firstVertex = vertices_[previousIndex] ;
+    const Vector2d& secondVertex = vertices_[aVertexIndex] ;
+    const Vector2d& thirdVertex = vertices_[nextIndex] ;
+
+    const Vector2d minimum = firstVertex.cwiseMin(secondVertex).cwiseMin(thirdVertex) ;
+    const Vector2d maximum = firstVertex.cwiseMax(secondVertex).cwiseMax(thirdVertex) ;
+
+    const boost::geometry::model::box<Simplifier::BoostPoint> box = { { minimum.x(), minimum.y() }, { maximum.x(), maximum.y() } } ;
+
+    const auto side = [] (const Vector2d& aFirstPoint, const Vector2d& aSecondPoint, const Vector2d& aPoint) -> double
+    {
+        return (aSecondPoint.x() - aFirstPoint.x()) * (aPoint.y() - aFirstPoint.y()) - (aSecondPoint.y() - aFirstPoint.y()) * (aPoint.x() - aFirstPoint.x()) ;
+    } ;
+
+    for (auto iterator = anRtree.qbegin(boost::geometry::index::intersects(box)); iterator != anRtree.qend(); ++iterator)
+    {
+
+        const std::size_t vertexIndex = iterator->second ;
+
+        if ((vertexIndex == previousIndex) || (vertexIndex == aVertexIndex) || (vertexIndex == nextIndex))
+        {
+            continue ;
+        }
+
+        const Vector2d& vertex = vertices_[vertexIndex] ;
+
+        const double firstSide = side(firstVertex, secondVertex, vertex) ;
+        const double secondSide = side(secondVertex, thirdVertex, vertex) ;
+        const double thirdSide = side(thirdVertex, firstVertex, vertex) ;
+
+        if (((firstSide >= 0.0) && (secondSide >= 0.0) && (thirdSide >= 0.0)) || ((firstSide <= 0.0) && (secondSide <= 0.0) && (thirdSide <= 0.0)))
+        {
+            return false ;
+        }
+
+    }
+
+    return true ;
+
+}
+
+double                          LineString::Simplifier::GetDistance         (   const   Vector2d&                   aPoint,
+                                                                                const   Vector2d&                   aFirstPoint,
+                                                                                const   Vector2d&                   aSecondPoint                                )
+{
+
+    const Vector2d segment = aSecondPoint - aFirstPoint ;
+
+    const double squaredLength = segment.squaredNorm() ;
+
+    const double parameter = (squaredLength > 0.0) ? std::clamp((aPoint - aFirstPoint).dot(segment) / squaredLength, 0.0, 1.0) : 0.0 ;
+
+    return (aPoint - (aFirstPoint + parameter * segment)).norm() ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 LineString::LineString                      (   const   Array<Point>&               aPointArray                                 )
                                 :   Object(),
-                                    points_(aPointArray)
+                                    points_(aPointArray),
+                                    indexSPtr_(nullptr),
+                                    indexMutex_()
 {
 
+}
+
+                                LineString::LineString                      (   const   LineString&                 aLineString                                 )
+                                :   Object(),
+                                    points_(aLineString.points_),
+                                    indexSPtr_(nullptr),
+                                    indexMutex_()
+{
+
+    const std::lock_guard<std::mutex> lock { aLineString.indexMutex_ } ;
+
+    indexSPtr_ = aLineString.indexSPtr_ ;
+
 }
 
 LineString*                     LineString::clone                           ( ) const
@@ -41,6 +553,24 @@ LineString*                     LineString::clone                           ( )
     return new LineString(*this) ;
 }
 
+LineString&                     LineString::operator =                      (   const   LineString&                 aLineString                                 )
+{
+
+    if (this != &aLineString)
+    {
+
+        points_ = aLineString.points_ ;
+
+        const std::scoped_lock lock { indexMutex_, aLineString.indexMutex_ } ;
+
+        indexSPtr_ = aLineString.indexSPtr_ ;
+
+    }
+
+    return *this ;
+
+}
+
 bool                            LineString::operator ==                     (   const   LineString&                 aLineString                                 ) const
 {
     return points_ == aLineString.points_ ;
@@ -142,6 +672,55 @@ Point                           LineString::getPointClosestTo               (
 
 }
 
+LineString::Projection          LineString::getProjectionOf                 (   const   Point&                      aPoint                                      ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    // Short line strings are scanned linearly, rather than through a temporary hierarchy
+
+    const Shared<const LineString::SegmentTree> indexSPtr = this->accessIndex(false) ;
+
+    const LineString::SegmentTree::Projection projection = (indexSPtr != nullptr) ? indexSPtr->project(aPoint.asVector()) : LineString::SegmentTree::Project(points_, aPoint.asVector()) ;
+
+    return { projection.point, projection.segmentIndex, projection.arcLength, projection.distance } ;
+
+}
+
+void                            LineString::buildIndex                      ( ) const
+{
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    this->accessIndex(true) ;
+
+}
+
+LineString                      LineString::simplify                        (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    return LineString::Simplify({ *this }, aTolerance, aMethod, preserveTopology).accessFirst() ;
+
+}
+
 String                          LineString::toString                        (   const   Object::Format&             aFormat,
                                                                                 const   Integer&                    aPrecision                                  ) const
 {
@@ -258,6 +837,10 @@ void                            LineString::applyTransformation             (
         point = aTransformation.applyTo(point) ;
     }
 
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    indexSPtr_.reset() ;
+
 }
 
 LineString                      LineString::Empty                           ( )
@@ -277,6 +860,54 @@ LineString                      LineString::Segment                         (
 
 }
 
+Array<LineString>               LineString::Simplify                        (   const   Array<LineString>&          aLineStringArray,
+                                                                                const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            )
+{
+
+    if (!aTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Tolerance") ;
+    }
+
+    if (aTolerance < 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Tolerance [{}] is negative.", aTolerance) ;
+    }
+
+    for (const auto& lineString : aLineStringArray)
+    {
+
+        if (!lineString.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Line string") ;
+        }
+
+    }
+
+    LineString::Simplifier simplifier = { aLineStringArray } ;
+
+    simplifier.simplify(aTolerance, aMethod, preserveTopology) ;
+
+    return simplifier.getLineStrings() ;
+
+}
+
+Shared<const LineString::SegmentTree> LineString::accessIndex               (           bool                        aForce                                      ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if ((indexSPtr_ == nullptr) && (!points_.isEmpty()) && (aForce || (points_.getSize() > IndexingThreshold)))
+    {
+        indexSPtr_ = std::make_shared<const LineString::SegmentTree>(points_) ;
+    }
+
+    return indexSPtr_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
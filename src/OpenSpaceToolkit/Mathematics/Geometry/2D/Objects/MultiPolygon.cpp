@@ -7,8 +7,10 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Ring.hpp>
 
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
@@ -24,6 +26,15 @@
 #include <boost/geometry.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -49,6 +60,37 @@ using ostk::core::types::Index ;
 using ostk::core::types::Size ;
 using ostk::core::types::String ;
 
+using ostk::math::geom::d2::PolygonIndex ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Polygon count above which point containment goes through a polygon index
+
+constexpr std::size_t IndexingThreshold = 16 ;
+
+// Polygon count under which a cascaded union subtree is merged on the calling thread
+
+constexpr std::size_t ParallelThreshold = 64 ;
+
+// Interleave the bits of a 16-bit coordinate with zeros, to build Morton codes
+
+std::uint32_t                   SpreadBits                                  (           std::uint32_t               aValue                                      )
+{
+
+    aValue = (aValue | (aValue << 8)) & 0x00FF00FF ;
+    aValue = (aValue | (aValue << 4)) & 0x0F0F0F0F ;
+    aValue = (aValue | (aValue << 2)) & 0x33333333 ;
+    aValue = (aValue | (aValue << 1)) & 0x55555555 ;
+
+    return aValue ;
+
+}
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class MultiPolygon::Impl
@@ -76,13 +118,24 @@ class MultiPolygon::Impl
 
         Polygon2d               getConvexHull                               ( ) const ;
 
+        MultiPolygon::Impl      intersectionWith                            (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const ;
+
         MultiPolygon::Impl      unionWith                                   (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const ;
 
+        MultiPolygon::Impl      differenceWith                              (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const ;
+
+        MultiPolygon::Impl      symmetricDifferenceWith                     (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const ;
+
+        MultiPolygon::Impl      clip                                        (   const   Polygon2d&                  aPolygon,
+                                                                                const   Array<Index>&               aPolygonIndexArray                          ) const ;
+
         String                  toString                                    (   const   Object::Format&             aFormat,
                                                                                 const   Integer&                    aPrecision                                  ) const ;
 
         void                    applyTransformation                         (   const   Transformation&             aTransformation                             ) ;
 
+        static MultiPolygon::Impl Union                                     (   const   Array<Polygon2d>&           aPolygonArray                               ) ;
+
     private:
 
         typedef                 point<double, 2, cartesian>                     BoostPoint ;
@@ -96,6 +149,11 @@ class MultiPolygon::Impl
 
         static Polygon2d        PolygonFromBoostPolygon                     (   const   MultiPolygon::Impl::BoostPolygon& aPolygon                              ) ;
 
+        static Impl::BoostMultiPolygon CascadedUnion                        (   const   std::vector<Impl::BoostMultiPolygon>& aMultiPolygonArray,
+                                                                                const   std::size_t                 aBeginIndex,
+                                                                                const   std::size_t                 anEndIndex,
+                                                                                const   std::size_t                 aParallelDepth                              ) ;
+
 } ;
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -211,6 +269,26 @@ Polygon2d                       MultiPolygon::Impl::getConvexHull           ( )
 
 }
 
+MultiPolygon::Impl              MultiPolygon::Impl::intersectionWith        (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const
+{
+
+    try
+    {
+
+        MultiPolygon::Impl multiPolygonIntersection ;
+
+        boost::geometry::intersection(multiPolygon_, aMultiPolygon.multiPolygon_, multiPolygonIntersection.multiPolygon_) ;
+
+        return multiPolygonIntersection ;
+
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot compute intersection of multi-polygons: [{}].", anException.what()) ;
+    }
+
+}
+
 MultiPolygon::Impl              MultiPolygon::Impl::unionWith               (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const
 {
 
@@ -231,6 +309,89 @@ MultiPolygon::Impl              MultiPolygon::Impl::unionWith               (
 
 }
 
+MultiPolygon::Impl              MultiPolygon::Impl::differenceWith          (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const
+{
+
+    try
+    {
+
+        MultiPolygon::Impl multiPolygonDifference ;
+
+        boost::geometry::difference(multiPolygon_, aMultiPolygon.multiPolygon_, multiPolygonDifference.multiPolygon_) ;
+
+        return multiPolygonDifference ;
+
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot compute difference of multi-polygons: [{}].", anException.what()) ;
+    }
+
+}
+
+MultiPolygon::Impl              MultiPolygon::Impl::symmetricDifferenceWith (   const   MultiPolygon::Impl&         aMultiPolygon                               ) const
+{
+
+    try
+    {
+
+        MultiPolygon::Impl multiPolygonSymmetricDifference ;
+
+        boost::geometry::sym_difference(multiPolygon_, aMultiPolygon.multiPolygon_, multiPolygonSymmetricDifference.multiPolygon_) ;
+
+        return multiPolygonSymmetricDifference ;
+
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot compute symmetric difference of multi-polygons: [{}].", anException.what()) ;
+    }
+
+}
+
+MultiPolygon::Impl              MultiPolygon::Impl::clip                    (   const   Polygon2d&                  aPolygon,
+                                                                                const   Array<Index>&               aPolygonIndexArray                          ) const
+{
+
+    const MultiPolygon::Impl::BoostMultiPolygon boostMultiPolygon = MultiPolygon::Impl::BoostMultiPolygonFromPolygons({ aPolygon }) ;
+
+    try
+    {
+
+        MultiPolygon::Impl clippedMultiPolygon ;
+
+        if (aPolygonIndexArray.getSize() == multiPolygon_.size())
+        {
+            boost::geometry::intersection(boostMultiPolygon, multiPolygon_, clippedMultiPolygon.multiPolygon_) ;
+        }
+        else
+        {
+
+            // Only keep the clipper polygons that may overlap the polygon
+
+            MultiPolygon::Impl::BoostMultiPolygon clipper ;
+
+            clipper.reserve(aPolygonIndexArray.getSize()) ;
+
+            for (const auto& polygonIndex : aPolygonIndexArray)
+            {
+                clipper.push_back(multiPolygon_[polygonIndex]) ;
+            }
+
+            boost::geometry::intersection(boostMultiPolygon, clipper, clippedMultiPolygon.multiPolygon_) ;
+
+        }
+
+        return clippedMultiPolygon ;
+
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot clip polygon: [{}].", anException.what()) ;
+    }
+
+}
+
 String                          MultiPolygon::Impl::toString                (   const   Object::Format&             aFormat,
                                                                                 const   Integer&                    aPrecision                                  ) const
 {
@@ -286,6 +447,90 @@ void                            MultiPolygon::Impl::applyTransformation     (
 
 }
 
+MultiPolygon::Impl              MultiPolygon::Impl::Union                   (   const   Array<Polygon2d>&           aPolygonArray                               )
+{
+
+    const MultiPolygon::Impl::BoostMultiPolygon boostMultiPolygon = MultiPolygon::Impl::BoostMultiPolygonFromPolygons(aPolygonArray) ;
+
+    // Sort polygons along a Morton curve over their bounding box centers, so that subtrees gather neighbouring polygons
+
+    std::vector<std::pair<double, double>> centers ;
+
+    centers.reserve(boostMultiPolygon.size()) ;
+
+    double minimumX = std::numeric_limits<double>::infinity() ;
+    double minimumY = std::numeric_limits<double>::infinity() ;
+    double maximumX = -std::numeric_limits<double>::infinity() ;
+    double maximumY = -std::numeric_limits<double>::infinity() ;
+
+    for (const auto& boostPolygon : boostMultiPolygon)
+    {
+
+        const auto box = boost::geometry::return_envelope<boost::geometry::model::box<MultiPolygon::Impl::BoostPoint>>(boostPolygon) ;
+
+        minimumX = std::min(minimumX, box.min_corner().get<0>()) ;
+        minimumY = std::min(minimumY, box.min_corner().get<1>()) ;
+        maximumX = std::max(maximumX, box.max_corner().get<0>()) ;
+        maximumY = std::max(maximumY, box.max_corner().get<1>()) ;
+
+        centers.emplace_back(0.5 * (box.min_corner().get<0>() + box.max_corner().get<0>()), 0.5 * (box.min_corner().get<1>() + box.max_corner().get<1>())) ;
+
+    }
+
+    const double scaleX = 65535.0 / std::max(maximumX - minimumX, std::numeric_limits<double>::min()) ;
+    const double scaleY = 65535.0 / std::max(maximumY - minimumY, std::numeric_limits<double>::min()) ;
+
+    std::vector<std::pair<std::uint32_t, std::size_t>> codes ;
+
+    codes.reserve(centers.size()) ;
+
+    for (std::size_t polygonIndex = 0; polygonIndex < centers.size(); ++polygonIndex)
+    {
+
+        const double centerX = centers[polygonIndex].first ;
+        const double centerY = centers[polygonIndex].second ;
+
+        const std::uint32_t code = SpreadBits(static_cast<std::uint32_t>((centerX - minimumX) * scaleX)) | (SpreadBits(static_cast<std::uint32_t>((centerY - minimumY) * scaleY)) << 1) ;
+
+        codes.emplace_back(code, polygonIndex) ;
+
+    }
+
+    std::sort(codes.begin(), codes.end()) ;
+
+    std::vector<MultiPolygon::Impl::BoostMultiPolygon> multiPolygons ;
+
+    multiPolygons.reserve(codes.size()) ;
+
+    for (const auto& code : codes)
+    {
+        multiPolygons.push_back({ boostMultiPolygon[code.second] }) ;
+    }
+
+    std::size_t parallelDepth = 0 ;
+
+    while ((std::size_t(1) << parallelDepth) < std::thread::hardware_concurrency())
+    {
+        ++parallelDepth ;
+    }
+
+    try
+    {
+
+        MultiPolygon::Impl multiPolygonUnion ;
+
+        multiPolygonUnion.multiPolygon_ = MultiPolygon::Impl::CascadedUnion(multiPolygons, 0, multiPolygons.size(), parallelDepth) ;
+
+        return multiPolygonUnion ;
+
+    }
+    catch (const std::exception& anException)
+    {
+        throw ostk::core::error::RuntimeError("Cannot compute union of polygons: [{}].", anException.what()) ;
+    }
+
+}
+
 MultiPolygon::Impl::BoostMultiPolygon MultiPolygon::Impl::BoostMultiPolygonFromPolygons ( const Array<Polygon2d>&   aPolygonArray                               )
 {
 
@@ -359,20 +604,72 @@ Polygon2d                       MultiPolygon::Impl::PolygonFromBoostPolygon (
 
 }
 
+MultiPolygon::Impl::BoostMultiPolygon MultiPolygon::Impl::CascadedUnion     (   const   std::vector<Impl::BoostMultiPolygon>& aMultiPolygonArray,
+                                                                                const   std::size_t                 aBeginIndex,
+                                                                                const   std::size_t                 anEndIndex,
+                                                                                const   std::size_t                 aParallelDepth                              )
+{
+
+    if ((anEndIndex - aBeginIndex) == 1)
+    {
+        return aMultiPolygonArray[aBeginIndex] ;
+    }
+
+    const std::size_t middleIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2 ;
+
+    MultiPolygon::Impl::BoostMultiPolygon lowerUnion ;
+    MultiPolygon::Impl::BoostMultiPolygon upperUnion ;
+
+    if ((aParallelDepth > 0) && ((anEndIndex - aBeginIndex) >= ParallelThreshold))
+    {
+
+        std::future<Impl::BoostMultiPolygon> lowerFuture = std::async(std::launch::async, [&aMultiPolygonArray, aBeginIndex, middleIndex, aParallelDepth] () -> Impl::BoostMultiPolygon { return MultiPolygon::Impl::CascadedUnion(aMultiPolygonArray, aBeginIndex, middleIndex, aParallelDepth - 1) ; }) ;
+
+        upperUnion = MultiPolygon::Impl::CascadedUnion(aMultiPolygonArray, middleIndex, anEndIndex, aParallelDepth - 1) ;
+        lowerUnion = lowerFuture.get() ;
+
+    }
+    else
+    {
+
+        lowerUnion = MultiPolygon::Impl::CascadedUnion(aMultiPolygonArray, aBeginIndex, middleIndex, 0) ;
+        upperUnion = MultiPolygon::Impl::CascadedUnion(aMultiPolygonArray, middleIndex, anEndIndex, 0) ;
+
+    }
+
+    MultiPolygon::Impl::BoostMultiPolygon multiPolygonUnion ;
+
+    boost::geometry::union_(lowerUnion, upperUnion, multiPolygonUnion) ;
+
+    return multiPolygonUnion ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 MultiPolygon::MultiPolygon                  (   const   Array<Polygon2d>&           aPolygonArray                               )
                                 :   Object(),
-                                    implUPtr_(std::make_unique<MultiPolygon::Impl>(aPolygonArray))
+                                    implUPtr_(std::make_unique<MultiPolygon::Impl>(aPolygonArray)),
+                                    indexSPtr_(nullptr),
+                                    polygonsSPtr_(nullptr),
+                                    indexMutex_()
 {
 
 }
 
                                 MultiPolygon::MultiPolygon                  (   const   MultiPolygon&               aMultiPolygon                               )
                                 :   Object(aMultiPolygon),
-                                    implUPtr_((aMultiPolygon.implUPtr_ != nullptr) ? new MultiPolygon::Impl(*aMultiPolygon.implUPtr_) : nullptr)
+                                    implUPtr_((aMultiPolygon.implUPtr_ != nullptr) ? new MultiPolygon::Impl(*aMultiPolygon.implUPtr_) : nullptr),
+                                    indexSPtr_(nullptr),
+                                    polygonsSPtr_(nullptr),
+                                    indexMutex_()
 {
 
+    const std::lock_guard<std::mutex> lock { aMultiPolygon.indexMutex_ } ;
+
+    indexSPtr_ = aMultiPolygon.indexSPtr_ ;
+    polygonsSPtr_ = aMultiPolygon.polygonsSPtr_ ;
+
 }
 
                                 MultiPolygon::~MultiPolygon                 ( )
@@ -390,6 +687,11 @@ MultiPolygon&                   MultiPolygon::operator =                    (
 
         implUPtr_.reset((aMultiPolygon.implUPtr_ != nullptr) ? new MultiPolygon::Impl(*aMultiPolygon.implUPtr_) : nullptr) ;
 
+        const std::scoped_lock lock { indexMutex_, aMultiPolygon.indexMutex_ } ;
+
+        indexSPtr_ = aMultiPolygon.indexSPtr_ ;
+        polygonsSPtr_ = aMultiPolygon.polygonsSPtr_ ;
+
     }
 
     return *this ;
@@ -436,6 +738,11 @@ bool                            MultiPolygon::contains                      (
         throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
     }
 
+    if (const Shared<const PolygonIndex> indexSPtr = this->accessIndex(false))
+    {
+        return indexSPtr->contains(aPoint) ;
+    }
+
     return implUPtr_->contains(aPoint) ;
 
 }
@@ -457,6 +764,44 @@ bool                            MultiPolygon::contains                      (
 
 }
 
+VectorXb                        MultiPolygon::containsPoints                (   const   Matrix2Xd&                  aPointArray                                 ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    if (const Shared<const PolygonIndex> indexSPtr = this->accessIndex(false))
+    {
+        return indexSPtr->containsPoints(aPointArray) ;
+    }
+
+    VectorXb mask = VectorXb::Constant(aPointArray.cols(), false) ;
+
+    // Polygons are kept across calls, along with the edge indexes they build on first use
+
+    for (const auto& polygon : *this->accessPolygons())
+    {
+        mask = mask.array() || polygon.containsPoints(aPointArray).array() ;
+    }
+
+    return mask ;
+
+}
+
+void                            MultiPolygon::buildIndex                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    this->accessIndex(true) ;
+
+}
+
 Size                            MultiPolygon::getPolygonCount               ( ) const
 {
 
@@ -493,6 +838,27 @@ Polygon2d                       MultiPolygon::getConvexHull                 ( )
 
 }
 
+MultiPolygon                    MultiPolygon::intersectionWith              (   const   MultiPolygon&               aMultiPolygon                               ) const
+{
+
+    if (!aMultiPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    MultiPolygon intersectionMultiPolygon = MultiPolygon::Undefined() ;
+
+    intersectionMultiPolygon.implUPtr_ = std::make_unique<MultiPolygon::Impl>(implUPtr_->intersectionWith(*aMultiPolygon.implUPtr_)) ;
+
+    return intersectionMultiPolygon ;
+
+}
+
 MultiPolygon                    MultiPolygon::unionWith                     (   const   MultiPolygon&               aMultiPolygon                               ) const
 {
 
@@ -516,6 +882,144 @@ MultiPolygon                    MultiPolygon::unionWith                     (
 
 }
 
+MultiPolygon                    MultiPolygon::differenceWith                (   const   MultiPolygon&               aMultiPolygon                               ) const
+{
+
+    if (!aMultiPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    MultiPolygon differenceMultiPolygon = MultiPolygon::Undefined() ;
+
+    differenceMultiPolygon.implUPtr_ = std::make_unique<MultiPolygon::Impl>(implUPtr_->differenceWith(*aMultiPolygon.implUPtr_)) ;
+
+    return differenceMultiPolygon ;
+
+}
+
+MultiPolygon                    MultiPolygon::symmetricDifferenceWith       (   const   MultiPolygon&               aMultiPolygon                               ) const
+{
+
+    if (!aMultiPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    MultiPolygon symmetricDifferenceMultiPolygon = MultiPolygon::Undefined() ;
+
+    symmetricDifferenceMultiPolygon.implUPtr_ = std::make_unique<MultiPolygon::Impl>(implUPtr_->symmetricDifferenceWith(*aMultiPolygon.implUPtr_)) ;
+
+    return symmetricDifferenceMultiPolygon ;
+
+}
+
+Array<MultiPolygon>             MultiPolygon::clip                          (   const   Array<Polygon2d>&           aPolygonArray                               ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    for (const auto& polygon : aPolygonArray)
+    {
+
+        if (!polygon.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Polygon") ;
+        }
+
+    }
+
+    const Shared<const PolygonIndex> indexSPtr = this->accessIndex(true) ;
+
+    Array<MultiPolygon> clippedMultiPolygons = Array<MultiPolygon>::Empty() ;
+
+    clippedMultiPolygons.reserve(aPolygonArray.getSize()) ;
+
+    for (const auto& polygon : aPolygonArray)
+    {
+
+        const Array<Index> polygonIndices = indexSPtr->getPolygonIndicesOverlapping(polygon) ;
+
+        MultiPolygon clippedMultiPolygon = MultiPolygon::Undefined() ;
+
+        if (!polygonIndices.isEmpty())
+        {
+            clippedMultiPolygon.implUPtr_ = std::make_unique<MultiPolygon::Impl>(implUPtr_->clip(polygon, polygonIndices)) ;
+        }
+
+        clippedMultiPolygons.add(clippedMultiPolygon) ;
+
+    }
+
+    return clippedMultiPolygons ;
+
+}
+
+MultiPolygon                    MultiPolygon::simplify                      (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Multi-polygon") ;
+    }
+
+    const Array<Polygon2d> polygons = implUPtr_->getPolygons() ;
+
+    Array<LineString> rings = Array<LineString>::Empty() ;
+
+    for (const auto& polygon : polygons)
+    {
+
+        rings.add(polygon.getOuterRing()) ;
+
+        for (Index innerRingIndex = 0; innerRingIndex < polygon.getInnerRingCount(); ++innerRingIndex)
+        {
+            rings.add(polygon.getInnerRingAt(innerRingIndex)) ;
+        }
+
+    }
+
+    const Array<LineString> simplifiedRings = LineString::Simplify(rings, aTolerance, aMethod, preserveTopology) ;
+
+    Array<Polygon2d> simplifiedPolygons = Array<Polygon2d>::Empty() ;
+
+    Index ringIndex = 0 ;
+
+    for (const auto& polygon : polygons)
+    {
+
+        const Array<Point> outerRing = rings::VerticesOf(simplifiedRings[ringIndex++]) ;
+
+        Array<Array<Point>> innerRings = Array<Array<Point>>::Empty() ;
+
+        for (Index innerRingIndex = 0; innerRingIndex < polygon.getInnerRingCount(); ++innerRingIndex)
+        {
+            innerRings.add(rings::VerticesOf(simplifiedRings[ringIndex++])) ;
+        }
+
+        simplifiedPolygons.add(Polygon2d { outerRing, innerRings }) ;
+
+    }
+
+    return { simplifiedPolygons } ;
+
+}
+
 String                          MultiPolygon::toString                      (   const   Object::Format&             aFormat,
                                                                                 const   Integer&                    aPrecision                                  ) const
 {
@@ -578,6 +1082,11 @@ void                            MultiPolygon::applyTransformation           (
 
     implUPtr_->applyTransformation(aTransformation) ;
 
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    indexSPtr_.reset() ;
+    polygonsSPtr_.reset() ;
+
 }
 
 MultiPolygon                    MultiPolygon::Undefined                     ( )
@@ -590,6 +1099,60 @@ MultiPolygon                    MultiPolygon::Polygon                       (
     return { Array<Polygon2d> { aPolygon } } ;
 }
 
+MultiPolygon                    MultiPolygon::Union                         (   const   Array<Polygon2d>&           aPolygonArray                               )
+{
+
+    for (const auto& polygon : aPolygonArray)
+    {
+
+        if (!polygon.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Polygon") ;
+        }
+
+    }
+
+    if (aPolygonArray.isEmpty())
+    {
+        return MultiPolygon::Undefined() ;
+    }
+
+    MultiPolygon unionMultiPolygon = MultiPolygon::Undefined() ;
+
+    unionMultiPolygon.implUPtr_ = std::make_unique<MultiPolygon::Impl>(MultiPolygon::Impl::Union(aPolygonArray)) ;
+
+    return unionMultiPolygon ;
+
+}
+
+Shared<const PolygonIndex>      MultiPolygon::accessIndex                   (           bool                        aForce                                      ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if ((indexSPtr_ == nullptr) && (aForce || (implUPtr_->getPolygonCount() > IndexingThreshold)))
+    {
+        indexSPtr_ = std::make_shared<const PolygonIndex>(implUPtr_->getPolygons()) ;
+    }
+
+    return indexSPtr_ ;
+
+}
+
+Shared<const Array<Polygon2d>>  MultiPolygon::accessPolygons                ( ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (polygonsSPtr_ == nullptr)
+    {
+        polygonsSPtr_ = std::make_shared<const Array<Polygon2d>>(implUPtr_->getPolygons()) ;
+    }
+
+    return polygonsSPtr_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -10,6 +10,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Ring.hpp>
 
 #include <OpenSpaceToolkit/Core/Types/String.hpp>
 #include <OpenSpaceToolkit/Core/Types/Size.hpp>
@@ -25,6 +26,11 @@
 #include <boost/geometry.hpp>
 #include <boost/numeric/ublas/matrix.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -49,6 +55,21 @@ using ostk::core::types::Index ;
 using ostk::core::types::Size ;
 using ostk::core::types::String ;
 
+using ostk::math::obj::Vector2d ;
+using ostk::math::obj::VectorXb ;
+using ostk::math::obj::Matrix2Xd ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Polygons with fewer edges than this are tested linearly, unless an index is built explicitly
+
+constexpr std::size_t IndexingThreshold = 64 ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 class Polygon::Impl
@@ -511,21 +532,291 @@ Polygon                         Polygon::Impl::PolygonFromBoostPolygon      (
 
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Interval tree over the vertical extents of the edges of a polygon
+///
+///                             Each node splits the plane along a horizontal line, at the median height of its edges: the edges crossing that
+///                             line are kept in the node, sorted once by increasing lower bound and once by decreasing upper bound, and the others
+///                             go down to the lower or upper child. The edges crossing the horizontal line through a point are thus found by walking
+///                             a single path down the tree, scanning at each node only the edges which actually cross it.
+///
+///                             Containment then counts the crossings on the right of the point, over all rings (even-odd rule).
+///                             Points lying on an edge are contained, as with boost::geometry::covered_by.
+
+class Polygon::EdgeIndex
+{
+
+    public:
+
+                                EdgeIndex                                   (   const   Polygon::Impl&              aPolygon                                    ) ;
+
+        bool                    contains                                    (   const   Vector2d&                   aPoint                                      ) const ;
+
+    private:
+
+        struct Edge
+        {
+
+            Vector2d            firstVertex ;
+            Vector2d            secondVertex ;
+            double              minimumY ;
+            double              maximumY ;
+
+        } ;
+
+        struct Node
+        {
+
+            double              splitY ;
+            std::size_t         beginIndex ;
+            std::size_t         endIndex ;
+            std::size_t         lowerIndex ;
+            std::size_t         upperIndex ;
+
+        } ;
+
+        enum class Crossing
+        {
+
+            None,
+            Right,
+            Boundary
+
+        } ;
+
+        static constexpr std::size_t NoNode = std::numeric_limits<std::size_t>::max() ;
+
+        Vector2d                minimum_ ;
+        Vector2d                maximum_ ;
+
+        std::vector<Edge>       edgesByMinimum_ ;
+        std::vector<Edge>       edgesByMaximum_ ;
+        std::vector<Node>       nodes_ ;
+
+        std::size_t             build                                       (           std::vector<Edge>&&         anEdgeArray                                 ) ;
+
+        static EdgeIndex::Crossing Cross                                    (   const   Edge&                       anEdge,
+                                                                                const   Vector2d&                   aPoint                                      ) ;
+
+} ;
+
+                                Polygon::EdgeIndex::EdgeIndex               (   const   Polygon::Impl&              aPolygon                                    )
+                                :   minimum_(Vector2d::Constant(std::numeric_limits<double>::infinity())),
+                                    maximum_(Vector2d::Constant(-std::numeric_limits<double>::infinity())),
+                                    edgesByMinimum_(),
+                                    edgesByMaximum_(),
+                                    nodes_()
+{
+
+    std::vector<Edge> edges ;
+
+    edges.reserve(aPolygon.getEdgeCount()) ;
+
+    const auto addRing = [&edges, this] (const Array<Point>& aVertexArray) -> void
+    {
+
+        for (std::size_t vertexIndex = 0; vertexIndex < aVertexArray.getSize(); ++vertexIndex)
+        {
+
+            const Vector2d firstVertex = aVertexArray[vertexIndex].asVector() ;
+            const Vector2d secondVertex = aVertexArray[(vertexIndex + 1) % aVertexArray.getSize()].asVector() ;
+
+            edges.push_back({ firstVertex, secondVertex, std::min(firstVertex.y(), secondVertex.y()), std::max(firstVertex.y(), secondVertex.y()) }) ;
+
+            minimum_ = minimum_.cwiseMin(firstVertex) ;
+            maximum_ = maximum_.cwiseMax(firstVertex) ;
+
+        }
+
+    } ;
+
+    addRing(aPolygon.getOuterRingVertices()) ;
+
+    for (Index innerRingIndex = 0; innerRingIndex < aPolygon.getInnerRingCount(); ++innerRingIndex)
+    {
+        addRing(aPolygon.getInnerRingVerticesAt(innerRingIndex)) ;
+    }
+
+    edgesByMinimum_.reserve(edges.size()) ;
+    edgesByMaximum_.reserve(edges.size()) ;
+
+    this->build(std::move(edges)) ;
+
+}
+
+bool                            Polygon::EdgeIndex::contains                (   const   Vector2d&                   aPoint                                      ) const
+{
+
+    if ((aPoint.array() < minimum_.array()).any() || (aPoint.array() > maximum_.array()).any())
+    {
+        return false ;
+    }
+
+    bool isInside = false ;
+
+    std::size_t nodeIndex = nodes_.empty() ? NoNode : 0 ;
+
+    while (nodeIndex != NoNode)
+    {
+
+        const Node& node = nodes_[nodeIndex] ;
+
+        const bool isBelow = aPoint.y() < node.splitY ;
+        const bool isAbove = aPoint.y() > node.splitY ;
+
+        for (std::size_t edgeIndex = node.beginIndex; edgeIndex < node.endIndex; ++edgeIndex)
+        {
+
+            const Edge& edge = isAbove ? edgesByMaximum_[edgeIndex] : edgesByMinimum_[edgeIndex] ;
+
+            if ((isBelow && (edge.minimumY > aPoint.y())) || (isAbove && (edge.maximumY < aPoint.y())))
+            {
+                break ;
+            }
+
+            switch (EdgeIndex::Cross(edge, aPoint))
+            {
+
+                case EdgeIndex::Crossing::Right:
+                    isInside = !isInside ;
+                    break ;
+
+                case EdgeIndex::Crossing::Boundary:
+                    return true ;
+
+                default:
+                    break ;
+
+            }
+
+        }
+
+        nodeIndex = isBelow ? node.lowerIndex : (isAbove ? node.upperIndex : NoNode) ;
+
+    }
+
+    return isInside ;
+
+}
+
+std::size_t                     Polygon::EdgeIndex::build                   (           std::vector<Edge>&&         anEdgeArray                                 )
+{
+
+    if (anEdgeArray.empty())
+    {
+        return NoNode ;
+    }
+
+    const auto middleY = [] (const Edge& anEdge) -> double { return anEdge.minimumY + (anEdge.maximumY - anEdge.minimumY) / 2.0 ; } ;
+
+    const auto median = anEdgeArray.begin() + (anEdgeArray.size() / 2) ;
+
+    std::nth_element(anEdgeArray.begin(), median, anEdgeArray.end(), [&middleY] (const Edge& anEdge, const Edge& anotherEdge) { return middleY(anEdge) < middleY(anotherEdge) ; }) ;
+
+    const double splitY = middleY(*median) ;
+
+    std::vector<Edge> lowerEdges ;
+    std::vector<Edge> upperEdges ;
+
+    const std::size_t beginIndex = edgesByMinimum_.size() ;
+
+    for (const auto& edge : anEdgeArray)
+    {
+
+        if (edge.maximumY < splitY)
+        {
+            lowerEdges.push_back(edge) ;
+        }
+        else if (edge.minimumY > splitY)
+        {
+            upperEdges.push_back(edge) ;
+        }
+        else
+        {
+
+            edgesByMinimum_.push_back(edge) ;
+            edgesByMaximum_.push_back(edge) ;
+
+        }
+
+    }
+
+    const std::size_t endIndex = edgesByMinimum_.size() ;
+
+    std::sort(edgesByMinimum_.begin() + beginIndex, edgesByMinimum_.end(), [] (const Edge& anEdge, const Edge& anotherEdge) { return anEdge.minimumY < anotherEdge.minimumY ; }) ;
+    std::sort(edgesByMaximum_.begin() + beginIndex, edgesByMaximum_.end(), [] (const Edge& anEdge, const Edge& anotherEdge) { return anEdge.maximumY > anotherEdge.maximumY ; }) ;
+
+    anEdgeArray.clear() ;
+    anEdgeArray.shrink_to_fit() ;
+
+    const std::size_t nodeIndex = nodes_.size() ;
+
+    nodes_.push_back({ splitY, beginIndex, endIndex, NoNode, NoNode }) ;
+
+    const std::size_t lowerIndex = this->build(std::move(lowerEdges)) ;
+    const std::size_t upperIndex = this->build(std::move(upperEdges)) ;
+
+    nodes_[nodeIndex].lowerIndex = lowerIndex ;
+    nodes_[nodeIndex].upperIndex = upperIndex ;
+
+    return nodeIndex ;
+
+}
+
+Polygon::EdgeIndex::Crossing    Polygon::EdgeIndex::Cross                   (   const   Edge&                       anEdge,
+                                                                                const   Vector2d&                   aPoint                                      )
+{
+
+    const Vector2d& firstVertex = anEdge.firstVertex ;
+    const Vector2d& secondVertex = anEdge.secondVertex ;
+
+    const double side = (secondVertex.x() - firstVertex.x()) * (aPoint.y() - firstVertex.y()) - (aPoint.x() - firstVertex.x()) * (secondVertex.y() - firstVertex.y()) ;
+
+    if ((side == 0.0) && (aPoint.x() >= std::min(firstVertex.x(), secondVertex.x())) && (aPoint.x() <= std::max(firstVertex.x(), secondVertex.x())))
+    {
+        return EdgeIndex::Crossing::Boundary ;
+    }
+
+    // Half-open rule: a vertex lying on the horizontal line through the point only counts for the edge leaving upward
+
+    if ((firstVertex.y() > aPoint.y()) != (secondVertex.y() > aPoint.y()))
+    {
+
+        if ((secondVertex.y() > firstVertex.y()) ? (side > 0.0) : (side < 0.0))
+        {
+            return EdgeIndex::Crossing::Right ;
+        }
+
+    }
+
+    return EdgeIndex::Crossing::None ;
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 Polygon::Polygon                            (   const   Array<Point>&               anOuterRing,
                                                                                 const   Array<Array<Point>>&        anInnerRingArray                            )
                                 :   Object(),
-                                    implUPtr_(std::make_unique<Polygon::Impl>(anOuterRing, anInnerRingArray))
+                                    implUPtr_(std::make_unique<Polygon::Impl>(anOuterRing, anInnerRingArray)),
+                                    indexSPtr_(nullptr),
+                                    indexMutex_()
 {
 
 }
 
                                 Polygon::Polygon                            (   const   Polygon&                    aPolygon                                    )
                                 :   Object(aPolygon),
-                                    implUPtr_((aPolygon.implUPtr_ != nullptr) ? new Polygon::Impl(*aPolygon.implUPtr_) : nullptr)
+                                    implUPtr_((aPolygon.implUPtr_ != nullptr) ? new Polygon::Impl(*aPolygon.implUPtr_) : nullptr),
+                                    indexSPtr_(nullptr),
+                                    indexMutex_()
 {
 
+    const std::lock_guard<std::mutex> lock { aPolygon.indexMutex_ } ;
+
+    indexSPtr_ = aPolygon.indexSPtr_ ;
+
 }
 
                                 Polygon::~Polygon                           ( )
@@ -543,6 +834,10 @@ Polygon&                        Polygon::operator =                         (
 
         implUPtr_.reset((aPolygon.implUPtr_ != nullptr) ? new Polygon::Impl(*aPolygon.implUPtr_) : nullptr) ;
 
+        const std::scoped_lock lock { indexMutex_, aPolygon.indexMutex_ } ;
+
+        indexSPtr_ = aPolygon.indexSPtr_ ;
+
     }
 
     return *this ;
@@ -648,6 +943,11 @@ bool                            Polygon::contains                           (
         throw ostk::core::error::runtime::Undefined("Polygon") ;
     }
 
+    if (const Shared<const Polygon::EdgeIndex> indexSPtr = this->accessIndex(false))
+    {
+        return indexSPtr->contains(aPoint.asVector()) ;
+    }
+
     return implUPtr_->contains(aPoint) ;
 
 }
@@ -665,10 +965,62 @@ bool                            Polygon::contains                           (
         throw ostk::core::error::runtime::Undefined("Polygon") ;
     }
 
+    if (const Shared<const Polygon::EdgeIndex> indexSPtr = this->accessIndex(false))
+    {
+
+        for (const auto& point : aPointSet)
+        {
+
+            if (!indexSPtr->contains(point.asVector()))
+            {
+                return false ;
+            }
+
+        }
+
+        return true ;
+
+    }
+
     return implUPtr_->contains(aPointSet) ;
 
 }
 
+VectorXb                        Polygon::containsPoints                     (   const   Matrix2Xd&                  aPointArray                                 ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    // The index is always worth building for a batch: its cost is amortized over the points
+
+    const Shared<const Polygon::EdgeIndex> indexSPtr = this->accessIndex(true) ;
+
+    VectorXb mask = VectorXb::Constant(aPointArray.cols(), false) ;
+
+    for (Eigen::Index pointIndex = 0; pointIndex < aPointArray.cols(); ++pointIndex)
+    {
+        mask(pointIndex) = indexSPtr->contains(aPointArray.col(pointIndex)) ;
+    }
+
+    return mask ;
+
+}
+
+void                            Polygon::buildIndex                         ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    this->accessIndex(true) ;
+
+}
+
 Size                            Polygon::getInnerRingCount                  ( ) const
 {
 
@@ -838,17 +1190,17 @@ void                            Polygon::print                              (
 
 }
 
-// Intersection                    Polygon::intersectionWith                   (   const   Polygon&                    aPolygon                                    ) const
-// {
+MultiPolygon                    Polygon::intersectionWith                   (   const   Polygon&                    aPolygon                                    ) const
+{
 
-//     if ((!this->isDefined()) || (!aPolygon.isDefined()))
-//     {
-//         throw ostk::core::error::runtime::Undefined("Polygon") ;
-//     }
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
 
-//     return implUPtr_->intersectionWith(aPolygon) ;
+    return MultiPolygon::Polygon(*this).intersectionWith(MultiPolygon::Polygon(aPolygon)) ;
 
-// }
+}
 
 MultiPolygon                    Polygon::unionWith                          (   const   Polygon&                    aPolygon                                    ) const
 {
@@ -862,6 +1214,60 @@ MultiPolygon                    Polygon::unionWith                          (
 
 }
 
+MultiPolygon                    Polygon::differenceWith                     (   const   Polygon&                    aPolygon                                    ) const
+{
+
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    return MultiPolygon::Polygon(*this).differenceWith(MultiPolygon::Polygon(aPolygon)) ;
+
+}
+
+MultiPolygon                    Polygon::symmetricDifferenceWith            (   const   Polygon&                    aPolygon                                    ) const
+{
+
+    if ((!this->isDefined()) || (!aPolygon.isDefined()))
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    return MultiPolygon::Polygon(*this).symmetricDifferenceWith(MultiPolygon::Polygon(aPolygon)) ;
+
+}
+
+Polygon                         Polygon::simplify                           (   const   Real&                       aTolerance,
+                                                                                const   LineString::SimplificationMethod& aMethod,
+                                                                                        bool                        preserveTopology                            ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    Array<LineString> rings = { implUPtr_->getOuterRing() } ;
+
+    for (Index innerRingIndex = 0; innerRingIndex < implUPtr_->getInnerRingCount(); ++innerRingIndex)
+    {
+        rings.add(implUPtr_->getInnerRingAt(innerRingIndex)) ;
+    }
+
+    const Array<LineString> simplifiedRings = LineString::Simplify(rings, aTolerance, aMethod, preserveTopology) ;
+
+    Array<Array<Point>> innerRings = Array<Array<Point>>::Empty() ;
+
+    for (Index ringIndex = 1; ringIndex < simplifiedRings.getSize(); ++ringIndex)
+    {
+        innerRings.add(rings::VerticesOf(simplifiedRings[ringIndex])) ;
+    }
+
+    return { rings::VerticesOf(simplifiedRings.accessFirst()), innerRings } ;
+
+}
+
 String                          Polygon::toString                           (   const   Object::Format&             aFormat,
                                                                                 const   Integer&                    aPrecision                                  ) const
 {
@@ -890,6 +1296,10 @@ void                            Polygon::applyTransformation                (
 
     implUPtr_->applyTransformation(aTransformation) ;
 
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    indexSPtr_.reset() ;
+
 }
 
 Polygon                         Polygon::Undefined                          ( )
@@ -897,6 +1307,20 @@ Polygon                         Polygon::Undefined                          ( )
     return { Array<Point>::Empty() } ;
 }
 
+Shared<const Polygon::EdgeIndex> Polygon::accessIndex                       (           bool                        aForce                                      ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if ((indexSPtr_ == nullptr) && (aForce || (implUPtr_->getEdgeCount() > IndexingThreshold)))
+    {
+        indexSPtr_ = std::make_shared<const Polygon::EdgeIndex>(*implUPtr_) ;
+    }
+
+    return indexSPtr_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -0,0 +1,60 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Ring.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Ring.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d2
+{
+namespace objects
+{
+namespace rings
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Index ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Array<Point>                    VerticesOf                                  (   const   LineString&                 aRing                                       )
+{
+
+    Array<Point> vertices = Array<Point>::Empty() ;
+
+    vertices.reserve(aRing.getPointCount()) ;
+
+    for (Index pointIndex = 0; (pointIndex + 1) < aRing.getPointCount(); ++pointIndex)
+    {
+        vertices.add(aRing.accessPointAt(pointIndex)) ;
+    }
+
+    return vertices ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,477 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <boost/geometry/index/rtree.hpp>
+#include <boost/geometry/geometries/box.hpp>
+#include <boost/geometry/geometries/point.hpp>
+#include <boost/geometry.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d2
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      R-tree over the bounding boxes of the polygons of an index
+///
+///                             Values are (bounding box, polygon index) pairs. The R*-tree split is used for insertions, while bulk loading
+///                             packs the initial polygons into nodes of neighbouring boxes.
+
+class PolygonIndex::Tree
+{
+
+    public:
+
+        typedef                 boost::geometry::model::point<double, 2, boost::geometry::cs::cartesian> BoostPoint ;
+        typedef                 boost::geometry::model::box<Tree::BoostPoint>  BoostBox ;
+
+                                Tree                                        (   const   Array<Polygon>&             aPolygonArray                               ) ;
+
+        void                    insert                                      (   const   Polygon&                    aPolygon,
+                                                                                const   Index&                      anIndex                                     ) ;
+
+        template <typename Predicate, typename Visitor>
+        void                    query                                       (   const   Predicate&                  aPredicate,
+                                                                                        Visitor&&                   aVisitor                                    ) const ;
+
+        static Tree::BoostBox   BoxOf                                       (   const   Polygon&                    aPolygon                                    ) ;
+
+    private:
+
+        typedef                 std::pair<Tree::BoostBox, Index>                Value ;
+
+        boost::geometry::index::rtree<Tree::Value, boost::geometry::index::rstar<16>> rtree_ ;
+
+        static std::vector<Tree::Value> ValuesOf                            (   const   Array<Polygon>&             aPolygonArray                               ) ;
+
+} ;
+
+                                PolygonIndex::Tree::Tree                    (   const   Array<Polygon>&             aPolygonArray                               )
+                                :   rtree_(PolygonIndex::Tree::ValuesOf(aPolygonArray))
+{
+
+}
+
+void                            PolygonIndex::Tree::insert                  (   const   Polygon&                    aPolygon,
+                                                                                const   Index&                      anIndex                                     )
+{
+    rtree_.insert({ PolygonIndex::Tree::BoxOf(aPolygon), anIndex }) ;
+}
+
+/// @brief                      Visit the indices of the polygons whose bounding boxes satisfy a predicate
+///
+///                             The visitor returns false to stop the query.
+
+template <typename Predicate, typename Visitor>
+void                            PolygonIndex::Tree::query                   (   const   Predicate&                  aPredicate,
+                                                                                        Visitor&&                   aVisitor                                    ) const
+{
+
+    for (auto iterator = rtree_.qbegin(aPredicate); iterator != rtree_.qend(); ++iterator)
+    {
+
+        if (!aVisitor(iterator->second))
+        {
+            return ;
+        }
+
+    }
+
+}
+
+PolygonIndex::Tree::BoostBox    PolygonIndex::Tree::BoxOf                   (   const   Polygon&                    aPolygon                                    )
+{
+
+    // Inner rings lie within the outer ring
+
+    double minimumX = std::numeric_limits<double>::infinity() ;
+    double minimumY = std::numeric_limits<double>::infinity() ;
+    double maximumX = -std::numeric_limits<double>::infinity() ;
+    double maximumY = -std::numeric_limits<double>::infinity() ;
+
+    for (const auto& vertex : aPolygon.getOuterRing())
+    {
+
+        minimumX = std::min<double>(minimumX, vertex.x()) ;
+        minimumY = std::min<double>(minimumY, vertex.y()) ;
+        maximumX = std::max<double>(maximumX, vertex.x()) ;
+        maximumY = std::max<double>(maximumY, vertex.y()) ;
+
+    }
+
+    return { { minimumX, minimumY }, { maximumX, maximumY } } ;
+
+}
+
+std::vector<PolygonIndex::Tree::Value> PolygonIndex::Tree::ValuesOf         (   const   Array<Polygon>&             aPolygonArray                               )
+{
+
+    std::vector<Tree::Value> values ;
+
+    values.reserve(aPolygonArray.getSize()) ;
+
+    for (Index polygonIndex = 0; polygonIndex < aPolygonArray.getSize(); ++polygonIndex)
+    {
+        values.emplace_back(PolygonIndex::Tree::BoxOf(aPolygonArray[polygonIndex]), polygonIndex) ;
+    }
+
+    return values ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                PolygonIndex::PolygonIndex                  (   const   Array<Polygon>&             aPolygonArray                               )
+                                :   polygons_(aPolygonArray),
+                                    treeUPtr_(nullptr)
+{
+
+    for (const auto& polygon : polygons_)
+    {
+
+        if (!polygon.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Polygon") ;
+        }
+
+    }
+
+    treeUPtr_ = std::make_unique<PolygonIndex::Tree>(polygons_) ;
+
+}
+
+                                PolygonIndex::PolygonIndex                  (   const   MultiPolygon&               aMultiPolygon                               )
+                                :   PolygonIndex(aMultiPolygon.isDefined() ? aMultiPolygon.getPolygons() : Array<Polygon>::Empty())
+{
+
+}
+
+                                PolygonIndex::PolygonIndex                  (   const   PolygonIndex&               aPolygonIndex                               )
+                                :   polygons_(aPolygonIndex.polygons_),
+                                    treeUPtr_(std::make_unique<PolygonIndex::Tree>(*aPolygonIndex.treeUPtr_))
+{
+
+}
+
+                                PolygonIndex::PolygonIndex                  (           PolygonIndex&&              aPolygonIndex                               )
+                                :   polygons_(std::move(aPolygonIndex.polygons_)),
+                                    treeUPtr_(std::move(aPolygonIndex.treeUPtr_))
+{
+
+    aPolygonIndex.polygons_.clear() ;
+    aPolygonIndex.treeUPtr_ = std::make_unique<PolygonIndex::Tree>(aPolygonIndex.polygons_) ;
+
+}
+
+                                PolygonIndex::~PolygonIndex                 ( )
+{
+
+}
+
+PolygonIndex&                   PolygonIndex::operator =                    (   const   PolygonIndex&               aPolygonIndex                               )
+{
+
+    if (this != &aPolygonIndex)
+    {
+
+        polygons_ = aPolygonIndex.polygons_ ;
+        treeUPtr_ = std::make_unique<PolygonIndex::Tree>(*aPolygonIndex.treeUPtr_) ;
+
+    }
+
+    return *this ;
+
+}
+
+PolygonIndex&                   PolygonIndex::operator =                    (           PolygonIndex&&              aPolygonIndex                               )
+{
+
+    if (this != &aPolygonIndex)
+    {
+
+        polygons_ = std::move(aPolygonIndex.polygons_) ;
+        treeUPtr_ = std::move(aPolygonIndex.treeUPtr_) ;
+
+        aPolygonIndex.polygons_.clear() ;
+        aPolygonIndex.treeUPtr_ = std::make_unique<PolygonIndex::Tree>(aPolygonIndex.polygons_) ;
+
+    }
+
+    return *this ;
+
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   PolygonIndex&               aPolygonIndex                               )
+{
+
+    aPolygonIndex.print(anOutputStream, true) ;
+
+    return anOutputStream ;
+
+}
+
+bool                            PolygonIndex::isEmpty                       ( ) const
+{
+    return polygons_.isEmpty() ;
+}
+
+bool                            PolygonIndex::contains                      (   const   Point&                      aPoint                                      ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    bool isContained = false ;
+
+    treeUPtr_->query(boost::geometry::index::intersects(PolygonIndex::Tree::BoostPoint(aPoint.x(), aPoint.y())), [this, &aPoint, &isContained] (const Index& aPolygonIndex) -> bool
+    {
+
+        isContained = polygons_[aPolygonIndex].contains(aPoint) ;
+
+        return !isContained ;
+
+    }) ;
+
+    return isContained ;
+
+}
+
+VectorXb                        PolygonIndex::containsPoints                (   const   Matrix2Xd&                  aPointArray                                 ) const
+{
+
+    VectorXb mask = VectorXb::Constant(aPointArray.cols(), false) ;
+
+    // Points are bucketed by candidate polygon, so that each polygon tests its points in one batch
+
+    std::vector<std::vector<Eigen::Index>> candidatePointIndices(polygons_.getSize()) ;
+
+    for (Eigen::Index pointIndex = 0; pointIndex < aPointArray.cols(); ++pointIndex)
+    {
+
+        treeUPtr_->query(boost::geometry::index::intersects(PolygonIndex::Tree::BoostPoint(aPointArray(0, pointIndex), aPointArray(1, pointIndex))), [&candidatePointIndices, pointIndex] (const Index& aPolygonIndex) -> bool
+        {
+
+            candidatePointIndices[aPolygonIndex].push_back(pointIndex) ;
+
+            return true ;
+
+        }) ;
+
+    }
+
+    Matrix2Xd candidatePoints ;
+
+    for (Index polygonIndex = 0; polygonIndex < polygons_.getSize(); ++polygonIndex)
+    {
+
+        std::vector<Eigen::Index>& pointIndices = candidatePointIndices[polygonIndex] ;
+
+        // Points already found in another polygon are not tested again
+
+        pointIndices.erase(std::remove_if(pointIndices.begin(), pointIndices.end(), [&mask] (const Eigen::Index aPointIndex) -> bool { return mask(aPointIndex) ; }), pointIndices.end()) ;
+
+        if (pointIndices.empty())
+        {
+            continue ;
+        }
+
+        candidatePoints.resize(2, static_cast<Eigen::Index>(pointIndices.size())) ;
+
+        for (std::size_t candidateIndex = 0; candidateIndex < pointIndices.size(); ++candidateIndex)
+        {
+            candidatePoints.col(candidateIndex) = aPointArray.col(pointIndices[candidateIndex]) ;
+        }
+
+        const VectorXb candidateMask = polygons_[polygonIndex].containsPoints(candidatePoints) ;
+
+        for (std::size_t candidateIndex = 0; candidateIndex < pointIndices.size(); ++candidateIndex)
+        {
+            mask(pointIndices[candidateIndex]) = candidateMask(candidateIndex) ;
+        }
+
+    }
+
+    return mask ;
+
+}
+
+const Polygon&                  PolygonIndex::accessPolygonAt               (   const   Index&                      anIndex                                     ) const
+{
+
+    if (anIndex >= polygons_.getSize())
+    {
+        throw ostk::core::error::RuntimeError("Polygon index [{}] out of bounds [{}].", anIndex, polygons_.getSize()) ;
+    }
+
+    return polygons_.at(anIndex) ;
+
+}
+
+Size                            PolygonIndex::getPolygonCount               ( ) const
+{
+    return polygons_.getSize() ;
+}
+
+Array<Index>                    PolygonIndex::getPolygonIndicesContaining   (   const   Point&                      aPoint                                      ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    Array<Index> polygonIndices = Array<Index>::Empty() ;
+
+    treeUPtr_->query(boost::geometry::index::intersects(PolygonIndex::Tree::BoostPoint(aPoint.x(), aPoint.y())), [this, &aPoint, &polygonIndices] (const Index& aPolygonIndex) -> bool
+    {
+
+        if (polygons_[aPolygonIndex].contains(aPoint))
+        {
+            polygonIndices.add(aPolygonIndex) ;
+        }
+
+        return true ;
+
+    }) ;
+
+    std::sort(polygonIndices.begin(), polygonIndices.end()) ;
+
+    return polygonIndices ;
+
+}
+
+Array<Index>                    PolygonIndex::getPolygonIndicesOverlappingBox (   const   Point&                    aMinimum,
+                                                                                const   Point&                      aMaximum                                    ) const
+{
+
+    if (!aMinimum.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Minimum") ;
+    }
+
+    if (!aMaximum.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Maximum") ;
+    }
+
+    if ((aMinimum.x() > aMaximum.x()) || (aMinimum.y() > aMaximum.y()))
+    {
+        throw ostk::core::error::RuntimeError("Box minimum [{}] is greater than maximum [{}].", aMinimum.toString(), aMaximum.toString()) ;
+    }
+
+    Array<Index> polygonIndices = Array<Index>::Empty() ;
+
+    const PolygonIndex::Tree::BoostBox box = { { aMinimum.x(), aMinimum.y() }, { aMaximum.x(), aMaximum.y() } } ;
+
+    treeUPtr_->query(boost::geometry::index::intersects(box), [&polygonIndices] (const Index& aPolygonIndex) -> bool
+    {
+
+        polygonIndices.add(aPolygonIndex) ;
+
+        return true ;
+
+    }) ;
+
+    std::sort(polygonIndices.begin(), polygonIndices.end()) ;
+
+    return polygonIndices ;
+
+}
+
+Array<Index>                    PolygonIndex::getPolygonIndicesOverlapping  (   const   Polygon&                    aPolygon                                    ) const
+{
+
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    const PolygonIndex::Tree::BoostBox box = PolygonIndex::Tree::BoxOf(aPolygon) ;
+
+    return this->getPolygonIndicesOverlappingBox({ box.min_corner().get<0>(), box.min_corner().get<1>() }, { box.max_corner().get<0>(), box.max_corner().get<1>() }) ;
+
+}
+
+Index                           PolygonIndex::addPolygon                    (   const   Polygon&                    aPolygon                                    )
+{
+
+    if (!aPolygon.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    polygons_.add(aPolygon) ;
+
+    treeUPtr_->insert(aPolygon, polygons_.getSize() - 1) ;
+
+    return polygons_.getSize() - 1 ;
+
+}
+
+void                            PolygonIndex::print                         (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           ) const
+{
+
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Polygon Index") : void () ;
+
+    if (!polygons_.isEmpty())
+    {
+
+        ostk::core::utils::Print::Separator(anOutputStream, "Polygons") ;
+
+        for (const auto& polygon : polygons_)
+        {
+            ostk::core::utils::Print::Line(anOutputStream) << polygon.toString() ;
+        }
+
+    }
+    else
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Empty" ;
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+PolygonIndex                    PolygonIndex::Empty                         ( )
+{
+    return PolygonIndex { Array<Polygon>::Empty() } ;
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -26,15 +26,30 @@ namespace d3
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 Intersection::Intersection                  (           Array<Unique<Object>>&&     anObjectArray                               )
-                                :   type_(Intersection::TypeFromObjects(anObjectArray)),
-                                    composite_(std::move(anObjectArray))
+                                :   type_(Intersection::Type::Undefined),
+                                    object_(),
+                                    composite_(std::move(anObjectArray)),
+                                    compositeMutex_()
 {
 
+    type_ = Intersection::TypeFromObjects(composite_.accessObjects()) ;
+
 }
 
                                 Intersection::Intersection                  (   const   Intersection&               anIntersection                              )
                                 :   type_(anIntersection.type_),
-                                    composite_(anIntersection.composite_)
+                                    object_(anIntersection.object_),
+                                    composite_(std::holds_alternative<std::monostate>(anIntersection.object_) ? anIntersection.composite_ : Composite::Undefined()),
+                                    compositeMutex_()
+{
+
+}
+
+                                Intersection::Intersection                  (           Intersection&&              anIntersection                              )
+                                :   type_(anIntersection.type_),
+                                    object_(std::move(anIntersection.object_)),
+                                    composite_(std::holds_alternative<std::monostate>(object_) ? std::move(anIntersection.composite_) : Composite::Undefined()),
+                                    compositeMutex_()
 {
 
 }
@@ -51,7 +66,24 @@ Intersection&                   Intersection::operator =                    (
     {
 
         type_ = anIntersection.type_ ;
-        composite_ = anIntersection.composite_ ;
+        object_ = anIntersection.object_ ;
+        composite_ = std::holds_alternative<std::monostate>(anIntersection.object_) ? anIntersection.composite_ : Composite::Undefined() ;
+
+    }
+
+    return *this ;
+
+}
+
+Intersection&                   Intersection::operator =                    (           Intersection&&              anIntersection                              )
+{
+
+    if (this != &anIntersection)
+    {
+
+        type_ = anIntersection.type_ ;
+        object_ = std::move(anIntersection.object_) ;
+        composite_ = std::holds_alternative<std::monostate>(object_) ? std::move(anIntersection.composite_) : Composite::Undefined() ;
 
     }
 
@@ -67,7 +99,29 @@ bool                            Intersection::operator ==                   (
         return false ;
     }
 
-    return (type_ == anIntersection.type_) && (composite_ == anIntersection.composite_) ;
+    if (type_ != anIntersection.type_)
+    {
+        return false ;
+    }
+
+    if ((!std::holds_alternative<std::monostate>(object_)) && (object_.index() == anIntersection.object_.index()))
+    {
+
+        if (const auto* pointsPtr = std::get_if<std::pair<objects::Point, objects::Point>>(&object_))
+        {
+
+            const auto& otherPoints = std::get<std::pair<objects::Point, objects::Point>>(anIntersection.object_) ;
+
+            return ((pointsPtr->first == otherPoints.first) && (pointsPtr->second == otherPoints.second))
+                || ((pointsPtr->first == otherPoints.second) && (pointsPtr->second == otherPoints.first)) ;
+
+        }
+
+        return object_ == anIntersection.object_ ;
+
+    }
+
+    return this->accessComposite() == anIntersection.accessComposite() ;
 
 }
 
@@ -84,9 +138,14 @@ Intersection                    Intersection::operator +                    (
         throw ostk::core::error::runtime::Undefined("Intersection") ;
     }
 
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Intersection") ;
+    }
+
     Intersection intersection ;
 
-    intersection.composite_ = composite_ + anIntersection.composite_ ;
+    intersection.composite_ = this->accessComposite() + anIntersection.accessComposite() ;
 
     intersection.type_ = Intersection::TypeFromObjects(intersection.composite_.accessObjects()) ;
 
@@ -102,7 +161,17 @@ Intersection&                   Intersection::operator +=                   (
         throw ostk::core::error::runtime::Undefined("Intersection") ;
     }
 
-    composite_ += anIntersection.composite_ ;
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Intersection") ;
+    }
+
+    const Composite& composite = anIntersection.accessComposite() ;
+
+    composite_ = this->accessComposite() ;
+    object_ = std::monostate() ;
+
+    composite_ += composite ;
 
     type_ = Intersection::TypeFromObjects(composite_.accessObjects()) ;
 
@@ -120,7 +189,7 @@ std::ostream&                   operator <<                                 (
 
     ostk::core::utils::Print::Line(anOutputStream) << "Composite:" ;
 
-    anIntersection.composite_.print(anOutputStream, false) ;
+    (anIntersection.isDefined() ? anIntersection.accessComposite() : anIntersection.composite_).print(anOutputStream, false) ;
 
     ostk::core::utils::Print::Footer(anOutputStream) ;
 
@@ -151,10 +220,41 @@ const Composite&                Intersection::accessComposite               ( )
         throw ostk::core::error::runtime::Undefined("Intersection") ;
     }
 
+    if (std::holds_alternative<std::monostate>(object_))
+    {
+        return composite_ ;
+    }
+
+    // In-place objects are wrapped into a composite on first access only
+
+    const std::lock_guard<std::mutex> lock { compositeMutex_ } ;
+
+    if (!composite_.isDefined())
+    {
+        composite_ = Intersection::CompositeFromObject(object_) ;
+    }
+
     return composite_ ;
 
 }
 
+const std::pair<objects::Point, objects::Point>& Intersection::accessPoints ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Intersection") ;
+    }
+
+    if (const std::pair<objects::Point, objects::Point>* pointsPtr = std::get_if<std::pair<objects::Point, objects::Point>>(&object_))
+    {
+        return *pointsPtr ;
+    }
+
+    throw ostk::core::error::runtime::Wrong("Intersection") ;
+
+}
+
 Intersection::Type              Intersection::getType                       ( ) const
 {
 
@@ -190,33 +290,56 @@ Intersection                    Intersection::Point                         (
 
     intersection.type_ = Intersection::Type::Point ;
 
-    intersection.composite_ = Composite { aPoint } ;
+    intersection.object_ = aPoint ;
 
     return intersection ;
 
 }
 
-Intersection                    Intersection::PointSet                      (   const   objects::PointSet&          aPointSet                                   )
+Intersection                    Intersection::PointSet                      (   const   objects::PointSet&          aPointSet,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
 {
 
     Intersection intersection ;
 
     intersection.type_ = Intersection::Type::PointSet ;
 
-    intersection.composite_ = Composite { aPointSet } ;
+    if (aPointSet.getSize() == 2)
+    {
+        intersection.object_ = std::make_pair(*aPointSet.begin(), *std::next(aPointSet.begin())) ;
+    }
+    else
+    {
+        intersection.composite_ = Composite { aPointSet, aMemoryResource } ;
+    }
 
     return intersection ;
 
 }
 
-Intersection                    Intersection::LineString                    (   const   objects::LineString&        aLineString                                 )
+Intersection                    Intersection::PointSet                      (   const   objects::Point&             aFirstPoint,
+                                                                                const   objects::Point&             aSecondPoint                                )
+{
+
+    Intersection intersection ;
+
+    intersection.type_ = Intersection::Type::PointSet ;
+
+    intersection.object_ = std::make_pair(aFirstPoint, aSecondPoint) ;
+
+    return intersection ;
+
+}
+
+Intersection                    Intersection::LineString                    (   const   objects::LineString&        aLineString,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
 {
 
     Intersection intersection ;
 
     intersection.type_ = Intersection::Type::LineString ;
 
-    intersection.composite_ = Composite { aLineString } ;
+    intersection.composite_ = Composite { aLineString, aMemoryResource } ;
 
     return intersection ;
 
@@ -229,7 +352,7 @@ Intersection                    Intersection::Line                          (
 
     intersection.type_ = Intersection::Type::Line ;
 
-    intersection.composite_ = Composite { aLine } ;
+    intersection.object_ = aLine ;
 
     return intersection ;
 
@@ -242,7 +365,7 @@ Intersection                    Intersection::Ray                           (
 
     intersection.type_ = Intersection::Type::Ray ;
 
-    intersection.composite_ = Composite { aRay } ;
+    intersection.object_ = aRay ;
 
     return intersection ;
 
@@ -255,7 +378,7 @@ Intersection                    Intersection::Segment                       (
 
     intersection.type_ = Intersection::Type::Segment ;
 
-    intersection.composite_ = Composite { aSegment } ;
+    intersection.object_ = aSegment ;
 
     return intersection ;
 
@@ -323,12 +446,46 @@ String                          Intersection::StringFromType                (
 
                                 Intersection::Intersection                  ( )
                                 :   type_(Intersection::Type::Undefined),
-                                    composite_(Composite::Undefined())
+                                    object_(),
+                                    composite_(Composite::Undefined()),
+                                    compositeMutex_()
 {
 
 }
 
-Intersection::Type              Intersection::TypeFromObjects               (   const   Array<Unique<Object>>&      anObjectArray                               )
+Composite                       Intersection::CompositeFromObject           (   const   InPlaceObject&              anInPlaceObject                             )
+{
+
+    if (const objects::Point* pointPtr = std::get_if<objects::Point>(&anInPlaceObject))
+    {
+        return Composite { *pointPtr } ;
+    }
+
+    if (const auto* pointsPtr = std::get_if<std::pair<objects::Point, objects::Point>>(&anInPlaceObject))
+    {
+        return Composite { objects::PointSet({ pointsPtr->first, pointsPtr->second }) } ;
+    }
+
+    if (const objects::Line* linePtr = std::get_if<objects::Line>(&anInPlaceObject))
+    {
+        return Composite { *linePtr } ;
+    }
+
+    if (const objects::Ray* rayPtr = std::get_if<objects::Ray>(&anInPlaceObject))
+    {
+        return Composite { *rayPtr } ;
+    }
+
+    if (const objects::Segment* segmentPtr = std::get_if<objects::Segment>(&anInPlaceObject))
+    {
+        return Composite { *segmentPtr } ;
+    }
+
+    return Composite::Undefined() ;
+
+}
+
+Intersection::Type              Intersection::TypeFromObjects               (   const   Array<Object::Pointer>&     anObjectArray                               )
 {
 
     if (anObjectArray.isEmpty())
@@ -341,7 +498,7 @@ Intersection::Type              Intersection::TypeFromObjects               (
     for (const auto& objectUPtr : anObjectArray)
     {
 
-        const Intersection::Type objectType = Intersection::TypeFromObject(objectUPtr) ;
+        const Intersection::Type objectType = Intersection::TypeFromObject(*objectUPtr) ;
 
         if (type == Intersection::Type::Undefined)
         {
@@ -358,67 +515,51 @@ Intersection::Type              Intersection::TypeFromObjects               (
 
 }
 
-Intersection::Type              Intersection::TypeFromObject                (   const   Unique<Object>&             anObjectUPtr                                )
+Intersection::Type              Intersection::TypeFromObject                (   const   Object&                     anObject                                    )
 {
 
-    if (dynamic_cast<const objects::Point*>(anObjectUPtr.get()))
+    switch (anObject.getType())
     {
-        return Intersection::Type::Point ;
-    }
 
-    if (dynamic_cast<const objects::PointSet*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::PointSet ;
-    }
+        case Object::Type::Point:
+            return Intersection::Type::Point ;
 
-    if (dynamic_cast<const objects::Line*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Line ;
-    }
+        case Object::Type::PointSet:
+            return Intersection::Type::PointSet ;
 
-    if (dynamic_cast<const objects::Ray*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Ray ;
-    }
+        case Object::Type::Line:
+            return Intersection::Type::Line ;
 
-    if (dynamic_cast<const objects::Segment*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Segment ;
-    }
+        case Object::Type::Ray:
+            return Intersection::Type::Ray ;
 
-    if (dynamic_cast<const objects::LineString*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::LineString ;
-    }
+        case Object::Type::Segment:
+            return Intersection::Type::Segment ;
 
-    if (dynamic_cast<const objects::Polygon*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Polygon ;
-    }
+        case Object::Type::LineString:
+            return Intersection::Type::LineString ;
 
-    if (dynamic_cast<const objects::Plane*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Plane ;
-    }
+        case Object::Type::Polygon:
+            return Intersection::Type::Polygon ;
 
-    if (dynamic_cast<const objects::Cuboid*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Cuboid ;
-    }
+        case Object::Type::Plane:
+            return Intersection::Type::Plane ;
 
-    if (dynamic_cast<const objects::Sphere*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Sphere ;
-    }
+        case Object::Type::Cuboid:
+            return Intersection::Type::Cuboid ;
 
-    if (dynamic_cast<const objects::Ellipsoid*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Ellipsoid ;
-    }
+        case Object::Type::Sphere:
+            return Intersection::Type::Sphere ;
+
+        case Object::Type::Ellipsoid:
+            return Intersection::Type::Ellipsoid ;
+
+        case Object::Type::Pyramid:
+            return Intersection::Type::Pyramid ;
+
+        default:
+            break ;
 
-    if (dynamic_cast<const objects::Pyramid*>(anObjectUPtr.get()))
-    {
-        return Intersection::Type::Pyramid ;
     }
 
     return Intersection::Type::Undefined ;
@@ -27,6 +27,10 @@
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <array>
+#include <cstddef>
+#include <new>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -40,511 +44,414 @@ namespace d3
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                                Object::~Object                             ( )
-{
+// Generic queries between two objects are resolved in constant time, through tables indexed by the types of both operands.
+// Each entry casts the operands to their underlying types, and forwards to the matching overload.
 
-}
-
-bool                            Object::operator ==                         (   const   Object&                     anObject                                    ) const
+namespace
 {
 
-    using ostk::math::geom::d3::objects::Point ;
-    using ostk::math::geom::d3::objects::PointSet ;
-    using ostk::math::geom::d3::objects::Line ;
-    using ostk::math::geom::d3::objects::Ray ;
-    using ostk::math::geom::d3::objects::Segment ;
-    using ostk::math::geom::d3::objects::LineString ;
-    using ostk::math::geom::d3::objects::Polygon ;
-    using ostk::math::geom::d3::objects::Plane ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Sphere ;
-    using ostk::math::geom::d3::objects::Ellipsoid ;
-    using ostk::math::geom::d3::objects::Pyramid ;
-    using ostk::math::geom::d3::objects::Cone ;
-    using ostk::math::geom::d3::objects::Composite ;
-
-    if ((!this->isDefined()) || (!anObject.isDefined()))
-    {
-        return false ;
-    }
-
-    if (typeid(*this) != typeid(anObject))
-    {
-        return false ;
-    }
-
-    // Point
-
-    if (const Point* objectPtr = dynamic_cast<const Point*>(this))
-    {
-
-        if (const Point* otherObjectPtr = dynamic_cast<const Point*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
-
-    }
-
-    // PointSet
+using ostk::math::geom::d3::objects::Point ;
+using ostk::math::geom::d3::objects::PointSet ;
+using ostk::math::geom::d3::objects::Line ;
+using ostk::math::geom::d3::objects::Ray ;
+using ostk::math::geom::d3::objects::Segment ;
+using ostk::math::geom::d3::objects::LineString ;
+using ostk::math::geom::d3::objects::Polygon ;
+using ostk::math::geom::d3::objects::Plane ;
+using ostk::math::geom::d3::objects::Cuboid ;
+using ostk::math::geom::d3::objects::Sphere ;
+using ostk::math::geom::d3::objects::Ellipsoid ;
+using ostk::math::geom::d3::objects::Pyramid ;
+using ostk::math::geom::d3::objects::Cone ;
+using ostk::math::geom::d3::objects::Composite ;
+
+using EqualToFunction = bool (*) (const Object&, const Object&) ;
+using IntersectsFunction = bool (*) (const Object&, const Object&) ;
+using ContainsFunction = bool (*) (const Object&, const Object&) ;
+using IntersectionWithFunction = Intersection (*) (const Object&, const Object&) ;
+
+template <class FunctionType>
+class DispatchTable
+{
 
-    if (const PointSet* objectPtr = dynamic_cast<const PointSet*>(this))
-    {
+    public:
 
-        if (const PointSet* otherObjectPtr = dynamic_cast<const PointSet*>(&anObject))
+                                DispatchTable                               ( )
+                                :   functions_ {}
         {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
 
-    }
-
-    // Line
-
-    if (const Line* objectPtr = dynamic_cast<const Line*>(this))
-    {
-
-        if (const Line* otherObjectPtr = dynamic_cast<const Line*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
         }
 
-    }
-
-    // Ray
-
-    if (const Ray* objectPtr = dynamic_cast<const Ray*>(this))
-    {
-
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
+        void                    set                                         (   const   Object::Type&               aType,
+                                                                                const   Object::Type&               anotherType,
+                                                                                        FunctionType                aFunction                                   )
         {
-            return (*objectPtr) == (*otherObjectPtr) ;
+            functions_[DispatchTable::IndexOf(aType)][DispatchTable::IndexOf(anotherType)] = aFunction ;
         }
 
-    }
-
-    // Segment
-
-    if (const Segment* objectPtr = dynamic_cast<const Segment*>(this))
-    {
-
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
+        FunctionType            get                                         (   const   Object::Type&               aType,
+                                                                                const   Object::Type&               anotherType                                 ) const
         {
-            return (*objectPtr) == (*otherObjectPtr) ;
+            return functions_[DispatchTable::IndexOf(aType)][DispatchTable::IndexOf(anotherType)] ;
         }
 
-    }
+    private:
 
-    // LineString
+        static constexpr std::size_t TypeCount = static_cast<std::size_t>(Object::Type::Composite) + 1 ;
 
-    if (const LineString* objectPtr = dynamic_cast<const LineString*>(this))
-    {
+        std::array<std::array<FunctionType, TypeCount>, TypeCount> functions_ ;
 
-        if (const LineString* otherObjectPtr = dynamic_cast<const LineString*>(&anObject))
+        static std::size_t      IndexOf                                     (   const   Object::Type&               aType                                       )
         {
-            return (*objectPtr) == (*otherObjectPtr) ;
+            return static_cast<std::size_t>(aType) ;
         }
 
-    }
+} ;
 
-    // Polygon
+template <class ObjectType, class OtherObjectType>
+bool                            EqualTo                                     (   const   Object&                     anObject,
+                                                                                const   Object&                     anotherObject                               )
+{
+    return static_cast<const ObjectType&>(anObject) == static_cast<const OtherObjectType&>(anotherObject) ;
+}
 
-    if (const Polygon* objectPtr = dynamic_cast<const Polygon*>(this))
-    {
+template <class ObjectType, class OtherObjectType>
+bool                            Intersects                                  (   const   Object&                     anObject,
+                                                                                const   Object&                     anotherObject                               )
+{
+    return static_cast<const ObjectType&>(anObject).intersects(static_cast<const OtherObjectType&>(anotherObject)) ;
+}
 
-        if (const Polygon* otherObjectPtr = dynamic_cast<const Polygon*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+template <class ObjectType, class OtherObjectType>
+bool                            Contains                                    (   const   Object&                     anObject,
+                                                                                const   Object&                     anotherObject                               )
+{
+    return static_cast<const ObjectType&>(anObject).contains(static_cast<const OtherObjectType&>(anotherObject)) ;
+}
 
-    }
+template <class ObjectType, class OtherObjectType>
+Intersection                    IntersectionWith                            (   const   Object&                     anObject,
+                                                                                const   Object&                     anotherObject                               )
+{
+    return static_cast<const ObjectType&>(anObject).intersectionWith(static_cast<const OtherObjectType&>(anotherObject)) ;
+}
 
-    // Plane
+const DispatchTable<EqualToFunction>& EqualToDispatchTable ( )
+{
 
-    if (const Plane* objectPtr = dynamic_cast<const Plane*>(this))
+    static const DispatchTable<EqualToFunction> dispatchTable = [] () -> DispatchTable<EqualToFunction>
     {
 
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+        DispatchTable<EqualToFunction> table ;
 
-    }
+        table.set(Object::Type::Point, Object::Type::Point, &EqualTo<Point, Point>) ;
+        table.set(Object::Type::PointSet, Object::Type::PointSet, &EqualTo<PointSet, PointSet>) ;
+        table.set(Object::Type::Line, Object::Type::Line, &EqualTo<Line, Line>) ;
+        table.set(Object::Type::Ray, Object::Type::Ray, &EqualTo<Ray, Ray>) ;
+        table.set(Object::Type::Segment, Object::Type::Segment, &EqualTo<Segment, Segment>) ;
+        table.set(Object::Type::LineString, Object::Type::LineString, &EqualTo<LineString, LineString>) ;
+        table.set(Object::Type::Polygon, Object::Type::Polygon, &EqualTo<Polygon, Polygon>) ;
+        table.set(Object::Type::Plane, Object::Type::Plane, &EqualTo<Plane, Plane>) ;
+        table.set(Object::Type::Cuboid, Object::Type::Cuboid, &EqualTo<Cuboid, Cuboid>) ;
+        table.set(Object::Type::Sphere, Object::Type::Sphere, &EqualTo<Sphere, Sphere>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Ellipsoid, &EqualTo<Ellipsoid, Ellipsoid>) ;
+        table.set(Object::Type::Pyramid, Object::Type::Pyramid, &EqualTo<Pyramid, Pyramid>) ;
+        table.set(Object::Type::Cone, Object::Type::Cone, &EqualTo<Cone, Cone>) ;
+        table.set(Object::Type::Composite, Object::Type::Composite, &EqualTo<Composite, Composite>) ;
 
-    // Cuboid
+        return table ;
 
-    if (const Cuboid* objectPtr = dynamic_cast<const Cuboid*>(this))
-    {
+    }() ;
 
-        if (const Cuboid* otherObjectPtr = dynamic_cast<const Cuboid*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+    return dispatchTable ;
 
-    }
+}
 
-    // Sphere
+const DispatchTable<IntersectsFunction>& IntersectsDispatchTable ( )
+{
 
-    if (const Sphere* objectPtr = dynamic_cast<const Sphere*>(this))
+    static const DispatchTable<IntersectsFunction> dispatchTable = [] () -> DispatchTable<IntersectsFunction>
     {
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
-
-    }
+        DispatchTable<IntersectsFunction> table ;
 
-    // Ellipsoid
+        // Line
 
-    if (const Ellipsoid* objectPtr = dynamic_cast<const Ellipsoid*>(this))
-    {
+        table.set(Object::Type::Line, Object::Type::Plane, &Intersects<Line, Plane>) ;
+        table.set(Object::Type::Line, Object::Type::Sphere, &Intersects<Line, Sphere>) ;
+        table.set(Object::Type::Line, Object::Type::Ellipsoid, &Intersects<Line, Ellipsoid>) ;
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
-
-    }
+        // Ray
 
-    // Pyramid
+        table.set(Object::Type::Ray, Object::Type::Plane, &Intersects<Ray, Plane>) ;
+        table.set(Object::Type::Ray, Object::Type::Sphere, &Intersects<Ray, Sphere>) ;
+        table.set(Object::Type::Ray, Object::Type::Ellipsoid, &Intersects<Ray, Ellipsoid>) ;
 
-    if (const Pyramid* objectPtr = dynamic_cast<const Pyramid*>(this))
-    {
+        // Segment
 
-        if (const Pyramid* otherObjectPtr = dynamic_cast<const Pyramid*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Segment, Object::Type::Plane, &Intersects<Segment, Plane>) ;
+        table.set(Object::Type::Segment, Object::Type::Sphere, &Intersects<Segment, Sphere>) ;
+        table.set(Object::Type::Segment, Object::Type::Ellipsoid, &Intersects<Segment, Ellipsoid>) ;
 
-    }
+        // Plane
 
-    // Cone
+        table.set(Object::Type::Plane, Object::Type::Point, &Intersects<Plane, Point>) ;
+        table.set(Object::Type::Plane, Object::Type::PointSet, &Intersects<Plane, PointSet>) ;
+        table.set(Object::Type::Plane, Object::Type::Line, &Intersects<Plane, Line>) ;
+        table.set(Object::Type::Plane, Object::Type::Ray, &Intersects<Plane, Ray>) ;
+        table.set(Object::Type::Plane, Object::Type::Segment, &Intersects<Plane, Segment>) ;
 
-    if (const Cone* objectPtr = dynamic_cast<const Cone*>(this))
-    {
+        // Sphere
 
-        if (const Cone* otherObjectPtr = dynamic_cast<const Cone*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Sphere, Object::Type::Line, &Intersects<Sphere, Line>) ;
+        table.set(Object::Type::Sphere, Object::Type::Segment, &Intersects<Sphere, Segment>) ;
+        table.set(Object::Type::Sphere, Object::Type::Ray, &Intersects<Sphere, Ray>) ;
+        table.set(Object::Type::Sphere, Object::Type::Pyramid, &Intersects<Sphere, Pyramid>) ;
+        table.set(Object::Type::Sphere, Object::Type::Cone, &Intersects<Sphere, Cone>) ;
 
-    }
+        // Ellipsoid
 
-    // Composite
+        table.set(Object::Type::Ellipsoid, Object::Type::Line, &Intersects<Ellipsoid, Line>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Segment, &Intersects<Ellipsoid, Segment>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Ray, &Intersects<Ellipsoid, Ray>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Pyramid, &Intersects<Ellipsoid, Pyramid>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Cone, &Intersects<Ellipsoid, Cone>) ;
 
-    if (const Composite* objectPtr = dynamic_cast<const Composite*>(this))
-    {
+        // Pyramid
 
-        if (const Composite* otherObjectPtr = dynamic_cast<const Composite*>(&anObject))
-        {
-            return (*objectPtr) == (*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Pyramid, Object::Type::Sphere, &Intersects<Pyramid, Sphere>) ;
+        table.set(Object::Type::Pyramid, Object::Type::Ellipsoid, &Intersects<Pyramid, Ellipsoid>) ;
 
-    }
+        // Cone
 
-    std::cout << (*this) << std::endl ;
-    std::cout << anObject << std::endl ;
+        table.set(Object::Type::Cone, Object::Type::Sphere, &Intersects<Cone, Sphere>) ;
+        table.set(Object::Type::Cone, Object::Type::Ellipsoid, &Intersects<Cone, Ellipsoid>) ;
 
-    throw ostk::core::error::runtime::ToBeImplemented("Object :: operator ==") ;
+        return table ;
 
-    return false ;
+    }() ;
 
-}
+    return dispatchTable ;
 
-bool                            Object::operator !=                         (   const   Object&                     anObject                                    ) const
-{
-    return !((*this) == anObject) ;
 }
 
-std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
-                                                                                const   Object&                     anObject                                    )
+const DispatchTable<ContainsFunction>& ContainsDispatchTable ( )
 {
 
-    anObject.print(anOutputStream, true) ;
-
-    return anOutputStream ;
-
-}
-
-bool                            Object::intersects                          (   const   Object&                     anObject                                    ) const
-{
-
-    using ostk::math::geom::d3::objects::Point ;
-    using ostk::math::geom::d3::objects::PointSet ;
-    using ostk::math::geom::d3::objects::Line ;
-    using ostk::math::geom::d3::objects::Ray ;
-    using ostk::math::geom::d3::objects::Segment ;
-    using ostk::math::geom::d3::objects::LineString ;
-    using ostk::math::geom::d3::objects::Polygon ;
-    using ostk::math::geom::d3::objects::Plane ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Sphere ;
-    using ostk::math::geom::d3::objects::Ellipsoid ;
-    using ostk::math::geom::d3::objects::Pyramid ;
-    using ostk::math::geom::d3::objects::Cone ;
-    using ostk::math::geom::d3::objects::Composite ;
-
-    if (!anObject.isDefined())
+    static const DispatchTable<ContainsFunction> dispatchTable = [] () -> DispatchTable<ContainsFunction>
     {
-        throw ostk::core::error::runtime::Undefined("Object") ;
-    }
-
-    // Line
 
-    if (const Line* objectPtr = dynamic_cast<const Line*>(this))
-    {
+        DispatchTable<ContainsFunction> table ;
 
         // Plane
 
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
-
-        // Sphere
-
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Plane, Object::Type::Point, &Contains<Plane, Point>) ;
+        table.set(Object::Type::Plane, Object::Type::PointSet, &Contains<Plane, PointSet>) ;
+        table.set(Object::Type::Plane, Object::Type::Line, &Contains<Plane, Line>) ;
+        table.set(Object::Type::Plane, Object::Type::Ray, &Contains<Plane, Ray>) ;
+        table.set(Object::Type::Plane, Object::Type::Segment, &Contains<Plane, Segment>) ;
 
         // Ellipsoid
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Ellipsoid, Object::Type::Segment, &Contains<Ellipsoid, Segment>) ;
 
-    }
+        // Pyramid
 
-    // Ray
+        table.set(Object::Type::Pyramid, Object::Type::Point, &Contains<Pyramid, Point>) ;
+        table.set(Object::Type::Pyramid, Object::Type::Ellipsoid, &Contains<Pyramid, Ellipsoid>) ;
 
-    if (const Ray* objectPtr = dynamic_cast<const Ray*>(this))
-    {
+        return table ;
 
-        // Plane
+    }() ;
 
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    return dispatchTable ;
 
-        // Sphere
+}
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+const DispatchTable<IntersectionWithFunction>& IntersectionWithDispatchTable ( )
+{
 
-        // Ellipsoid
+    static const DispatchTable<IntersectionWithFunction> dispatchTable = [] () -> DispatchTable<IntersectionWithFunction>
+    {
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        DispatchTable<IntersectionWithFunction> table ;
 
-    }
+        // Line
 
-    // Segment
+        table.set(Object::Type::Line, Object::Type::Plane, &IntersectionWith<Line, Plane>) ;
 
-    if (const Segment* objectPtr = dynamic_cast<const Segment*>(this))
-    {
+        // Ray
 
-        // Plane
+        table.set(Object::Type::Ray, Object::Type::Plane, &IntersectionWith<Ray, Plane>) ;
+        table.set(Object::Type::Ray, Object::Type::Ellipsoid, &IntersectionWith<Ray, Ellipsoid>) ;
 
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        // Segment
+
+        table.set(Object::Type::Segment, Object::Type::Plane, &IntersectionWith<Segment, Plane>) ;
 
         // Sphere
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Sphere, Object::Type::Ray, &IntersectionWith<Sphere, Ray>) ;
+        table.set(Object::Type::Sphere, Object::Type::Pyramid, &IntersectionWith<Sphere, Pyramid>) ;
+        table.set(Object::Type::Sphere, Object::Type::Cone, &IntersectionWith<Sphere, Cone>) ;
 
         // Ellipsoid
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        table.set(Object::Type::Ellipsoid, Object::Type::Ray, &IntersectionWith<Ellipsoid, Ray>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Pyramid, &IntersectionWith<Ellipsoid, Pyramid>) ;
+        table.set(Object::Type::Ellipsoid, Object::Type::Cone, &IntersectionWith<Ellipsoid, Cone>) ;
 
-    }
+        // Pyramid
 
-    // Plane
+        table.set(Object::Type::Pyramid, Object::Type::Sphere, &IntersectionWith<Pyramid, Sphere>) ;
+        table.set(Object::Type::Pyramid, Object::Type::Ellipsoid, &IntersectionWith<Pyramid, Ellipsoid>) ;
 
-    if (const Plane* objectPtr = dynamic_cast<const Plane*>(this))
-    {
+        // Cone
 
-        // Point
+        table.set(Object::Type::Cone, Object::Type::Sphere, &IntersectionWith<Cone, Sphere>) ;
+        table.set(Object::Type::Cone, Object::Type::Ellipsoid, &IntersectionWith<Cone, Ellipsoid>) ;
 
-        if (const Point* otherObjectPtr = dynamic_cast<const Point*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        return table ;
 
-        // PointSet
+    }() ;
 
-        if (const PointSet* otherObjectPtr = dynamic_cast<const PointSet*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    return dispatchTable ;
 
-        // Line
+}
 
-        if (const Line* otherObjectPtr = dynamic_cast<const Line*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+// Objects cloned into a memory resource are constructed in place, by copy of their underlying type
 
-        // Ray
+constexpr std::size_t AllocationAlignment = alignof(std::max_align_t) ;
 
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+template <class ObjectType>
+Object::Pointer                 CloneInto                                   (   const   Object&                     anObject,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
+{
 
-        // Segment
+    static_assert(alignof(ObjectType) <= AllocationAlignment, "Object alignment is greater than allocation alignment.") ;
 
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    void* storagePtr = aMemoryResource->allocate(sizeof(ObjectType), AllocationAlignment) ;
 
+    try
+    {
+        return Object::Pointer(new (storagePtr) ObjectType(static_cast<const ObjectType&>(anObject)), Object::Deleter(aMemoryResource, sizeof(ObjectType))) ;
     }
-
-    // Sphere
-
-    if (const Sphere* objectPtr = dynamic_cast<const Sphere*>(this))
+    catch (...)
     {
 
-        // Line
+        aMemoryResource->deallocate(storagePtr, sizeof(ObjectType), AllocationAlignment) ;
 
-        if (const Line* otherObjectPtr = dynamic_cast<const Line*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
-
-        // Segment
+        throw ;
 
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    }
 
-        // Ray
+}
 
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+}
 
-        // Pyramid
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        if (const Pyramid* otherObjectPtr = dynamic_cast<const Pyramid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+                                Object::Deleter::Deleter                    ( )
+                                :   memoryResourcePtr_(nullptr),
+                                    size_(0)
+{
 
-        // Cone
+}
 
-        if (const Cone* otherObjectPtr = dynamic_cast<const Cone*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+                                Object::Deleter::Deleter                    (           std::pmr::memory_resource*  aMemoryResource,
+                                                                                const   std::size_t                 aSize                                       )
+                                :   memoryResourcePtr_(aMemoryResource),
+                                    size_(aSize)
+{
 
-    }
+}
 
-    // Ellipsoid
+void                            Object::Deleter::operator ()                (           Object*                     anObjectPtr                                 ) const
+{
 
-    if (const Ellipsoid* objectPtr = dynamic_cast<const Ellipsoid*>(this))
+    if (memoryResourcePtr_ == nullptr)
     {
 
-        // Line
+        delete anObjectPtr ;
 
-        if (const Line* otherObjectPtr = dynamic_cast<const Line*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        return ;
 
-        // Segment
+    }
 
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    if (anObjectPtr != nullptr)
+    {
 
-        // Ray
+        anObjectPtr->~Object() ;
 
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+        memoryResourcePtr_->deallocate(anObjectPtr, size_, AllocationAlignment) ;
 
-        // Ellipsoid
+    }
 
-        // if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        // {
-        //     return objectPtr->intersects(*otherObjectPtr) ;
-        // }
+}
 
-        // Pyramid
+std::pmr::memory_resource*      Object::Deleter::getMemoryResource          ( ) const
+{
+    return memoryResourcePtr_ ;
+}
 
-        if (const Pyramid* otherObjectPtr = dynamic_cast<const Pyramid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+                                Object::~Object                             ( )
+{
 
-        // Cone
+}
 
-        if (const Cone* otherObjectPtr = dynamic_cast<const Cone*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+bool                            Object::operator ==                         (   const   Object&                     anObject                                    ) const
+{
 
+    if ((!this->isDefined()) || (!anObject.isDefined()))
+    {
+        return false ;
     }
 
-    // Pyramid
+    if (this->getType() != anObject.getType())
+    {
+        return false ;
+    }
 
-    if (const Pyramid* objectPtr = dynamic_cast<const Pyramid*>(this))
+    if (const EqualToFunction equalToFunction = EqualToDispatchTable().get(this->getType(), anObject.getType()))
     {
+        return equalToFunction(*this, anObject) ;
+    }
 
-        // Sphere
+    std::cout << (*this) << std::endl ;
+    std::cout << anObject << std::endl ;
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    throw ostk::core::error::runtime::ToBeImplemented("Object :: operator ==") ;
 
-        // Ellipsoid
+    return false ;
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+}
 
-    }
+bool                            Object::operator !=                         (   const   Object&                     anObject                                    ) const
+{
+    return !((*this) == anObject) ;
+}
 
-    // Cone
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Object&                     anObject                                    )
+{
 
-    if (const Cone* objectPtr = dynamic_cast<const Cone*>(this))
-    {
+    anObject.print(anOutputStream, true) ;
 
-        // Sphere
+    return anOutputStream ;
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+}
 
-        // Ellipsoid
+bool                            Object::intersects                          (   const   Object&                     anObject                                    ) const
+{
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersects(*otherObjectPtr) ;
-        }
+    if (!anObject.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Object") ;
+    }
 
+    if (const IntersectsFunction intersectsFunction = IntersectsDispatchTable().get(this->getType(), anObject.getType()))
+    {
+        return intersectsFunction(*this, anObject) ;
     }
 
     std::cout << (*this) << std::endl ;
@@ -559,129 +466,14 @@ bool                            Object::intersects                          (
 bool                            Object::contains                            (   const   Object&                     anObject                                    ) const
 {
 
-    using ostk::math::geom::d3::objects::Point ;
-    using ostk::math::geom::d3::objects::PointSet ;
-    using ostk::math::geom::d3::objects::Line ;
-    using ostk::math::geom::d3::objects::Ray ;
-    using ostk::math::geom::d3::objects::Segment ;
-    using ostk::math::geom::d3::objects::LineString ;
-    using ostk::math::geom::d3::objects::Polygon ;
-    using ostk::math::geom::d3::objects::Plane ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Sphere ;
-    using ostk::math::geom::d3::objects::Ellipsoid ;
-    using ostk::math::geom::d3::objects::Pyramid ;
-    using ostk::math::geom::d3::objects::Cone ;
-    using ostk::math::geom::d3::objects::Composite ;
-
     if (!anObject.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Object") ;
     }
 
-    // Segment
-
-    // if (const Segment* objectPtr = dynamic_cast<const Segment*>(this))
-    // {
-
-        // Segment
-
-        // if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        // {
-        //     return objectPtr->contains(*otherObjectPtr) ;
-        // }
-
-        // Ellipsoid
-
-        // if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        // {
-        //     return objectPtr->contains(*otherObjectPtr) ;
-        // }
-
-    // }
-
-    // Plane
-
-    if (const Plane* objectPtr = dynamic_cast<const Plane*>(this))
-    {
-
-        // Point
-
-        if (const Point* otherObjectPtr = dynamic_cast<const Point*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // PointSet
-
-        if (const PointSet* otherObjectPtr = dynamic_cast<const PointSet*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // Line
-
-        if (const Line* otherObjectPtr = dynamic_cast<const Line*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // Ray
-
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // Segment
-
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-    }
-
-    // Ellipsoid
-
-    if (const Ellipsoid* objectPtr = dynamic_cast<const Ellipsoid*>(this))
-    {
-
-        // Segment
-
-        if (const Segment* otherObjectPtr = dynamic_cast<const Segment*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // Ellipsoid
-
-        // if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        // {
-        //     return objectPtr->contains(*otherObjectPtr) ;
-        // }
-
-    }
-
-    // Pyramid
-
-    if (const Pyramid* objectPtr = dynamic_cast<const Pyramid*>(this))
+    if (const ContainsFunction containsFunction = ContainsDispatchTable().get(this->getType(), anObject.getType()))
     {
-
-        // Point
-
-        if (const Point* otherObjectPtr = dynamic_cast<const Point*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
-        // Ellipsoid
-
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->contains(*otherObjectPtr) ;
-        }
-
+        return containsFunction(*this, anObject) ;
     }
 
     throw ostk::core::error::runtime::ToBeImplemented("Object :: contains") ;
@@ -693,179 +485,102 @@ bool                            Object::contains                            (
 Intersection                    Object::intersectionWith                    (   const   Object&                     anObject                                    ) const
 {
 
-    using ostk::math::geom::d3::objects::Point ;
-    using ostk::math::geom::d3::objects::PointSet ;
-    using ostk::math::geom::d3::objects::Line ;
-    using ostk::math::geom::d3::objects::Ray ;
-    using ostk::math::geom::d3::objects::Segment ;
-    using ostk::math::geom::d3::objects::LineString ;
-    using ostk::math::geom::d3::objects::Polygon ;
-    using ostk::math::geom::d3::objects::Plane ;
-    using ostk::math::geom::d3::objects::Cuboid ;
-    using ostk::math::geom::d3::objects::Sphere ;
-    using ostk::math::geom::d3::objects::Ellipsoid ;
-    using ostk::math::geom::d3::objects::Pyramid ;
-    using ostk::math::geom::d3::objects::Cone ;
-    using ostk::math::geom::d3::objects::Composite ;
-
     if (!anObject.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Object") ;
     }
 
-    // Line
-
-    if (const Line* objectPtr = dynamic_cast<const Line*>(this))
+    if (const IntersectionWithFunction intersectionWithFunction = IntersectionWithDispatchTable().get(this->getType(), anObject.getType()))
     {
-
-        // Plane
-
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
+        return intersectionWithFunction(*this, anObject) ;
     }
 
-    // Ray
-
-    if (const Ray* objectPtr = dynamic_cast<const Ray*>(this))
-    {
-
-        // Plane
-
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
-        // Ellipsoid
-
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+    std::cout << (*this) << std::endl ;
+    std::cout << anObject << std::endl ;
 
-    }
+    throw ostk::core::error::runtime::ToBeImplemented("Object :: intersectionWith") ;
 
-    // Segment
+    return Intersection::Undefined() ;
 
-    if (const Segment* objectPtr = dynamic_cast<const Segment*>(this))
-    {
+}
 
-        // Plane
+Cuboid                          Object::getBoundingBox                      ( ) const
+{
+    throw ostk::core::error::runtime::ToBeImplemented("Object :: getBoundingBox") ;
+}
 
-        if (const Plane* otherObjectPtr = dynamic_cast<const Plane*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+Cuboid                          Object::getOrientedBoundingBox              ( ) const
+{
+    throw ostk::core::error::runtime::ToBeImplemented("Object :: getOrientedBoundingBox") ;
+}
 
-    }
+Sphere                          Object::getBoundingSphere                   ( ) const
+{
+    throw ostk::core::error::runtime::ToBeImplemented("Object :: getBoundingSphere") ;
+}
 
-    // Sphere
+Object::Pointer                 Object::Clone                               (   const   Object&                     anObject,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
+{
 
-    if (const Sphere* objectPtr = dynamic_cast<const Sphere*>(this))
+    if (aMemoryResource == nullptr)
     {
-
-        // Ray
-
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
-        // Pyramid
-
-        if (const Pyramid* otherObjectPtr = dynamic_cast<const Pyramid*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
-        // Cone
-
-        if (const Cone* otherObjectPtr = dynamic_cast<const Cone*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
+        return Object::Pointer(anObject.clone()) ;
     }
 
-    // Ellipsoid
-
-    if (const Ellipsoid* objectPtr = dynamic_cast<const Ellipsoid*>(this))
+    switch (anObject.getType())
     {
 
-        // Ray
+        case Object::Type::Point:
+            return CloneInto<Point>(anObject, aMemoryResource) ;
 
-        if (const Ray* otherObjectPtr = dynamic_cast<const Ray*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        case Object::Type::PointSet:
+            return CloneInto<PointSet>(anObject, aMemoryResource) ;
 
-        // Pyramid
+        case Object::Type::Line:
+            return CloneInto<Line>(anObject, aMemoryResource) ;
 
-        if (const Pyramid* otherObjectPtr = dynamic_cast<const Pyramid*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        case Object::Type::Ray:
+            return CloneInto<Ray>(anObject, aMemoryResource) ;
 
-        // Cone
+        case Object::Type::Segment:
+            return CloneInto<Segment>(anObject, aMemoryResource) ;
 
-        if (const Cone* otherObjectPtr = dynamic_cast<const Cone*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        case Object::Type::LineString:
+            return CloneInto<LineString>(anObject, aMemoryResource) ;
 
-    }
-
-    // Pyramid
-
-    if (const Pyramid* objectPtr = dynamic_cast<const Pyramid*>(this))
-    {
+        case Object::Type::Polygon:
+            return CloneInto<Polygon>(anObject, aMemoryResource) ;
 
-        // Sphere
-
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
-
-        // Ellipsoid
-
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        case Object::Type::Plane:
+            return CloneInto<Plane>(anObject, aMemoryResource) ;
 
-    }
+        case Object::Type::Cuboid:
+            return CloneInto<Cuboid>(anObject, aMemoryResource) ;
 
-    // Cone
+        case Object::Type::Sphere:
+            return CloneInto<Sphere>(anObject, aMemoryResource) ;
 
-    if (const Cone* objectPtr = dynamic_cast<const Cone*>(this))
-    {
+        case Object::Type::Ellipsoid:
+            return CloneInto<Ellipsoid>(anObject, aMemoryResource) ;
 
-        // Sphere
+        case Object::Type::Pyramid:
+            return CloneInto<Pyramid>(anObject, aMemoryResource) ;
 
-        if (const Sphere* otherObjectPtr = dynamic_cast<const Sphere*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        case Object::Type::Cone:
+            return CloneInto<Cone>(anObject, aMemoryResource) ;
 
-        // Ellipsoid
+        case Object::Type::Composite:
+            return CloneInto<Composite>(anObject, aMemoryResource) ;
 
-        if (const Ellipsoid* otherObjectPtr = dynamic_cast<const Ellipsoid*>(&anObject))
-        {
-            return objectPtr->intersectionWith(*otherObjectPtr) ;
-        }
+        default:
+            break ;
 
     }
 
-    std::cout << (*this) << std::endl ;
-    std::cout << anObject << std::endl ;
-
-    throw ostk::core::error::runtime::ToBeImplemented("Object :: intersectionWith") ;
+    // Objects of undefined type are cloned on the global heap
 
-    return Intersection::Undefined() ;
+    return Object::Pointer(anObject.clone()) ;
 
 }
 
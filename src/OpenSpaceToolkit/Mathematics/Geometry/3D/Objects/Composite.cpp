@@ -10,6 +10,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
@@ -29,47 +30,65 @@ namespace objects
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-                                Composite::Composite                        (   const   Object&                     anObject                                    )
+                                Composite::Composite                        (   const   Object&                     anObject,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
                                 :   Object(),
                                     defined_(true),
-                                    objects_(Array<Unique<Object>>::Empty())
+                                    objects_(Array<Object::Pointer>::Empty()),
+                                    memoryResourcePtr_(aMemoryResource)
 {
 
-    objects_.emplace_back(Unique<Object>(anObject.clone())) ;
+    objects_.emplace_back(Object::Clone(anObject, memoryResourcePtr_)) ;
 
 }
 
-                                Composite::Composite                        (   const   Unique<Object>&             anObjectUPtr                                )
+                                Composite::Composite                        (   const   Unique<Object>&             anObjectUPtr,
+                                                                                        std::pmr::memory_resource*  aMemoryResource                             )
                                 :   Object(),
                                     defined_(true),
-                                    objects_(Array<Unique<Object>>::Empty())
+                                    objects_(Array<Object::Pointer>::Empty()),
+                                    memoryResourcePtr_(aMemoryResource)
 {
 
-    objects_.emplace_back(Unique<Object>(anObjectUPtr->clone())) ;
+    objects_.emplace_back(Object::Clone(*anObjectUPtr, memoryResourcePtr_)) ;
 
 }
 
                                 Composite::Composite                        (           Array<Unique<Object>>&&     anObjectArray                               )
                                 :   Object(),
                                     defined_(true),
-                                    objects_(Array<Unique<Object>>::Empty())
+                                    objects_(Array<Object::Pointer>::Empty()),
+                                    memoryResourcePtr_(nullptr)
 {
 
     objects_.reserve(anObjectArray.getSize()) ;
 
-    std::transform(anObjectArray.begin(), anObjectArray.end(), std::back_inserter(objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
+    for (auto& objectUPtr : anObjectArray)
+    {
+        objects_.emplace_back(objectUPtr.release()) ;
+    }
+
+    anObjectArray.clear() ;
 
 }
 
                                 Composite::Composite                        (   const   Composite&                  aComposite                                  )
                                 :   Object(),
                                     defined_(aComposite.defined_),
-                                    objects_(Array<Unique<Object>>::Empty())
+                                    objects_(Array<Object::Pointer>::Empty()),
+                                    memoryResourcePtr_(nullptr)
 {
 
-    objects_.reserve(aComposite.objects_.getSize()) ;
+    this->appendClonesOf(aComposite.objects_) ;
 
-    std::transform(aComposite.objects_.begin(), aComposite.objects_.end(), std::back_inserter(objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
+}
+
+                                Composite::Composite                        (           Composite&&                 aComposite                                  )
+                                :   Object(),
+                                    defined_(aComposite.defined_),
+                                    objects_(std::move(aComposite.objects_)),
+                                    memoryResourcePtr_(aComposite.memoryResourcePtr_)
+{
 
 }
 
@@ -88,9 +107,23 @@ Composite&                      Composite::operator =                       (
 
         objects_.clear() ;
 
-        objects_.reserve(aComposite.objects_.getSize()) ;
+        this->appendClonesOf(aComposite.objects_) ;
+
+    }
 
-        std::transform(aComposite.objects_.begin(), aComposite.objects_.end(), std::back_inserter(objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
+    return *this ;
+
+}
+
+Composite&                      Composite::operator =                       (           Composite&&                 aComposite                                  )
+{
+
+    if (this != &aComposite)
+    {
+
+        defined_ = aComposite.defined_ ;
+        objects_ = std::move(aComposite.objects_) ;
+        memoryResourcePtr_ = aComposite.memoryResourcePtr_ ;
 
     }
 
@@ -145,10 +178,12 @@ Composite                       Composite::operator +                       (
 
     Composite composite = Composite::Empty() ;
 
+    composite.memoryResourcePtr_ = memoryResourcePtr_ ;
+
     composite.objects_.reserve(objects_.getSize() + aComposite.objects_.getSize()) ;
 
-    std::transform(objects_.begin(), objects_.end(), std::back_inserter(composite.objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
-    std::transform(aComposite.objects_.begin(), aComposite.objects_.end(), std::back_inserter(composite.objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
+    composite.appendClonesOf(objects_) ;
+    composite.appendClonesOf(aComposite.objects_) ;
 
     return composite ;
 
@@ -167,9 +202,7 @@ Composite&                      Composite::operator +=                      (
         throw ostk::core::error::runtime::Undefined("Composite") ;
     }
 
-    objects_.reserve(objects_.getSize() + aComposite.objects_.getSize()) ;
-
-    std::transform(aComposite.objects_.begin(), aComposite.objects_.end(), std::back_inserter(objects_), [] (const Unique<Object>& anObjectUPtr) -> Unique<Object> { return Unique<Object>(anObjectUPtr->clone()) ; }) ;
+    this->appendClonesOf(aComposite.objects_) ;
 
     return *this ;
 
@@ -177,7 +210,12 @@ Composite&                      Composite::operator +=                      (
 
 bool                            Composite::isDefined                        ( ) const
 {
-    return defined_ && std::all_of(objects_.begin(), objects_.end(), [] (const Unique<Object>& anObjectUPtr) -> bool { return anObjectUPtr->isDefined() ; }) ;
+    return defined_ && std::all_of(objects_.begin(), objects_.end(), [] (const Object::Pointer& anObjectUPtr) -> bool { return anObjectUPtr->isDefined() ; }) ;
+}
+
+Object::Type                    Composite::getType                          ( ) const
+{
+    return Object::Type::Composite ;
 }
 
 bool                            Composite::isEmpty                          ( ) const
@@ -205,7 +243,7 @@ bool                            Composite::intersects                       (
         throw ostk::core::error::runtime::Undefined("Composite") ;
     }
 
-    return std::any_of(objects_.begin(), objects_.end(), [&anObject] (const Unique<Object>& anObjectUPtr) -> bool { return anObjectUPtr->intersects(anObject) ; }) ;
+    return std::any_of(objects_.begin(), objects_.end(), [&anObject] (const Object::Pointer& anObjectUPtr) -> bool { return anObjectUPtr->intersects(anObject) ; }) ;
 
 }
 
@@ -222,7 +260,7 @@ bool                            Composite::intersects                       (
         throw ostk::core::error::runtime::Undefined("Composite") ;
     }
 
-    return std::any_of(aComposite.objects_.begin(), aComposite.objects_.end(), [this] (const Unique<Object>& anObjectUPtr) -> bool { return this->intersects(*anObjectUPtr) ; }) ;
+    return std::any_of(aComposite.objects_.begin(), aComposite.objects_.end(), [this] (const Object::Pointer& anObjectUPtr) -> bool { return this->intersects(*anObjectUPtr) ; }) ;
 
 }
 
@@ -239,7 +277,7 @@ bool                            Composite::contains                         (
         throw ostk::core::error::runtime::Undefined("Composite") ;
     }
 
-    return std::all_of(objects_.begin(), objects_.end(), [&anObject] (const Unique<Object>& anObjectUPtr) -> bool { return anObjectUPtr->contains(anObject) ; }) ;
+    return std::all_of(objects_.begin(), objects_.end(), [&anObject] (const Object::Pointer& anObjectUPtr) -> bool { return anObjectUPtr->contains(anObject) ; }) ;
 
 }
 
@@ -256,7 +294,7 @@ bool                            Composite::contains                         (
         throw ostk::core::error::runtime::Undefined("Composite") ;
     }
 
-    return std::all_of(aComposite.objects_.begin(), aComposite.objects_.end(), [this] (const Unique<Object>& anObjectUPtr) -> bool { return this->contains(*anObjectUPtr) ; }) ;
+    return std::all_of(aComposite.objects_.begin(), aComposite.objects_.end(), [this] (const Object::Pointer& anObjectUPtr) -> bool { return this->contains(*anObjectUPtr) ; }) ;
 
 }
 
@@ -277,7 +315,7 @@ const Object&                   Composite::accessObjectAt                   (
 
 }
 
-const Array<Unique<Object>>&    Composite::accessObjects                    ( ) const
+const Array<Object::Pointer>&   Composite::accessObjects                    ( ) const
 {
 
     if (!this->isDefined())
@@ -387,6 +425,39 @@ Composite::ConstIterator        Composite::end                              ( )
 
 }
 
+Cuboid                          Composite::getBoundingBox                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Composite") ;
+    }
+
+    if (objects_.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Cannot bound empty composite.") ;
+    }
+
+    Array<Point> corners = Array<Point>::Empty() ;
+
+    corners.reserve(2 * objects_.getSize()) ;
+
+    for (const auto& objectUPtr : objects_)
+    {
+
+        const Cuboid boundingBox = objectUPtr->getBoundingBox() ;
+
+        const Vector3d extent = { boundingBox.getFirstExtent(), boundingBox.getSecondExtent(), boundingBox.getThirdExtent() } ;
+
+        corners.add(boundingBox.getCenter() - extent) ;
+        corners.add(boundingBox.getCenter() + extent) ;
+
+    }
+
+    return Cuboid::BoundingBox(corners) ;
+
+}
+
 void                            Composite::print                            (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -456,6 +527,15 @@ Composite                       Composite::Empty                            ( )
     return Composite { Array<Unique<Object>>::Empty() } ;
 }
 
+void                            Composite::appendClonesOf                   (   const   Array<Object::Pointer>&     anObjectArray                               )
+{
+
+    objects_.reserve(objects_.getSize() + anObjectArray.getSize()) ;
+
+    std::transform(anObjectArray.begin(), anObjectArray.end(), std::back_inserter(objects_), [this] (const Object::Pointer& anObjectPtr) -> Object::Pointer { return Object::Clone(*anObjectPtr, memoryResourcePtr_) ; }) ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
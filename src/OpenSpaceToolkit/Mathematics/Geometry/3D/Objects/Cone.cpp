@@ -13,6 +13,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LateralFootprint.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
@@ -76,6 +77,11 @@ bool                            Cone::isDefined                          ( ) con
     return apex_.isDefined() && axis_.isDefined() && angle_.isDefined() ;
 }
 
+Object::Type                    Cone::getType                               ( ) const
+{
+    return Object::Type::Cone ;
+}
+
 bool                            Cone::intersects                            (   const   Sphere&                     aSphere,
                                                                                 const   Size                        aDiscretizationLevel                        ) const
 {
@@ -90,17 +96,9 @@ bool                            Cone::intersects                            (
         throw ostk::core::error::runtime::Undefined("Cone") ;
     }
 
-    for (const auto& ray : this->getRaysOfLateralSurface(aDiscretizationLevel)) // [TBM] Could be improved by calculating rays on the fly
-    {
-
-        if (ray.intersects(aSphere))
-        {
-            return true ;
-        }
-
-    }
+    (void) aDiscretizationLevel ;
 
-    return false ;
+    return this->getDistanceOfLateralSurfaceTo(aSphere.getCenter()) <= aSphere.getRadius() ;
 
 }
 
@@ -118,7 +116,29 @@ bool                            Cone::intersects                            (
         throw ostk::core::error::runtime::Undefined("Cone") ;
     }
 
-    for (const auto& ray : this->getRaysOfLateralSurface(aDiscretizationLevel)) // [TBM] Could be improved by calculating rays on the fly
+    // Conservative first stage: the ellipsoid lies between its inscribed and circumscribed spheres,
+    // so the lateral surface misses it if it misses the latter, and hits it if it hits the former
+
+    const Real firstPrincipalSemiAxis = anEllipsoid.getFirstPrincipalSemiAxis() ;
+    const Real secondPrincipalSemiAxis = anEllipsoid.getSecondPrincipalSemiAxis() ;
+    const Real thirdPrincipalSemiAxis = anEllipsoid.getThirdPrincipalSemiAxis() ;
+
+    const Real minimumSemiAxis = std::min({ firstPrincipalSemiAxis, secondPrincipalSemiAxis, thirdPrincipalSemiAxis }) ;
+    const Real maximumSemiAxis = std::max({ firstPrincipalSemiAxis, secondPrincipalSemiAxis, thirdPrincipalSemiAxis }) ;
+
+    const Real distance = this->getDistanceOfLateralSurfaceTo(anEllipsoid.getCenter()) ;
+
+    if (distance > maximumSemiAxis)
+    {
+        return false ;
+    }
+
+    if (distance <= minimumSemiAxis)
+    {
+        return true ;
+    }
+
+    for (const auto& ray : this->generateRaysOfLateralSurface(aDiscretizationLevel))
     {
 
         if (ray.intersects(anEllipsoid))
@@ -205,6 +225,23 @@ Array<Ray>                      Cone::getRaysOfLateralSurface               (
 
 }
 
+Cone::LateralRays               Cone::generateRaysOfLateralSurface          (   const   Size                        aRayCount                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cone") ;
+    }
+
+    if (aRayCount == 0)
+    {
+        throw ostk::core::error::runtime::Wrong("Ray count") ;
+    }
+
+    return { apex_, this->getLateralSurfaceBasis(), aRayCount } ;
+
+}
+
 Intersection                    Cone::intersectionWith                      (   const   Sphere&                     aSphere,
                                                                                 const   bool                        onlyInSight,
                                                                                 const   Size                        aDiscretizationLevel                        ) const
@@ -231,34 +268,19 @@ Intersection                    Cone::intersectionWith                      (
         if (!intersection.isEmpty())
         {
 
-            if (intersection.accessComposite().is<Point>())
+            if (intersection.is<Point>())
             {
-                firstIntersectionPoints.add(intersection.accessComposite().as<Point>()) ;
+                firstIntersectionPoints.add(intersection.as<Point>()) ;
             }
-            else if (intersection.accessComposite().is<PointSet>())
+            else if (intersection.is<PointSet>())
             {
 
-                const PointSet& pointSet = intersection.accessComposite().as<PointSet>() ;
-
-                bool secondIntersectionPointAdded = false ;
-
-                for (const auto& point : pointSet)
-                {
+                // Ray-sphere intersections are stored in place, ordered from the ray origin
 
-                    if (!secondIntersectionPointAdded)
-                    {
+                const std::pair<Point, Point>& points = intersection.accessPoints() ;
 
-                        secondIntersectionPoints.add(point) ;
-
-                        secondIntersectionPointAdded = true ;
-
-                    }
-                    else
-                    {
-                        firstIntersectionPoints.add(point) ;
-                    }
-
-                }
+                firstIntersectionPoints.add(points.first) ;
+                secondIntersectionPoints.add(points.second) ;
 
             }
 
@@ -298,64 +320,52 @@ Intersection                    Cone::intersectionWith                      (
         throw ostk::core::error::runtime::Undefined("Cone") ;
     }
 
-    Array<Point> firstIntersectionPoints = Array<Point>::Empty() ;
-    Array<Point> secondIntersectionPoints = Array<Point>::Empty() ;
-
-    for (const auto& ray : this->getRaysOfLateralSurface(aDiscretizationLevel))
+    if (aDiscretizationLevel == 0)
     {
+        throw ostk::core::error::runtime::Wrong("Ray count") ;
+    }
 
-        const Intersection intersection = ray.intersectionWith(anEllipsoid, onlyInSight) ;
-
-        if (!intersection.isEmpty())
-        {
-
-            if (intersection.accessComposite().is<Point>())
-            {
-                firstIntersectionPoints.add(intersection.accessComposite().as<Point>()) ;
-            }
-            else if (intersection.accessComposite().is<PointSet>())
-            {
-
-                const PointSet& pointSet = intersection.accessComposite().as<PointSet>() ;
-
-                const Point closestPointToApex = pointSet.getPointClosestTo(apex_) ;
-
-                firstIntersectionPoints.add(closestPointToApex) ;
-
-                for (const auto& point : pointSet)
-                {
-
-                    if (point != closestPointToApex)
-                    {
-
-                        secondIntersectionPoints.add(point) ;
-
-                        break ;
+    const Matrix3d lateralSurfaceBasis = this->getLateralSurfaceBasis() ;
 
-                    }
+    Matrix3Xd directions = Matrix3Xd(3, aDiscretizationLevel) ;
 
-                }
+    for (Index directionIndex = 0; directionIndex < aDiscretizationLevel; ++directionIndex)
+    {
+        directions.col(directionIndex) = Cone::DirectionOfLateralSurfaceAt(lateralSurfaceBasis, Real::TwoPi() * static_cast<double>(directionIndex) / static_cast<double>(aDiscretizationLevel)) ;
+    }
 
-            }
+    return footprint::IntersectionWith(apex_, anEllipsoid, onlyInSight, directions) ;
 
-        }
+}
 
-    }
+Intersection                    Cone::intersectionWith                      (   const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance                          ) const
+{
 
-    if ((!firstIntersectionPoints.isEmpty()) && (!secondIntersectionPoints.isEmpty()) && (!onlyInSight))
+    if (!anEllipsoid.isDefined())
     {
-        return Intersection::LineString(LineString(firstIntersectionPoints)) + Intersection::LineString(LineString(secondIntersectionPoints)) ;
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
-    else if (!firstIntersectionPoints.isEmpty())
+
+    if (!anAngularTolerance.isDefined())
     {
-        return Intersection::LineString(LineString(firstIntersectionPoints)) ;
+        throw ostk::core::error::runtime::Undefined("Angular tolerance") ;
     }
-    else if (!secondIntersectionPoints.isEmpty())
+
+    if (!this->isDefined())
     {
-        return Intersection::LineString(LineString(secondIntersectionPoints)) ;
+        throw ostk::core::error::runtime::Undefined("Cone") ;
     }
 
-    return Intersection::Empty() ;
+    // Generators are parametrized by their angle about the axis, and refined from 16 initial intervals
+
+    const Matrix3d lateralSurfaceBasis = this->getLateralSurfaceBasis() ;
+
+    return footprint::AdaptiveIntersectionWith(apex_, anEllipsoid, onlyInSight, anAngularTolerance, Real::TwoPi(), 16, [&lateralSurfaceBasis] (const double anAngle_rad) -> Vector3d
+    {
+        return Cone::DirectionOfLateralSurfaceAt(lateralSurfaceBasis, anAngle_rad) ;
+    }) ;
 
 }
 
@@ -398,6 +408,136 @@ Cone                            Cone::Undefined                             ( )
     return { Point::Undefined(), Vector3d::Undefined(), Angle::Undefined() } ;
 }
 
+Real                            Cone::getDistanceOfLateralSurfaceTo         (   const   Point&                      aPoint                                      ) const
+{
+
+    // The lateral surface is a surface of revolution, so the closest point lies in the meridian half-plane of the point,
+    // where the surface reduces to the generator ray at (cos(angle), sin(angle)) in (axial, radial) coordinates
+
+    const Vector3d axis = axis_.normalized() ;
+
+    const Vector3d apexToPoint = aPoint - apex_ ;
+
+    const double axialDistance = apexToPoint.dot(axis) ;
+    const double radialDistance = (apexToPoint - axialDistance * axis).norm() ;
+
+    const double angle_rad = angle_.inRadians() ;
+
+    const double cosine = std::cos(angle_rad) ;
+    const double sine = std::sin(angle_rad) ;
+
+    if (((axialDistance * cosine) + (radialDistance * sine)) <= 0.0)
+    {
+        return apexToPoint.norm() ;
+    }
+
+    return std::abs((radialDistance * cosine) - (axialDistance * sine)) ;
+
+}
+
+Matrix3d                        Cone::getLateralSurfaceBasis                ( ) const
+{
+
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    // Generators are parametrized as d(phi) = cos(angle) * axis + sin(angle) * (cos(phi) * u + sin(phi) * v),
+    // with u and v oriented so that the directions match the rays of getRaysOfLateralSurface
+
+    const Vector3d referenceDirection = (std::abs(axis_.dot(Vector3d::X())) < 0.5) ? axis_.cross(Vector3d::X()).normalized() : axis_.cross(Vector3d::Y()).normalized() ;
+
+    const Vector3d firstDirection = Quaternion::RotationVector(RotationVector(referenceDirection, angle_)).toConjugate() * axis_ ;
+    const Vector3d secondDirection = Quaternion::RotationVector(RotationVector(axis_, Angle::Degrees(90.0))).toConjugate() * firstDirection ;
+
+    const Vector3d axialComponent = axis_.dot(firstDirection) * axis_ ;
+
+    Matrix3d basis ;
+
+    basis.col(0) = axialComponent ;
+    basis.col(1) = firstDirection - axialComponent ;
+    basis.col(2) = secondDirection - axialComponent ;
+
+    return basis ;
+
+}
+
+Vector3d                        Cone::DirectionOfLateralSurfaceAt           (   const   Matrix3d&                   aLateralSurfaceBasis,
+                                                                                const   double                      anAngle_rad                                 )
+{
+    return aLateralSurfaceBasis * Vector3d { 1.0, std::cos(anAngle_rad), std::sin(anAngle_rad) } ;
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Cone::LateralRays::LateralRays              (   const   Point&                      anApex,
+                                                                                const   Matrix3d&                   aLateralSurfaceBasis,
+                                                                                const   Size                        aRayCount                                   )
+                                :   apex_(anApex),
+                                    basis_(aLateralSurfaceBasis),
+                                    rayCount_(aRayCount),
+                                    stepCosine_(std::cos(Real::TwoPi() / static_cast<double>(aRayCount))),
+                                    stepSine_(std::sin(Real::TwoPi() / static_cast<double>(aRayCount)))
+{
+
+}
+
+Size                            Cone::LateralRays::getSize                  ( ) const
+{
+    return rayCount_ ;
+}
+
+Cone::LateralRays::ConstIterator Cone::LateralRays::begin                   ( ) const
+{
+    return { this, 0 } ;
+}
+
+Cone::LateralRays::ConstIterator Cone::LateralRays::end                     ( ) const
+{
+    return { this, rayCount_ } ;
+}
+
+                                Cone::LateralRays::ConstIterator::ConstIterator (   const   LateralRays*                aLateralRaysPtr,
+                                                                                const   Index                       aRayIndex                                   )
+                                :   lateralRaysPtr_(aLateralRaysPtr),
+                                    rayIndex_(aRayIndex),
+                                    cosine_(1.0),
+                                    sine_(0.0)
+{
+
+}
+
+bool                            Cone::LateralRays::ConstIterator::operator == (   const   ConstIterator&              anIterator                                  ) const
+{
+    return (lateralRaysPtr_ == anIterator.lateralRaysPtr_) && (rayIndex_ == anIterator.rayIndex_) ;
+}
+
+bool                            Cone::LateralRays::ConstIterator::operator != (   const   ConstIterator&              anIterator                                  ) const
+{
+    return !((*this) == anIterator) ;
+}
+
+Ray                             Cone::LateralRays::ConstIterator::operator * ( ) const
+{
+    return { lateralRaysPtr_->apex_, lateralRaysPtr_->basis_ * Vector3d { 1.0, cosine_, sine_ } } ;
+}
+
+Cone::LateralRays::ConstIterator& Cone::LateralRays::ConstIterator::operator ++ ( )
+{
+
+    // Rotation of (cos(phi), sin(phi)) by the angular step
+
+    const double cosine = (cosine_ * lateralRaysPtr_->stepCosine_) - (sine_ * lateralRaysPtr_->stepSine_) ;
+    const double sine = (sine_ * lateralRaysPtr_->stepCosine_) + (cosine_ * lateralRaysPtr_->stepSine_) ;
+
+    cosine_ = cosine ;
+    sine_ = sine ;
+
+    ++rayIndex_ ;
+
+    return *this ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -17,6 +17,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Matrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Objects/Interval.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
@@ -32,6 +33,10 @@
 #include <Gte/Mathematics/GteIntrSegment3OrientedBox3.h>
 #include <Gte/Mathematics/GteIntrLine3OrientedBox3.h>
 
+#include <Eigen/Eigenvalues>
+
+#include <limits>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -181,6 +186,11 @@ bool                            Cuboid::isDefined                           ( )
 
 }
 
+Object::Type                    Cuboid::getType                             ( ) const
+{
+    return Object::Type::Cuboid ;
+}
+
 bool                            Cuboid::isNear                              (   const   Cuboid&                     aCuboid,
                                                                                 const   Real&                       aTolerance                                  ) const
 {
@@ -463,6 +473,44 @@ Array<Cuboid::Vertex>           Cuboid::getVertices                         ( )
 
 }
 
+Cuboid                          Cuboid::getBoundingBox                      ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cuboid") ;
+    }
+
+    const Vector3d extent = (extent_[0] * axes_[0].cwiseAbs()) + (extent_[1] * axes_[1].cwiseAbs()) + (extent_[2] * axes_[2].cwiseAbs()) ;
+
+    return { center_, { Vector3d::X(), Vector3d::Y(), Vector3d::Z() }, { extent.x(), extent.y(), extent.z() } } ;
+
+}
+
+Cuboid                          Cuboid::getOrientedBoundingBox              ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cuboid") ;
+    }
+
+    return *this ;
+
+}
+
+Sphere                          Cuboid::getBoundingSphere                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Cuboid") ;
+    }
+
+    return { center_, Vector3d(extent_[0], extent_[1], extent_[2]).norm() } ;
+
+}
+
 void                            Cuboid::print                               (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -542,6 +590,129 @@ Cuboid                          Cuboid::Cube                                (
 
 }
 
+Cuboid                          Cuboid::BoundingBox                         (   const   Array<Point>&               aPointArray                                 )
+{
+
+    if (aPointArray.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Cannot bound empty point array.") ;
+    }
+
+    Vector3d minimum = aPointArray.accessFirst().asVector() ;
+    Vector3d maximum = minimum ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        if (!point.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Point") ;
+        }
+
+        const Vector3d coordinates = point.asVector() ;
+
+        minimum = minimum.cwiseMin(coordinates) ;
+        maximum = maximum.cwiseMax(coordinates) ;
+
+    }
+
+    const Vector3d extent = (maximum - minimum) / 2.0 ;
+
+    return { Point::Vector((minimum + maximum) / 2.0), { Vector3d::X(), Vector3d::Y(), Vector3d::Z() }, { extent.x(), extent.y(), extent.z() } } ;
+
+}
+
+Cuboid                          Cuboid::OrientedBoundingBox                 (   const   Array<Point>&               aPointArray                                 )
+{
+
+    using ostk::math::obj::Matrix3d ;
+
+    const Cuboid boundingBox = Cuboid::BoundingBox(aPointArray) ;
+
+    Vector3d mean = Vector3d::Zero() ;
+
+    for (const auto& point : aPointArray)
+    {
+        mean += point.asVector() ;
+    }
+
+    mean /= static_cast<double>(aPointArray.getSize()) ;
+
+    Matrix3d covariance = Matrix3d::Zero() ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        const Vector3d deviation = point.asVector() - mean ;
+
+        covariance += deviation * deviation.transpose() ;
+
+    }
+
+    const Eigen::SelfAdjointEigenSolver<Matrix3d> eigenSolver(covariance) ;
+
+    if (eigenSolver.info() != Eigen::Success)
+    {
+        return boundingBox ;
+    }
+
+    // Eigenvalues are sorted in increasing order: the first axis carries the largest spread
+
+    const Vector3d firstAxis = eigenSolver.eigenvectors().col(2).normalized() ;
+    const Vector3d secondAxis = eigenSolver.eigenvectors().col(1).normalized() ;
+    const Vector3d thirdAxis = firstAxis.cross(secondAxis) ;
+
+    Matrix3d rotation ;
+
+    rotation.row(0) = firstAxis ;
+    rotation.row(1) = secondAxis ;
+    rotation.row(2) = thirdAxis ;
+
+    Vector3d minimum = Vector3d::Constant(+std::numeric_limits<double>::infinity()) ;
+    Vector3d maximum = Vector3d::Constant(-std::numeric_limits<double>::infinity()) ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        const Vector3d coordinates = rotation * (point.asVector() - mean) ;
+
+        minimum = minimum.cwiseMin(coordinates) ;
+        maximum = maximum.cwiseMax(coordinates) ;
+
+    }
+
+    const Vector3d extent = (maximum - minimum) / 2.0 ;
+    const Vector3d boundingBoxExtent = { boundingBox.extent_[0], boundingBox.extent_[1], boundingBox.extent_[2] } ;
+
+    // Flat point sets have no volume: their boxes are then compared by area
+
+    const auto isSmaller = [] (const Vector3d& anExtent, const Vector3d& anotherExtent) -> bool
+    {
+
+        const double volume = anExtent.prod() ;
+        const double anotherVolume = anotherExtent.prod() ;
+
+        if (volume != anotherVolume)
+        {
+            return volume < anotherVolume ;
+        }
+
+        return (anExtent.x() * anExtent.y() + anExtent.y() * anExtent.z() + anExtent.z() * anExtent.x())
+             < (anotherExtent.x() * anotherExtent.y() + anotherExtent.y() * anotherExtent.z() + anotherExtent.z() * anotherExtent.x()) ;
+
+    } ;
+
+    if (!isSmaller(extent, boundingBoxExtent))
+    {
+        return boundingBox ;
+    }
+
+    const Vector3d center = mean + rotation.transpose() * ((minimum + maximum) / 2.0) ;
+
+    return { Point::Vector(center), { firstAxis, secondAxis, thirdAxis }, { extent.x(), extent.y(), extent.z() } } ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
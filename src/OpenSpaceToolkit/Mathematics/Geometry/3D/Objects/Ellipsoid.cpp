@@ -14,6 +14,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
@@ -42,6 +43,7 @@
 
 #pragma GCC diagnostic pop // Turn the warnings back on
 
+#include <limits>
 #include <math.h>
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -104,6 +106,8 @@ Point                           EllipsoidPointFromGteVector                 (
         throw ostk::core::error::RuntimeError("Third principal semi-axis is negative.") ;
     }
 
+    this->updateQuadric() ;
+
 }
 
 Ellipsoid*                      Ellipsoid::clone                            ( ) const
@@ -145,6 +149,11 @@ bool                            Ellipsoid::isDefined                        ( )
     return center_.isDefined() && a_.isDefined() && b_.isDefined() && c_.isDefined() && q_.isDefined() ;
 }
 
+Object::Type                    Ellipsoid::getType                          ( ) const
+{
+    return Object::Type::Ellipsoid ;
+}
+
 bool                            Ellipsoid::intersects                       (   const   Point&                      aPoint                                      ) const
 {
     return this->contains(aPoint) ;
@@ -182,7 +191,7 @@ bool                            Ellipsoid::intersects                       (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -217,7 +226,7 @@ bool                            Ellipsoid::intersects                       (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -280,7 +289,7 @@ bool                            Ellipsoid::intersects                       (
     const Vector3d segmentCenter = aSegment.getCenter().asVector() ;
     const Real segmentHalfLength = aSegment.getLength() / 2.0 ;
 
-    const Matrix3d M = this->getMatrix() ;
+    const Matrix3d& M = matrix_ ;
 
     const Vector3d diff = segmentCenter - center_.asVector() ;
     const Vector3d matDir = M * segmentDirection ;
@@ -375,7 +384,7 @@ bool                            Ellipsoid::intersects                       (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -423,7 +432,7 @@ bool                            Ellipsoid::intersects                       (
 //     // Ellipsoid
 
 //     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-//     const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+//     const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
 //     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
 //     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -471,13 +480,7 @@ bool                            Ellipsoid::contains                         (
         throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
 
-    Matrix3d dcm ;
-
-    dcm.row(0) = q_ * Vector3d::X() ;
-    dcm.row(1) = q_ * Vector3d::Y() ;
-    dcm.row(2) = q_ * Vector3d::Z() ;
-
-    const Vector3d point = dcm * (aPoint - center_) ;
+    const Vector3d point = axes_ * (aPoint - center_) ;
 
     const Real& x = point.x() ;
     const Real& y = point.y() ;
@@ -560,7 +563,7 @@ Vector3d                        Ellipsoid::getFirstAxis                     ( )
         throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
 
-    return q_.toConjugate() * Vector3d::X() ;
+    return axes_.row(0) ;
 
 }
 
@@ -572,7 +575,7 @@ Vector3d                        Ellipsoid::getSecondAxis                    ( )
         throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
 
-    return q_.toConjugate() * Vector3d::Y() ;
+    return axes_.row(1) ;
 
 }
 
@@ -584,7 +587,7 @@ Vector3d                        Ellipsoid::getThirdAxis                     ( )
         throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
 
-    return q_.toConjugate() * Vector3d::Z() ;
+    return axes_.row(2) ;
 
 }
 
@@ -608,32 +611,13 @@ Matrix3d                        Ellipsoid::getMatrix                        ( )
         throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
     }
 
-    const Vector3d firstRatio = this->getFirstAxis() / a_ ;
-	const Vector3d secondRatio = this->getSecondAxis() / b_ ;
-	const Vector3d thirdRatio = this->getThirdAxis() / c_ ;
-
-    auto tensorProduct = [] (const Vector3d& aFirstVector, const Vector3d& aSecondVector) -> Matrix3d
-    {
-
-        Matrix3d tensorProductMatrix ;
-
-        tensorProductMatrix <<  aFirstVector(0) * aSecondVector(0), aFirstVector(0) * aSecondVector(1), aFirstVector(0) * aSecondVector(2),
-                                aFirstVector(1) * aSecondVector(0), aFirstVector(1) * aSecondVector(1), aFirstVector(1) * aSecondVector(2),
-                                aFirstVector(2) * aSecondVector(0), aFirstVector(2) * aSecondVector(1), aFirstVector(2) * aSecondVector(2) ;
-
-        return tensorProductMatrix ;
-
-    } ;
-
-	return tensorProduct(firstRatio, firstRatio) + tensorProduct(secondRatio, secondRatio) + tensorProduct(thirdRatio, thirdRatio) ;
+    return matrix_ ;
 
 }
 
 Intersection                    Ellipsoid::intersectionWith                 (   const   Line&                       aLine                                       ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aLine.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Line") ;
@@ -651,7 +635,7 @@ Intersection                    Ellipsoid::intersectionWith                 (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -671,7 +655,7 @@ Intersection                    Ellipsoid::intersectionWith                 (
         }
         else if (intersectionResult.numIntersections == 2)
         {
-            return Intersection::PointSet(PointSet({ Point(EllipsoidPointFromGteVector(intersectionResult.point[0])), Point(EllipsoidPointFromGteVector(intersectionResult.point[1])) })) ;
+            return Intersection::PointSet(EllipsoidPointFromGteVector(intersectionResult.point[0]), EllipsoidPointFromGteVector(intersectionResult.point[1])) ;
         }
         else
         {
@@ -688,8 +672,6 @@ Intersection                    Ellipsoid::intersectionWith                 (
                                                                                 const   bool                        onlyInSight                                 ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aRay.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Ray") ;
@@ -707,7 +689,7 @@ Intersection                    Ellipsoid::intersectionWith                 (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -760,9 +742,12 @@ Intersection                    Ellipsoid::intersectionWith                 (
                 return Intersection::Point(firstPoint) ;
             }
 
-            const PointSet pointSet = { { firstPoint, secondPoint } } ;
+            if (onlyInSight)
+            {
+                return Intersection::Point((firstPoint.distanceTo(aRay.getOrigin()) <= secondPoint.distanceTo(aRay.getOrigin())) ? firstPoint : secondPoint) ;
+            }
 
-            return onlyInSight ? Intersection::Point(pointSet.getPointClosestTo(aRay.getOrigin())) : Intersection::PointSet(pointSet) ;
+            return Intersection::PointSet(firstPoint, secondPoint) ;
 
         }
         else
@@ -779,8 +764,6 @@ Intersection                    Ellipsoid::intersectionWith                 (
 Intersection                    Ellipsoid::intersectionWith                 (   const   Segment&                    aSegment                                    ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aSegment.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Segment") ;
@@ -803,7 +786,7 @@ Intersection                    Ellipsoid::intersectionWith                 (
     // Ellipsoid
 
     const gte::Vector3<double> center = EllipsoidGteVectorFromPoint(center_) ;
-    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(this->getFirstAxis()), EllipsoidGteVectorFromVector3d(this->getSecondAxis()), EllipsoidGteVectorFromVector3d(this->getThirdAxis()) } ;
+    const std::array<gte::Vector3<double>, 3> axes = { EllipsoidGteVectorFromVector3d(axes_.row(0)), EllipsoidGteVectorFromVector3d(axes_.row(1)), EllipsoidGteVectorFromVector3d(axes_.row(2)) } ;
     const gte::Vector3<double> extent = { a_, b_, c_ } ;
 
     const gte::Ellipsoid3<double> ellipsoid = { center, axes, extent } ;
@@ -894,7 +877,7 @@ Intersection                    Ellipsoid::intersectionWith                 (
 
             }
 
-            return Intersection::PointSet(PointSet({ firstPoint, secondPoint })) ;
+            return Intersection::PointSet(firstPoint, secondPoint) ;
 
         }
         else
@@ -920,6 +903,94 @@ Intersection                    Ellipsoid::intersectionWith                 (
     return aCone.intersectionWith(*this, onlyInSight) ;
 }
 
+Ellipsoid::RayIntersections     Ellipsoid::intersectRays                    (   const   Matrix3Xd&                  anOriginArray,
+                                                                                const   Matrix3Xd&                  aDirectionArray,
+                                                                                const   bool                        onlyInSight                                 ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
+    }
+
+    if (anOriginArray.cols() != aDirectionArray.cols())
+    {
+        throw ostk::core::error::RuntimeError("Origin count [{}] is different from direction count [{}].", anOriginArray.cols(), aDirectionArray.cols()) ;
+    }
+
+    // Rays are mapped into the frame where the ellipsoid is a unit sphere
+
+    const Matrix3Xd scaledOrigins = scaledAxes_ * (anOriginArray.colwise() - center_.asVector()) ;
+    const Matrix3Xd scaledDirections = scaledAxes_ * aDirectionArray ;
+
+    // |p' + t d'|^2 = 1 <=> a2 t^2 + 2 a1 t + a0 = 0
+
+    const Eigen::ArrayXd a2 = scaledDirections.colwise().squaredNorm().transpose().array() ;
+    const Eigen::ArrayXd a1 = scaledDirections.cwiseProduct(scaledOrigins).colwise().sum().transpose().array() ;
+    const Eigen::ArrayXd a0 = scaledOrigins.colwise().squaredNorm().transpose().array() - 1.0 ;
+
+    const Eigen::ArrayXd discriminant = a1.square() - (a0 * a2) ;
+    const Eigen::ArrayXd discriminantRoot = discriminant.max(0.0).sqrt() ;
+
+    const Eigen::ArrayXd t0 = (-a1 - discriminantRoot) / a2 ;
+    const Eigen::ArrayXd t1 = (-a1 + discriminantRoot) / a2 ;
+
+    // Zero directions (a2 = 0) give undefined ranges, and are reported as misses
+
+    const Eigen::Array<bool, Eigen::Dynamic, 1> hits = (a2 > 0.0) && (discriminant >= 0.0) && (t1 >= 0.0) ;
+
+    static const double undefinedRange = std::numeric_limits<double>::quiet_NaN() ;
+
+    RayIntersections rayIntersections ;
+
+    rayIntersections.hits = hits.matrix() ;
+    rayIntersections.nearRanges = hits.select((t0 >= 0.0).select(t0, t1), undefinedRange).matrix() ; // Ray origin inside ellipsoid: only exit point is in sight
+    rayIntersections.farRanges = onlyInSight ? rayIntersections.nearRanges : hits.select(t1, undefinedRange).matrix() ;
+
+    return rayIntersections ;
+
+}
+
+Cuboid                          Ellipsoid::getBoundingBox                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
+    }
+
+    // The extent of the ellipsoid along a unit vector u is sqrt(sum_i (a_i * (e_i . u))^2), e_i being its axes and a_i its semi-axes
+
+    const Vector3d extent = (Vector3d(a_, b_, c_).asDiagonal() * axes_).colwise().norm() ;
+
+    return { center_, { Vector3d::X(), Vector3d::Y(), Vector3d::Z() }, { extent.x(), extent.y(), extent.z() } } ;
+
+}
+
+Cuboid                          Ellipsoid::getOrientedBoundingBox           ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
+    }
+
+    return { center_, { axes_.row(0), axes_.row(1), axes_.row(2) }, { a_, b_, c_ } } ;
+
+}
+
+Sphere                          Ellipsoid::getBoundingSphere                ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
+    }
+
+    return { center_, std::max({ a_, b_, c_ }) } ;
+
+}
+
 void                            Ellipsoid::print                            (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -984,6 +1055,8 @@ void                            Ellipsoid::applyTransformation              (
 
     q_ = Quaternion::RotationMatrix(RotationMatrix::Columns(firstAxis, secondAxis, thirdAxis)).conjugate() ;
 
+    this->updateQuadric() ;
+
 }
 
 Ellipsoid                       Ellipsoid::Undefined                        ( )
@@ -991,6 +1064,36 @@ Ellipsoid                       Ellipsoid::Undefined                        ( )
     return { Point::Undefined(), Real::Undefined(), Real::Undefined(), Real::Undefined(), Quaternion::Undefined() } ;
 }
 
+void                            Ellipsoid::updateQuadric                    ( )
+{
+
+    if (!this->isDefined())
+    {
+
+        axes_ = Matrix3d::Undefined() ;
+        scaledAxes_ = Matrix3d::Undefined() ;
+        matrix_ = Matrix3d::Undefined() ;
+
+        return ;
+
+    }
+
+    const Quaternion orientation = q_.toConjugate() ;
+
+    axes_.row(0) = orientation * Vector3d::X() ;
+    axes_.row(1) = orientation * Vector3d::Y() ;
+    axes_.row(2) = orientation * Vector3d::Z() ;
+
+    scaledAxes_.row(0) = axes_.row(0) / a_ ;
+    scaledAxes_.row(1) = axes_.row(1) / b_ ;
+    scaledAxes_.row(2) = axes_.row(2) / c_ ;
+
+    // Sum of the tensor products of the scaled axes
+
+    matrix_ = scaledAxes_.transpose() * scaledAxes_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
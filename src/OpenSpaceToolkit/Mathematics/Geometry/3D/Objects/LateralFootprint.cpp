@@ -0,0 +1,287 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LateralFootprint.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LateralFootprint.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LineString.hpp>
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <cmath>
+#include <utility>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace objects
+{
+namespace footprint
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::core::types::Index ;
+using ostk::core::ctnr::Array ;
+
+using ostk::math::obj::Matrix3d ;
+
+struct Sample
+{
+
+    double                      parameter ;
+    bool                        hit ;
+    Vector3d                    nearVector ;
+    Vector3d                    farVector ;
+
+} ;
+
+double                          TurningAngle                                (   const   Vector3d&                   aFirstVector,
+                                                                                const   Vector3d&                   aMiddleVector,
+                                                                                const   Vector3d&                   aLastVector                                 )
+{
+
+    const Vector3d firstChord = aMiddleVector - aFirstVector ;
+    const Vector3d secondChord = aLastVector - aMiddleVector ;
+
+    return std::atan2(firstChord.cross(secondChord).norm(), firstChord.dot(secondChord)) ;
+
+}
+
+Intersection                    IntersectionFromPoints                      (   const   Array<Point>&               aFirstPointArray,
+                                                                                const   Array<Point>&               aSecondPointArray,
+                                                                                const   bool                        onlyInSight                                 )
+{
+
+    if ((!aFirstPointArray.isEmpty()) && (!aSecondPointArray.isEmpty()) && (!onlyInSight))
+    {
+        return Intersection::LineString(LineString(aFirstPointArray)) + Intersection::LineString(LineString(aSecondPointArray)) ;
+    }
+    else if (!aFirstPointArray.isEmpty())
+    {
+        return Intersection::LineString(LineString(aFirstPointArray)) ;
+    }
+    else if (!aSecondPointArray.isEmpty())
+    {
+        return Intersection::LineString(LineString(aSecondPointArray)) ;
+    }
+
+    return Intersection::Empty() ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+Intersection                    IntersectionWith                            (   const   Point&                      anApex,
+                                                                                const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Matrix3Xd&                  aDirectionArray                             )
+{
+
+    const Ellipsoid::RayIntersections intersections = anEllipsoid.intersectRays(anApex.asVector().replicate(1, aDirectionArray.cols()), aDirectionArray, onlyInSight) ;
+
+    Array<Point> firstIntersectionPoints = Array<Point>::Empty() ;
+    Array<Point> secondIntersectionPoints = Array<Point>::Empty() ;
+
+    firstIntersectionPoints.reserve(aDirectionArray.cols()) ;
+    secondIntersectionPoints.reserve(onlyInSight ? 0 : aDirectionArray.cols()) ;
+
+    for (Index directionIndex = 0; directionIndex < static_cast<Index>(aDirectionArray.cols()); ++directionIndex)
+    {
+
+        if (intersections.hits(directionIndex))
+        {
+
+            const Vector3d direction = aDirectionArray.col(directionIndex) ;
+
+            firstIntersectionPoints.add(anApex + intersections.nearRanges(directionIndex) * direction) ;
+
+            if (intersections.farRanges(directionIndex) > intersections.nearRanges(directionIndex))
+            {
+                secondIntersectionPoints.add(anApex + intersections.farRanges(directionIndex) * direction) ;
+            }
+
+        }
+
+    }
+
+    return IntersectionFromPoints(firstIntersectionPoints, secondIntersectionPoints, onlyInSight) ;
+
+}
+
+Intersection                    AdaptiveIntersectionWith                    (   const   Point&                      anApex,
+                                                                                const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance,
+                                                                                const   double                      aParameterRange,
+                                                                                const   Size                        anInitialIntervalCount,
+                                                                                const   std::function<Vector3d (double)>& aDirectionGenerator                   )
+{
+
+    if (anAngularTolerance.inRadians() <= 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Angular tolerance [{}] is not strictly positive.", anAngularTolerance.toString()) ;
+    }
+
+    static const Size maximumSubdivisionDepth = 12 ;
+
+    // Rays are solved against the ellipsoid quadric (x - c)^T Q (x - c) = 1, relative to the apex
+
+    const Matrix3d quadricMatrix = anEllipsoid.getMatrix() ;
+    const Vector3d apexOffset = anApex - anEllipsoid.getCenter() ;
+    const Vector3d quadricApexOffset = quadricMatrix * apexOffset ;
+    const double apexQuadricValue = apexOffset.dot(quadricApexOffset) - 1.0 ;
+
+    const auto sampleAt = [&aDirectionGenerator, &quadricMatrix, &quadricApexOffset, apexQuadricValue, onlyInSight] (const double aParameter) -> Sample
+    {
+
+        const Vector3d direction = aDirectionGenerator(aParameter) ;
+
+        const double a2 = direction.dot(quadricMatrix * direction) ;
+        const double a1 = direction.dot(quadricApexOffset) ;
+
+        const double discriminant = (a1 * a1) - (apexQuadricValue * a2) ;
+
+        if (discriminant < 0.0)
+        {
+            return { aParameter, false, Vector3d::Zero(), Vector3d::Zero() } ;
+        }
+
+        const double nearRange = (-a1 - std::sqrt(discriminant)) / a2 ;
+        const double farRange = (-a1 + std::sqrt(discriminant)) / a2 ;
+
+        if (farRange < 0.0)
+        {
+            return { aParameter, false, Vector3d::Zero(), Vector3d::Zero() } ;
+        }
+
+        const double inSightRange = (nearRange >= 0.0) ? nearRange : farRange ; // Apex inside ellipsoid: only exit point is in sight
+
+        return { aParameter, true, inSightRange * direction, (onlyInSight ? inSightRange : farRange) * direction } ;
+
+    } ;
+
+    // The turning angle tested at the midpoint of an interval is about half of the one left at its endpoints, once the midpoint is dropped
+
+    const double midpointTolerance_rad = 0.5 * anAngularTolerance.inRadians() ;
+
+    const auto isRefinable = [midpointTolerance_rad, onlyInSight] (const Sample& aFirstSample, const Sample& aMiddleSample, const Sample& aLastSample) -> bool
+    {
+
+        if ((aFirstSample.hit != aMiddleSample.hit) || (aMiddleSample.hit != aLastSample.hit))
+        {
+            return true ; // Interval crosses the ellipsoid limb
+        }
+
+        if (!aMiddleSample.hit)
+        {
+            return false ;
+        }
+
+        return (TurningAngle(aFirstSample.nearVector, aMiddleSample.nearVector, aLastSample.nearVector) > midpointTolerance_rad)
+            || ((!onlyInSight) && (TurningAngle(aFirstSample.farVector, aMiddleSample.farVector, aLastSample.farVector) > midpointTolerance_rad)) ;
+
+    } ;
+
+    // Depth-first subdivision of each initial interval, samples being emitted in parameter order
+
+    Array<Sample> samples = Array<Sample>::Empty() ;
+    Array<std::pair<Sample, Size>> pendingSamples = Array<std::pair<Sample, Size>>::Empty() ;
+
+    samples.add(sampleAt(0.0)) ;
+
+    for (Index intervalIndex = 0; intervalIndex < anInitialIntervalCount; ++intervalIndex)
+    {
+
+        pendingSamples.add({ sampleAt(aParameterRange * static_cast<double>(intervalIndex + 1) / static_cast<double>(anInitialIntervalCount)), 0 }) ;
+
+        while (!pendingSamples.isEmpty())
+        {
+
+            const Sample& firstSample = samples.accessLast() ;
+            std::pair<Sample, Size>& lastSample = pendingSamples.back() ;
+
+            if (lastSample.second < maximumSubdivisionDepth)
+            {
+
+                const Sample middleSample = sampleAt(0.5 * (firstSample.parameter + lastSample.first.parameter)) ;
+
+                if (isRefinable(firstSample, middleSample, lastSample.first))
+                {
+
+                    const Size depth = ++lastSample.second ;
+
+                    pendingSamples.add({ middleSample, depth }) ;
+
+                    continue ;
+
+                }
+
+            }
+
+            samples.add(lastSample.first) ;
+            pendingSamples.pop_back() ;
+
+        }
+
+    }
+
+    // The closing sample duplicates the first one, and is therefore skipped
+
+    Array<Point> firstIntersectionPoints = Array<Point>::Empty() ;
+    Array<Point> secondIntersectionPoints = Array<Point>::Empty() ;
+
+    firstIntersectionPoints.reserve(samples.getSize() - 1) ;
+    secondIntersectionPoints.reserve(onlyInSight ? 0 : samples.getSize() - 1) ;
+
+    for (Index sampleIndex = 0; sampleIndex < (samples.getSize() - 1); ++sampleIndex)
+    {
+
+        const Sample& sample = samples.at(sampleIndex) ;
+
+        if (sample.hit)
+        {
+
+            firstIntersectionPoints.add(anApex + sample.nearVector) ;
+
+            if (sample.farVector != sample.nearVector)
+            {
+                secondIntersectionPoints.add(anApex + sample.farVector) ;
+            }
+
+        }
+
+    }
+
+    return IntersectionFromPoints(firstIntersectionPoints, secondIntersectionPoints, onlyInSight) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
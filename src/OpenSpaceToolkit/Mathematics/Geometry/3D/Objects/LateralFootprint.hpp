@@ -0,0 +1,103 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LateralFootprint.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LateralFootprint__
+#define __OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LateralFootprint__
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Objects/Vector.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+
+#include <functional>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace objects
+{
+namespace footprint
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Size ;
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::obj::Matrix3Xd ;
+using ostk::math::geom::Angle ;
+using ostk::math::geom::d3::Intersection ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Footprint on an ellipsoid of a lateral surface sampled by rays from an apex
+///
+///                             Rays are intersected with the ellipsoid in a single batch (see Ellipsoid::intersectRays),
+///                             and the footprint is the polyline through their intersection points.
+///
+/// @param                      [in] anApex An apex
+/// @param                      [in] anEllipsoid An ellipsoid
+/// @param                      [in] onlyInSight If true, only return intersection points that are in sight
+/// @param                      [in] aDirectionArray An array of ray directions, in footprint order
+/// @return                     Near (and far, if not only in sight) footprint line strings
+
+Intersection                    IntersectionWith                            (   const   Point&                      anApex,
+                                                                                const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Matrix3Xd&                  aDirectionArray                             ) ;
+
+/// @brief                      Footprint on an ellipsoid of a closed lateral surface swept by rays from an apex, with adaptive sampling
+///
+///                             Ray directions are given by aDirectionGenerator over the parameter range [0, aParameterRange],
+///                             the direction at aParameterRange closing the surface onto the direction at 0.
+///                             The range is split into anInitialIntervalCount intervals, whose bounds are always sampled.
+///                             Each interval is then subdivided depth-first while the footprint polyline turns by more than
+///                             the angular tolerance at its midpoint, or while its samples straddle the ellipsoid limb.
+///
+/// @param                      [in] anApex An apex
+/// @param                      [in] anEllipsoid An ellipsoid
+/// @param                      [in] onlyInSight If true, only return intersection points that are in sight
+/// @param                      [in] anAngularTolerance A maximum turning angle between consecutive footprint segments
+/// @param                      [in] aParameterRange A parameter range
+/// @param                      [in] anInitialIntervalCount An initial interval count
+/// @param                      [in] aDirectionGenerator A generator of ray direction from parameter
+/// @return                     Near (and far, if not only in sight) footprint line strings
+
+Intersection                    AdaptiveIntersectionWith                    (   const   Point&                      anApex,
+                                                                                const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance,
+                                                                                const   double                      aParameterRange,
+                                                                                const   Size                        anInitialIntervalCount,
+                                                                                const   std::function<Vector3d (double)>& aDirectionGenerator                   ) ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
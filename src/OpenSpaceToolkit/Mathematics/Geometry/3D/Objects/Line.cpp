@@ -85,6 +85,11 @@ bool                            Line::isDefined                             ( )
     return origin_.isDefined() && direction_.isDefined() ;
 }
 
+Object::Type                    Line::getType                               ( ) const
+{
+    return Object::Type::Line ;
+}
+
 bool                            Line::intersects                            (   const   Point&                      aPoint                                      ) const
 {
     return this->contains(aPoint) ;
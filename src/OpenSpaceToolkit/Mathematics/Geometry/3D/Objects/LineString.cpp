@@ -7,13 +7,22 @@
 
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+#include <OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -27,13 +36,59 @@ namespace d3
 namespace objects
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Line strings with fewer segments than this are projected onto linearly, unless an index is built explicitly
+
+constexpr std::size_t IndexingThreshold = 64 ;
+
+}
+
+/// @brief                      Bounding volume hierarchy over the segments of a line string
+
+class LineString::SegmentTree : public geom::SegmentTree<Point>
+{
+
+    public:
+
+        using                   geom::SegmentTree<Point>::SegmentTree ;
+
+} ;
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 LineString::LineString                      (   const   Array<Point>&               aPointArray                                 )
                                 :   Object(),
-                                    points_(aPointArray)
+                                    points_(aPointArray),
+                                    indexSPtr_(nullptr),
+                                    boundingBoxSPtr_(nullptr),
+                                    orientedBoundingBoxSPtr_(nullptr),
+                                    boundingSphereSPtr_(nullptr),
+                                    indexMutex_()
 {
 
+}
+
+                                LineString::LineString                      (   const   LineString&                 aLineString                                 )
+                                :   Object(),
+                                    points_(aLineString.points_),
+                                    indexSPtr_(nullptr),
+                                    boundingBoxSPtr_(nullptr),
+                                    orientedBoundingBoxSPtr_(nullptr),
+                                    boundingSphereSPtr_(nullptr),
+                                    indexMutex_()
+{
+
+    const std::lock_guard<std::mutex> lock { aLineString.indexMutex_ } ;
+
+    indexSPtr_ = aLineString.indexSPtr_ ;
+    boundingBoxSPtr_ = aLineString.boundingBoxSPtr_ ;
+    orientedBoundingBoxSPtr_ = aLineString.orientedBoundingBoxSPtr_ ;
+    boundingSphereSPtr_ = aLineString.boundingSphereSPtr_ ;
+
 }
 
 LineString*                     LineString::clone                           ( ) const
@@ -41,6 +96,27 @@ LineString*                     LineString::clone                           ( )
     return new LineString(*this) ;
 }
 
+LineString&                     LineString::operator =                      (   const   LineString&                 aLineString                                 )
+{
+
+    if (this != &aLineString)
+    {
+
+        points_ = aLineString.points_ ;
+
+        const std::scoped_lock lock { indexMutex_, aLineString.indexMutex_ } ;
+
+        indexSPtr_ = aLineString.indexSPtr_ ;
+        boundingBoxSPtr_ = aLineString.boundingBoxSPtr_ ;
+        orientedBoundingBoxSPtr_ = aLineString.orientedBoundingBoxSPtr_ ;
+        boundingSphereSPtr_ = aLineString.boundingSphereSPtr_ ;
+
+    }
+
+    return *this ;
+
+}
+
 bool                            LineString::operator ==                     (   const   LineString&                 aLineString                                 ) const
 {
     return points_ == aLineString.points_ ;
@@ -56,6 +132,11 @@ bool                            LineString::isDefined                       ( )
     return !points_.isEmpty() ;
 }
 
+Object::Type                    LineString::getType                         ( ) const
+{
+    return Object::Type::LineString ;
+}
+
 bool                            LineString::isEmpty                         ( ) const
 {
     return points_.isEmpty() ;
@@ -142,6 +223,98 @@ Point                           LineString::getPointClosestTo               (
 
 }
 
+LineString::Projection          LineString::getProjectionOf                 (   const   Point&                      aPoint                                      ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    // Short line strings are scanned linearly, rather than through a temporary hierarchy
+
+    const Shared<const LineString::SegmentTree> indexSPtr = this->accessIndex(false) ;
+
+    const LineString::SegmentTree::Projection projection = (indexSPtr != nullptr) ? indexSPtr->project(aPoint.asVector()) : LineString::SegmentTree::Project(points_, aPoint.asVector()) ;
+
+    return { projection.point, projection.segmentIndex, projection.arcLength, projection.distance } ;
+
+}
+
+void                            LineString::buildIndex                      ( ) const
+{
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    this->accessIndex(true) ;
+
+}
+
+Cuboid                          LineString::getBoundingBox                  ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (boundingBoxSPtr_ == nullptr)
+    {
+        boundingBoxSPtr_ = std::make_shared<const Cuboid>(Cuboid::BoundingBox(points_)) ;
+    }
+
+    return *boundingBoxSPtr_ ;
+
+}
+
+Cuboid                          LineString::getOrientedBoundingBox          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (orientedBoundingBoxSPtr_ == nullptr)
+    {
+        orientedBoundingBoxSPtr_ = std::make_shared<const Cuboid>(Cuboid::OrientedBoundingBox(points_)) ;
+    }
+
+    return *orientedBoundingBoxSPtr_ ;
+
+}
+
+Sphere                          LineString::getBoundingSphere               ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Line string") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (boundingSphereSPtr_ == nullptr)
+    {
+        boundingSphereSPtr_ = std::make_shared<const Sphere>(Sphere::BoundingSphere(points_)) ;
+    }
+
+    return *boundingSphereSPtr_ ;
+
+}
+
 void                            LineString::print                           (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -185,6 +358,13 @@ void                            LineString::applyTransformation             (
         point.applyTransformation(aTransformation) ;
     }
 
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    indexSPtr_.reset() ;
+    boundingBoxSPtr_.reset() ;
+    orientedBoundingBoxSPtr_.reset() ;
+    boundingSphereSPtr_.reset() ;
+
 }
 
 LineString                      LineString::Empty                           ( )
@@ -204,6 +384,20 @@ LineString                      LineString::Segment                         (
 
 }
 
+Shared<const LineString::SegmentTree> LineString::accessIndex               (           bool                        aForce                                      ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if ((indexSPtr_ == nullptr) && (!points_.isEmpty()) && (aForce || (points_.getSize() > IndexingThreshold)))
+    {
+        indexSPtr_ = std::make_shared<const LineString::SegmentTree>(points_) ;
+    }
+
+    return indexSPtr_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -70,6 +70,11 @@ bool                            Plane::isDefined                            ( )
     return point_.isDefined() && normal_.isDefined() ;
 }
 
+Object::Type                    Plane::getType                              ( ) const
+{
+    return Object::Type::Plane ;
+}
+
 bool                            Plane::intersects                           (   const   Point&                      aPoint                                      ) const
 {
     return this->contains(aPoint) ;
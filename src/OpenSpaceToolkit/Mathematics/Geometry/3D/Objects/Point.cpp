@@ -9,6 +9,8 @@
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
@@ -117,6 +119,11 @@ bool                            Point::isDefined                            ( )
     return x_.isDefined() && y_.isDefined() && z_.isDefined() ;
 }
 
+Object::Type                    Point::getType                              ( ) const
+{
+    return Object::Type::Point ;
+}
+
 bool                            Point::isNear                               (   const   Point&                      aPoint,
                                                                                 const   Real&                       aTolerance                                  ) const
 {
@@ -207,6 +214,35 @@ String                          Point::toString                             (
 
 }
 
+Cuboid                          Point::getBoundingBox                       ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    return { *this, { Vector3d::X(), Vector3d::Y(), Vector3d::Z() }, { 0.0, 0.0, 0.0 } } ;
+
+}
+
+Cuboid                          Point::getOrientedBoundingBox               ( ) const
+{
+    return this->getBoundingBox() ;
+}
+
+Sphere                          Point::getBoundingSphere                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    return { *this, 0.0 } ;
+
+}
+
 void                            Point::print                                (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
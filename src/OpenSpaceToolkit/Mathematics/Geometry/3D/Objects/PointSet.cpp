@@ -9,10 +9,19 @@
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -26,13 +35,315 @@ namespace d3
 namespace objects
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Point sets smaller than this are searched linearly, unless an index is built explicitly
+
+constexpr std::size_t IndexingThreshold = 64 ;
+
+}
+
+/// @brief                      Static k-d tree over the point set coordinates
+///
+///                             The tree is implicit: each range of points is partitioned around its median along its widest axis,
+///                             the median being the node and both halves its subtrees. Small ranges are leaves, scanned linearly.
+
+class PointSet::KdTree
+{
+
+    public:
+
+        typedef                 std::pair<double, std::size_t>                  Neighbor ; // (squared distance, index)
+
+                                KdTree                                      (   const   PointSet::Container&        aPointContainer                             ) ;
+
+        const Vector3d&         accessPointAt                               (   const   std::size_t&                anIndex                                     ) const ;
+
+        std::size_t             findNearest                                 (   const   Vector3d&                   aPoint                                      ) const ;
+
+        std::vector<Neighbor>   findNearest                                 (   const   Vector3d&                   aPoint,
+                                                                                const   std::size_t&                aCount                                      ) const ;
+
+        std::vector<Neighbor>   findWithin                                  (   const   Vector3d&                   aPoint,
+                                                                                const   double&                     aSquaredDistance                            ) const ;
+
+    private:
+
+        static constexpr std::size_t LeafSize = 8 ;
+
+        std::vector<Vector3d>   points_ ;
+        std::vector<std::uint8_t> axes_ ;
+
+        void                    build                                       (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex                                  ) ;
+
+        template <class Visitor>
+        void                    search                                      (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex,
+                                                                                const   Vector3d&                   aPoint,
+                                                                                        Visitor&                    aVisitor                                    ) const ;
+
+} ;
+
+                                PointSet::KdTree::KdTree                    (   const   PointSet::Container&        aPointContainer                             )
+                                :   points_(),
+                                    axes_(aPointContainer.size(), 0)
+{
+
+    points_.reserve(aPointContainer.size()) ;
+
+    for (const auto& point : aPointContainer)
+    {
+        points_.push_back(point.asVector()) ;
+    }
+
+    this->build(0, points_.size()) ;
+
+}
+
+const Vector3d&                 PointSet::KdTree::accessPointAt             (   const   std::size_t&                anIndex                                     ) const
+{
+    return points_[anIndex] ;
+}
+
+std::size_t                     PointSet::KdTree::findNearest               (   const   Vector3d&                   aPoint                                      ) const
+{
+
+    struct Visitor
+    {
+
+        std::size_t index = 0 ;
+        double squaredDistance = std::numeric_limits<double>::infinity() ;
+
+        double                  bound                                       ( ) const
+        {
+            return squaredDistance ;
+        }
+
+        void                    visit                                       (   const   std::size_t&                anIndex,
+                                                                                const   double&                     aSquaredDistance                            )
+        {
+
+            if (aSquaredDistance < squaredDistance)
+            {
+                index = anIndex ;
+                squaredDistance = aSquaredDistance ;
+            }
+
+        }
+
+    } visitor ;
+
+    this->search(0, points_.size(), aPoint, visitor) ;
+
+    return visitor.index ;
+
+}
+
+std::vector<PointSet::KdTree::Neighbor> PointSet::KdTree::findNearest       (   const   Vector3d&                   aPoint,
+                                                                                const   std::size_t&                aCount                                      ) const
+{
+
+    struct Visitor
+    {
+
+        std::size_t count ;
+        std::vector<Neighbor> neighbors ; // Max-heap on squared distance
+
+        double                  bound                                       ( ) const
+        {
+            return (neighbors.size() < count) ? std::numeric_limits<double>::infinity() : neighbors.front().first ;
+        }
+
+        void                    visit                                       (   const   std::size_t&                anIndex,
+                                                                                const   double&                     aSquaredDistance                            )
+        {
+
+            if (neighbors.size() < count)
+            {
+                neighbors.emplace_back(aSquaredDistance, anIndex) ;
+                std::push_heap(neighbors.begin(), neighbors.end()) ;
+            }
+            else if (aSquaredDistance < neighbors.front().first)
+            {
+                std::pop_heap(neighbors.begin(), neighbors.end()) ;
+                neighbors.back() = { aSquaredDistance, anIndex } ;
+                std::push_heap(neighbors.begin(), neighbors.end()) ;
+            }
+
+        }
+
+    } visitor { aCount, {} } ;
+
+    visitor.neighbors.reserve(std::min(aCount, points_.size())) ;
+
+    if (aCount > 0)
+    {
+        this->search(0, points_.size(), aPoint, visitor) ;
+    }
+
+    std::sort_heap(visitor.neighbors.begin(), visitor.neighbors.end()) ;
+
+    return visitor.neighbors ;
+
+}
+
+std::vector<PointSet::KdTree::Neighbor> PointSet::KdTree::findWithin        (   const   Vector3d&                   aPoint,
+                                                                                const   double&                     aSquaredDistance                            ) const
+{
+
+    struct Visitor
+    {
+
+        double squaredDistance ;
+        std::vector<Neighbor> neighbors ;
+
+        double                  bound                                       ( ) const
+        {
+            return squaredDistance ;
+        }
+
+        void                    visit                                       (   const   std::size_t&                anIndex,
+                                                                                const   double&                     aSquaredDistance                            )
+        {
+
+            if (aSquaredDistance <= squaredDistance)
+            {
+                neighbors.emplace_back(aSquaredDistance, anIndex) ;
+            }
+
+        }
+
+    } visitor { aSquaredDistance, {} } ;
+
+    this->search(0, points_.size(), aPoint, visitor) ;
+
+    std::sort(visitor.neighbors.begin(), visitor.neighbors.end()) ;
+
+    return visitor.neighbors ;
+
+}
+
+void                            PointSet::KdTree::build                     (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex                                  )
+{
+
+    if ((anEndIndex - aBeginIndex) <= LeafSize)
+    {
+        return ;
+    }
+
+    Vector3d minimum = points_[aBeginIndex] ;
+    Vector3d maximum = points_[aBeginIndex] ;
+
+    for (std::size_t index = aBeginIndex + 1; index < anEndIndex; ++index)
+    {
+        minimum = minimum.cwiseMin(points_[index]) ;
+        maximum = maximum.cwiseMax(points_[index]) ;
+    }
+
+    Eigen::Index axis = 0 ;
+
+    (maximum - minimum).maxCoeff(&axis) ;
+
+    const std::size_t medianIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2 ;
+
+    std::nth_element(points_.begin() + aBeginIndex, points_.begin() + medianIndex, points_.begin() + anEndIndex, [axis] (const Vector3d& aFirstPoint, const Vector3d& aSecondPoint) -> bool { return aFirstPoint(axis) < aSecondPoint(axis) ; }) ;
+
+    axes_[medianIndex] = static_cast<std::uint8_t>(axis) ;
+
+    this->build(aBeginIndex, medianIndex) ;
+    this->build(medianIndex + 1, anEndIndex) ;
+
+}
+
+template <class Visitor>
+void                            PointSet::KdTree::search                    (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex,
+                                                                                const   Vector3d&                   aPoint,
+                                                                                        Visitor&                    aVisitor                                    ) const
+{
+
+    if ((anEndIndex - aBeginIndex) <= LeafSize)
+    {
+
+        for (std::size_t index = aBeginIndex; index < anEndIndex; ++index)
+        {
+            aVisitor.visit(index, (points_[index] - aPoint).squaredNorm()) ;
+        }
+
+        return ;
+
+    }
+
+    const std::size_t medianIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2 ;
+    const std::uint8_t axis = axes_[medianIndex] ;
+
+    const double offset = aPoint(axis) - points_[medianIndex](axis) ;
+
+    aVisitor.visit(medianIndex, (points_[medianIndex] - aPoint).squaredNorm()) ;
+
+    // Descend on the side of the query first, then on the other side if it may still hold closer points
+
+    if (offset < 0.0)
+    {
+
+        this->search(aBeginIndex, medianIndex, aPoint, aVisitor) ;
+
+        if ((offset * offset) <= aVisitor.bound())
+        {
+            this->search(medianIndex + 1, anEndIndex, aPoint, aVisitor) ;
+        }
+
+    }
+    else
+    {
+
+        this->search(medianIndex + 1, anEndIndex, aPoint, aVisitor) ;
+
+        if ((offset * offset) <= aVisitor.bound())
+        {
+            this->search(aBeginIndex, medianIndex, aPoint, aVisitor) ;
+        }
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 PointSet::PointSet                          (   const   Array<Point>&               aPointArray                                 )
                                 :   Object(),
-                                    points_(aPointArray.begin(), aPointArray.end())
+                                    points_(aPointArray.begin(), aPointArray.end()),
+                                    indexSPtr_(nullptr),
+                                    boundingBoxSPtr_(nullptr),
+                                    orientedBoundingBoxSPtr_(nullptr),
+                                    boundingSphereSPtr_(nullptr),
+                                    indexMutex_()
 {
 
+}
+
+                                PointSet::PointSet                          (   const   PointSet&                   aPointSet                                   )
+                                :   Object(),
+                                    points_(aPointSet.points_),
+                                    indexSPtr_(nullptr),
+                                    boundingBoxSPtr_(nullptr),
+                                    orientedBoundingBoxSPtr_(nullptr),
+                                    boundingSphereSPtr_(nullptr),
+                                    indexMutex_()
+{
+
+    const std::lock_guard<std::mutex> lock { aPointSet.indexMutex_ } ;
+
+    indexSPtr_ = aPointSet.indexSPtr_ ;
+    boundingBoxSPtr_ = aPointSet.boundingBoxSPtr_ ;
+    orientedBoundingBoxSPtr_ = aPointSet.orientedBoundingBoxSPtr_ ;
+    boundingSphereSPtr_ = aPointSet.boundingSphereSPtr_ ;
+
 }
 
 PointSet*                       PointSet::clone                             ( ) const
@@ -40,6 +351,27 @@ PointSet*                       PointSet::clone                             ( )
     return new PointSet(*this) ;
 }
 
+PointSet&                       PointSet::operator =                        (   const   PointSet&                   aPointSet                                   )
+{
+
+    if (this != &aPointSet)
+    {
+
+        points_ = aPointSet.points_ ;
+
+        const std::scoped_lock lock { indexMutex_, aPointSet.indexMutex_ } ;
+
+        indexSPtr_ = aPointSet.indexSPtr_ ;
+        boundingBoxSPtr_ = aPointSet.boundingBoxSPtr_ ;
+        orientedBoundingBoxSPtr_ = aPointSet.orientedBoundingBoxSPtr_ ;
+        boundingSphereSPtr_ = aPointSet.boundingSphereSPtr_ ;
+
+    }
+
+    return *this ;
+
+}
+
 bool                            PointSet::operator ==                       (   const   PointSet&                   aPointSet                                   ) const
 {
     return points_ == aPointSet.points_ ;
@@ -55,6 +387,11 @@ bool                            PointSet::isDefined                         ( )
     return !points_.empty() ;
 }
 
+Object::Type                    PointSet::getType                           ( ) const
+{
+    return Object::Type::PointSet ;
+}
+
 bool                            PointSet::isEmpty                           ( ) const
 {
     return points_.empty() ;
@@ -135,6 +472,11 @@ Point                           PointSet::getPointClosestTo                 (
         throw ostk::core::error::runtime::Undefined("Point set") ;
     }
 
+    if (const Shared<const PointSet::KdTree> indexSPtr = this->accessIndex(false))
+    {
+        return Point::Vector(indexSPtr->accessPointAt(indexSPtr->findNearest(aPoint.asVector()))) ;
+    }
+
     Point const* pointPtr = nullptr ;
     Real minDistance = Real::Undefined() ;
 
@@ -158,6 +500,147 @@ Point                           PointSet::getPointClosestTo                 (
 
 }
 
+Array<Point>                    PointSet::getPointsClosestTo                (   const   Point&                      aPoint,
+                                                                                const   Size&                       aPointCount                                 ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    const Shared<const PointSet::KdTree> indexSPtr = this->accessIndex(true) ;
+
+    const std::vector<PointSet::KdTree::Neighbor> neighbors = indexSPtr->findNearest(aPoint.asVector(), aPointCount) ;
+
+    Array<Point> points = Array<Point>::Empty() ;
+
+    points.reserve(neighbors.size()) ;
+
+    for (const auto& neighbor : neighbors)
+    {
+        points.add(Point::Vector(indexSPtr->accessPointAt(neighbor.second))) ;
+    }
+
+    return points ;
+
+}
+
+Array<Point>                    PointSet::getPointsWithinDistance           (   const   Point&                      aPoint,
+                                                                                const   Real&                       aDistance                                   ) const
+{
+
+    if (!aPoint.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point") ;
+    }
+
+    if (!aDistance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Distance") ;
+    }
+
+    if (aDistance < 0.0)
+    {
+        throw ostk::core::error::RuntimeError("Distance [{}] is negative.", aDistance) ;
+    }
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    const Shared<const PointSet::KdTree> indexSPtr = this->accessIndex(true) ;
+
+    const std::vector<PointSet::KdTree::Neighbor> neighbors = indexSPtr->findWithin(aPoint.asVector(), aDistance * aDistance) ;
+
+    Array<Point> points = Array<Point>::Empty() ;
+
+    points.reserve(neighbors.size()) ;
+
+    for (const auto& neighbor : neighbors)
+    {
+        points.add(Point::Vector(indexSPtr->accessPointAt(neighbor.second))) ;
+    }
+
+    return points ;
+
+}
+
+void                            PointSet::buildIndex                        ( ) const
+{
+
+    if (this->isEmpty())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    this->accessIndex(true) ;
+
+}
+
+Cuboid                          PointSet::getBoundingBox                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (boundingBoxSPtr_ == nullptr)
+    {
+        boundingBoxSPtr_ = std::make_shared<const Cuboid>(Cuboid::BoundingBox(Array<Point>(points_.begin(), points_.end()))) ;
+    }
+
+    return *boundingBoxSPtr_ ;
+
+}
+
+Cuboid                          PointSet::getOrientedBoundingBox            ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (orientedBoundingBoxSPtr_ == nullptr)
+    {
+        orientedBoundingBoxSPtr_ = std::make_shared<const Cuboid>(Cuboid::OrientedBoundingBox(Array<Point>(points_.begin(), points_.end()))) ;
+    }
+
+    return *orientedBoundingBoxSPtr_ ;
+
+}
+
+Sphere                          PointSet::getBoundingSphere                 ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Point set") ;
+    }
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if (boundingSphereSPtr_ == nullptr)
+    {
+        boundingSphereSPtr_ = std::make_shared<const Sphere>(Sphere::BoundingSphere(Array<Point>(points_.begin(), points_.end()))) ;
+    }
+
+    return *boundingSphereSPtr_ ;
+
+}
+
 void                            PointSet::print                             (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -205,6 +688,13 @@ void                            PointSet::applyTransformation               (
 
     points_ = points ;
 
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    indexSPtr_.reset() ;
+    boundingBoxSPtr_.reset() ;
+    orientedBoundingBoxSPtr_.reset() ;
+    boundingSphereSPtr_.reset() ;
+
 }
 
 PointSet                        PointSet::Empty                             ( )
@@ -212,6 +702,20 @@ PointSet                        PointSet::Empty                             ( )
     return { Array<Point>::Empty() } ;
 }
 
+Shared<const PointSet::KdTree>  PointSet::accessIndex                       (           bool                        aForce                                      ) const
+{
+
+    const std::lock_guard<std::mutex> lock { indexMutex_ } ;
+
+    if ((indexSPtr_ == nullptr) && (!points_.empty()) && (aForce || (points_.size() >= IndexingThreshold)))
+    {
+        indexSPtr_ = std::make_shared<const PointSet::KdTree>(points_) ;
+    }
+
+    return indexSPtr_ ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
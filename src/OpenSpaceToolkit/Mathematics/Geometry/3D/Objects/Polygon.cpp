@@ -9,10 +9,14 @@
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <limits>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -80,6 +84,11 @@ bool                            Polygon::isDefined                          ( )
     return polygon_.isDefined() && origin_.isDefined() && xAxis_.isDefined() && yAxis_.isDefined() ;
 }
 
+Object::Type                    Polygon::getType                            ( ) const
+{
+    return Object::Type::Polygon ;
+}
+
 bool                            Polygon::isNear                             (   const   Polygon&                    aPolygon,
                                                                                 const   Real&                       aTolerance                                  ) const
 {
@@ -287,6 +296,107 @@ Array<Polygon::Vertex>          Polygon::getVertices                        ( )
 
 }
 
+Cuboid                          Polygon::getBoundingBox                     ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    return Cuboid::BoundingBox(this->getVertices()) ;
+
+}
+
+Cuboid                          Polygon::getOrientedBoundingBox             ( ) const
+{
+
+    using ostk::math::obj::Vector2d ;
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    // The minimum-area enclosing rectangle has a side along an edge of the convex hull (rotating calipers)
+
+    const Array<Polygon2d::Vertex> hullVertices = polygon_.getConvexHull().getVertices() ;
+
+    double smallestArea = std::numeric_limits<double>::infinity() ;
+
+    Vector2d firstAxis = Vector2d::UnitX() ;
+    Vector2d minimum = Vector2d::Zero() ;
+    Vector2d maximum = Vector2d::Zero() ;
+
+    for (Index vertexIndex = 0 ; vertexIndex < hullVertices.getSize() ; ++vertexIndex)
+    {
+
+        const Vector2d edge = hullVertices[(vertexIndex + 1) % hullVertices.getSize()].asVector() - hullVertices[vertexIndex].asVector() ;
+
+        if (edge.norm() < Real::Epsilon())
+        {
+            continue ;
+        }
+
+        const Vector2d edgeAxis = edge.normalized() ;
+        const Vector2d normalAxis = { -edgeAxis.y(), edgeAxis.x() } ;
+
+        Vector2d edgeMinimum = Vector2d::Constant(+std::numeric_limits<double>::infinity()) ;
+        Vector2d edgeMaximum = Vector2d::Constant(-std::numeric_limits<double>::infinity()) ;
+
+        for (const auto& vertex : hullVertices)
+        {
+
+            const Vector2d coordinates = { edgeAxis.dot(vertex.asVector()), normalAxis.dot(vertex.asVector()) } ;
+
+            edgeMinimum = edgeMinimum.cwiseMin(coordinates) ;
+            edgeMaximum = edgeMaximum.cwiseMax(coordinates) ;
+
+        }
+
+        const double area = (edgeMaximum - edgeMinimum).prod() ;
+
+        if (area < smallestArea)
+        {
+
+            smallestArea = area ;
+
+            firstAxis = edgeAxis ;
+            minimum = edgeMinimum ;
+            maximum = edgeMaximum ;
+
+        }
+
+    }
+
+    if (smallestArea == std::numeric_limits<double>::infinity())
+    {
+        return Cuboid::OrientedBoundingBox(this->getVertices()) ;
+    }
+
+    const Vector2d secondAxis = { -firstAxis.y(), firstAxis.x() } ;
+    const Vector2d center = (firstAxis * (minimum.x() + maximum.x()) / 2.0) + (secondAxis * (minimum.y() + maximum.y()) / 2.0) ;
+    const Vector2d extent = (maximum - minimum) / 2.0 ;
+
+    const Vector3d firstAxis3d = (firstAxis.x() * xAxis_) + (firstAxis.y() * yAxis_) ;
+    const Vector3d secondAxis3d = (secondAxis.x() * xAxis_) + (secondAxis.y() * yAxis_) ;
+
+    return { origin_ + ((center.x() * xAxis_) + (center.y() * yAxis_)), { firstAxis3d, secondAxis3d, firstAxis3d.cross(secondAxis3d) }, { extent.x(), extent.y(), 0.0 } } ;
+
+}
+
+Sphere                          Polygon::getBoundingSphere                  ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Polygon") ;
+    }
+
+    return Sphere::BoundingSphere(this->getVertices()) ;
+
+}
+
 void                            Polygon::print                              (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
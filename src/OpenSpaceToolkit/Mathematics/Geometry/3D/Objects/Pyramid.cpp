@@ -13,7 +13,10 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LateralFootprint.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
@@ -75,6 +78,11 @@ bool                            Pyramid::isDefined                          ( )
     return base_.isDefined() && apex_.isDefined() ;
 }
 
+Object::Type                    Pyramid::getType                            ( ) const
+{
+    return Object::Type::Pyramid ;
+}
+
 bool                            Pyramid::intersects                         (   const   Sphere&                     aSphere,
                                                                                 const   Size                        aDiscretizationLevel                        ) const
 {
@@ -89,7 +97,12 @@ bool                            Pyramid::intersects                         (
         throw ostk::core::error::runtime::Undefined("Pyramid") ;
     }
 
-    for (const auto& ray : this->getRaysOfLateralFaces(aDiscretizationLevel)) // [TBM] Could be improved by calculating rays on the fly
+    if (this->boundingConeExcludes(aSphere.getCenter(), aSphere.getRadius()))
+    {
+        return false ;
+    }
+
+    for (const auto& ray : this->generateRaysOfLateralFaces(aDiscretizationLevel))
     {
 
         if (ray.intersects(aSphere))
@@ -117,7 +130,16 @@ bool                            Pyramid::intersects                         (
         throw ostk::core::error::runtime::Undefined("Pyramid") ;
     }
 
-    for (const auto& ray : this->getRaysOfLateralFaces(aDiscretizationLevel)) // [TBM] Could be improved by calculating rays on the fly
+    // Conservative first stage, against the circumscribed sphere of the ellipsoid
+
+    const Real maximumSemiAxis = std::max({ anEllipsoid.getFirstPrincipalSemiAxis(), anEllipsoid.getSecondPrincipalSemiAxis(), anEllipsoid.getThirdPrincipalSemiAxis() }) ;
+
+    if (this->boundingConeExcludes(anEllipsoid.getCenter(), maximumSemiAxis))
+    {
+        return false ;
+    }
+
+    for (const auto& ray : this->generateRaysOfLateralFaces(aDiscretizationLevel))
     {
 
         if (ray.intersects(anEllipsoid))
@@ -354,6 +376,23 @@ Array<Ray>                      Pyramid::getRaysOfLateralFaces              (
 
 }
 
+Pyramid::LateralRays            Pyramid::generateRaysOfLateralFaces         (   const   Size                        aRayCount                                   ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pyramid") ;
+    }
+
+    if (aRayCount < this->getLateralFaceCount())
+    {
+        throw ostk::core::error::RuntimeError("Ray count [{}] lower than lateral face count [{}].", aRayCount, this->getLateralFaceCount()) ;
+    }
+
+    return { *this, aRayCount / this->getLateralFaceCount() } ;
+
+}
+
 Intersection                    Pyramid::intersectionWith                   (   const   Sphere&                     aSphere,
                                                                                 const   bool                        onlyInSight,
                                                                                 const   Size                        aDiscretizationLevel                        ) const
@@ -380,34 +419,19 @@ Intersection                    Pyramid::intersectionWith                   (
         if (!intersection.isEmpty())
         {
 
-            if (intersection.accessComposite().is<Point>())
+            if (intersection.is<Point>())
             {
-                firstIntersectionPoints.add(intersection.accessComposite().as<Point>()) ;
+                firstIntersectionPoints.add(intersection.as<Point>()) ;
             }
-            else if (intersection.accessComposite().is<PointSet>())
+            else if (intersection.is<PointSet>())
             {
 
-                const PointSet& pointSet = intersection.accessComposite().as<PointSet>() ;
-
-                bool secondIntersectionPointAdded = false ;
-
-                for (const auto& point : pointSet)
-                {
-
-                    if (!secondIntersectionPointAdded)
-                    {
-
-                        secondIntersectionPoints.add(point) ;
-
-                        secondIntersectionPointAdded = true ;
+                // Ray-sphere intersections are stored in place, ordered from the ray origin
 
-                    }
-                    else
-                    {
-                        firstIntersectionPoints.add(point) ;
-                    }
+                const std::pair<Point, Point>& points = intersection.accessPoints() ;
 
-                }
+                firstIntersectionPoints.add(points.first) ;
+                secondIntersectionPoints.add(points.second) ;
 
             }
 
@@ -447,86 +471,109 @@ Intersection                    Pyramid::intersectionWith                   (
         throw ostk::core::error::runtime::Undefined("Pyramid") ;
     }
 
-    Array<Point> firstIntersectionPoints = Array<Point>::Empty() ;
-    Array<Point> secondIntersectionPoints = Array<Point>::Empty() ;
-
-    for (const auto& ray : this->getRaysOfLateralFaces(aDiscretizationLevel))
+    if (aDiscretizationLevel < this->getLateralFaceCount())
     {
+        throw ostk::core::error::RuntimeError("Ray count [{}] lower than lateral face count [{}].", aDiscretizationLevel, this->getLateralFaceCount()) ;
+    }
 
-        const Intersection intersection = ray.intersectionWith(anEllipsoid, onlyInSight) ;
+    // Each lateral face is sampled over the half-open range [0, 1) of its parameter,
+    // so that an edge shared by two adjacent faces is sampled once, by the face it starts
 
-        if (!intersection.isEmpty())
-        {
+    const Size lateralFaceCount = this->getLateralFaceCount() ;
+    const Size lateralDirectionCount = aDiscretizationLevel / lateralFaceCount ;
 
-            if (intersection.accessComposite().is<Point>())
-            {
-                firstIntersectionPoints.add(intersection.accessComposite().as<Point>()) ;
-            }
-            else if (intersection.accessComposite().is<PointSet>())
-            {
+    const Matrix3Xd lateralEdgeDirections = this->getDirectionsOfLateralEdges() ;
 
-                const PointSet& pointSet = intersection.accessComposite().as<PointSet>() ;
+    Matrix3Xd directions = Matrix3Xd(3, lateralFaceCount * lateralDirectionCount) ;
 
-                const Point closestPointToApex = pointSet.getPointClosestTo(apex_) ;
+    for (Index directionIndex = 0; directionIndex < (lateralFaceCount * lateralDirectionCount); ++directionIndex)
+    {
+        directions.col(directionIndex) = Pyramid::DirectionOfLateralFacesAt(lateralEdgeDirections, static_cast<double>(directionIndex) / static_cast<double>(lateralDirectionCount)) ;
+    }
 
-                firstIntersectionPoints.add(closestPointToApex) ;
+    return footprint::IntersectionWith(apex_, anEllipsoid, onlyInSight, directions) ;
 
-                for (const auto& point : pointSet)
-                {
+}
 
-                    if (point != closestPointToApex)
-                    {
+Intersection                    Pyramid::intersectionWith                   (   const   Ellipsoid&                  anEllipsoid,
+                                                                                const   bool                        onlyInSight,
+                                                                                const   Angle&                      anAngularTolerance                          ) const
+{
 
-                        secondIntersectionPoints.add(point) ;
+    if (!anEllipsoid.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ellipsoid") ;
+    }
 
-                        break ;
+    if (!anAngularTolerance.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Angular tolerance") ;
+    }
 
-                    }
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pyramid") ;
+    }
 
-                }
+    // Lateral rays are parametrized face by face, each face being refined from 4 initial intervals.
+    // Face corners lie on initial interval bounds, and are therefore never smoothed out.
 
-                // firstIntersectionPoints.add(pointSet.getPointClosestTo(apex_)) ;
+    const Matrix3Xd lateralEdgeDirections = this->getDirectionsOfLateralEdges() ;
 
-                // bool secondIntersectionPointAdded = false ;
+    const Size lateralFaceCount = this->getLateralFaceCount() ;
 
-                // for (const auto& point : pointSet)
-                // {
+    return footprint::AdaptiveIntersectionWith(apex_, anEllipsoid, onlyInSight, anAngularTolerance, static_cast<double>(lateralFaceCount), 4 * lateralFaceCount, [&lateralEdgeDirections] (const double aParameter) -> Vector3d
+    {
+        return Pyramid::DirectionOfLateralFacesAt(lateralEdgeDirections, aParameter) ;
+    }) ;
 
-                //     if (!secondIntersectionPointAdded)
-                //     {
+}
 
-                //         secondIntersectionPoints.add(point) ;
+Cuboid                          Pyramid::getBoundingBox                     ( ) const
+{
 
-                //         secondIntersectionPointAdded = true ;
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Pyramid") ;
+    }
 
-                //     }
-                //     else
-                //     {
-                //         firstIntersectionPoints.add(point) ;
-                //     }
+    Array<Point> vertices = base_.getVertices() ;
 
-                // }
+    vertices.add(apex_) ;
 
-            }
+    return Cuboid::BoundingBox(vertices) ;
 
-        }
+}
 
-    }
+Cuboid                          Pyramid::getOrientedBoundingBox             ( ) const
+{
 
-    if ((!firstIntersectionPoints.isEmpty()) && (!secondIntersectionPoints.isEmpty()) && (!onlyInSight))
-    {
-        return Intersection::LineString(LineString(firstIntersectionPoints)) + Intersection::LineString(LineString(secondIntersectionPoints)) ;
-    }
-    else if (!firstIntersectionPoints.isEmpty())
+    if (!this->isDefined())
     {
-        return Intersection::LineString(LineString(firstIntersectionPoints)) ;
+        throw ostk::core::error::runtime::Undefined("Pyramid") ;
     }
-    else if (!secondIntersectionPoints.isEmpty())
+
+    Array<Point> vertices = base_.getVertices() ;
+
+    vertices.add(apex_) ;
+
+    return Cuboid::OrientedBoundingBox(vertices) ;
+
+}
+
+Sphere                          Pyramid::getBoundingSphere                  ( ) const
+{
+
+    if (!this->isDefined())
     {
-        return Intersection::LineString(LineString(secondIntersectionPoints)) ;
+        throw ostk::core::error::runtime::Undefined("Pyramid") ;
     }
 
-    return Intersection::Empty() ;
+    Array<Point> vertices = base_.getVertices() ;
+
+    vertices.add(apex_) ;
+
+    return Sphere::BoundingSphere(vertices) ;
 
 }
 
@@ -569,6 +616,206 @@ Pyramid                         Pyramid::Undefined                          ( )
     return { Polygon::Undefined(), Point::Undefined() } ;
 }
 
+Matrix3Xd                       Pyramid::getDirectionsOfLateralEdges        ( ) const
+{
+
+    const Size lateralFaceCount = this->getLateralFaceCount() ;
+
+    Matrix3Xd directions = Matrix3Xd(3, lateralFaceCount) ;
+
+    for (Index lateralFaceIndex = 0; lateralFaceIndex < lateralFaceCount; ++lateralFaceIndex)
+    {
+        directions.col(lateralFaceIndex) = (base_.getVertexAt(lateralFaceIndex) - apex_).normalized() ;
+    }
+
+    return directions ;
+
+}
+
+bool                            Pyramid::boundingConeExcludes               (   const   Point&                      aCenter,
+                                                                                const   Real&                       aRadius                                     ) const
+{
+
+    // The lateral faces lie within the circular cone around the mean lateral edge direction, whose half-angle is that of
+    // the widest lateral edge: a ball disjoint from this (solid) cone cannot intersect any of the lateral faces
+
+    const Matrix3Xd lateralEdgeDirections = this->getDirectionsOfLateralEdges() ;
+
+    const Vector3d axis = lateralEdgeDirections.rowwise().sum().normalized() ;
+
+    const double cosine = (axis.transpose() * lateralEdgeDirections).minCoeff() ;
+
+    if (!(cosine > 0.0))
+    {
+        return false ;
+    }
+
+    const double sine = std::sqrt(1.0 - (cosine * cosine)) ;
+
+    const Vector3d apexToCenter = aCenter - apex_ ;
+
+    const double axialDistance = apexToCenter.dot(axis) ;
+    const double radialDistance = (apexToCenter - axialDistance * axis).norm() ;
+
+    if ((radialDistance * cosine) <= (axialDistance * sine))
+    {
+        return false ;
+    }
+
+    const double distance = (((axialDistance * cosine) + (radialDistance * sine)) <= 0.0) ? apexToCenter.norm() : ((radialDistance * cosine) - (axialDistance * sine)) ;
+
+    return distance > aRadius ;
+
+}
+
+Vector3d                        Pyramid::DirectionOfLateralFacesAt          (   const   Matrix3Xd&                  aLateralEdgeDirectionArray,
+                                                                                const   double                      aParameter                                  )
+{
+
+    // The integer part of the parameter is the lateral face index, and its fractional part spans the face
+    // from its first edge (0) to its second edge (1), along the conic section cut by the face plane
+
+    const Index lateralFaceCount = aLateralEdgeDirectionArray.cols() ;
+    const Index lateralFaceIndex = std::min(static_cast<Index>(std::max(std::floor(aParameter), 0.0)), lateralFaceCount - 1) ;
+
+    const Vector3d firstDirection = aLateralEdgeDirectionArray.col(lateralFaceIndex) ;
+    const Vector3d secondDirection = aLateralEdgeDirectionArray.col((lateralFaceIndex + 1) % lateralFaceCount) ;
+
+    const Vector3d orthogonalDirection = secondDirection - firstDirection.dot(secondDirection) * firstDirection ;
+
+    const double orthogonalNorm = orthogonalDirection.norm() ;
+
+    if (orthogonalNorm == 0.0)
+    {
+        return firstDirection ;
+    }
+
+    const double angle_rad = (aParameter - static_cast<double>(lateralFaceIndex)) * std::atan2(orthogonalNorm, firstDirection.dot(secondDirection)) ;
+
+    return (std::cos(angle_rad) * firstDirection) + ((std::sin(angle_rad) / orthogonalNorm) * orthogonalDirection) ;
+
+}
+
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                Pyramid::LateralRays::LateralRays           (   const   Pyramid&                    aPyramid,
+                                                                                const   Size                        aLateralRayCount                            )
+                                :   apex_(aPyramid.apex_),
+                                    lateralFaces_(Array<LateralFace>::Empty()),
+                                    lateralRayCount_(aLateralRayCount)
+{
+
+    lateralFaces_.reserve(aPyramid.getLateralFaceCount()) ;
+
+    for (Index lateralFaceIndex = 0; lateralFaceIndex < aPyramid.getLateralFaceCount(); ++lateralFaceIndex)
+    {
+
+        const Segment baseEdge = aPyramid.base_.getEdgeAt(lateralFaceIndex) ;
+
+        const Vector3d firstDirection = (baseEdge.getFirstPoint() - apex_).normalized() ;
+        const Vector3d secondDirection = (baseEdge.getSecondPoint() - apex_).normalized() ;
+        const Vector3d orthogonalDirection = secondDirection - firstDirection.dot(secondDirection) * firstDirection ;
+
+        const double orthogonalNorm = orthogonalDirection.norm() ;
+
+        const double stepAngle_rad = std::atan2(orthogonalNorm, firstDirection.dot(secondDirection)) / static_cast<double>(lateralRayCount_) ;
+
+        lateralFaces_.add
+        (
+            {
+                firstDirection,
+                (orthogonalNorm > 0.0) ? Vector3d(orthogonalDirection / orthogonalNorm) : Vector3d(Vector3d::Zero()),
+                std::cos(stepAngle_rad),
+                std::sin(stepAngle_rad)
+            }
+        ) ;
+
+    }
+
+}
+
+Size                            Pyramid::LateralRays::getSize               ( ) const
+{
+    return lateralFaces_.getSize() * lateralRayCount_ ;
+}
+
+Pyramid::LateralRays::ConstIterator Pyramid::LateralRays::begin             ( ) const
+{
+    return { this, 0 } ;
+}
+
+Pyramid::LateralRays::ConstIterator Pyramid::LateralRays::end               ( ) const
+{
+    return { this, lateralFaces_.getSize() } ;
+}
+
+                                Pyramid::LateralRays::ConstIterator::ConstIterator (   const   LateralRays*                aLateralRaysPtr,
+                                                                                const   Index                       aLateralFaceIndex                           )
+                                :   lateralRaysPtr_(aLateralRaysPtr),
+                                    lateralFaceIndex_(aLateralFaceIndex),
+                                    rayIndex_(0),
+                                    cosine_(1.0),
+                                    sine_(0.0)
+{
+
+    if (lateralRaysPtr_->lateralRayCount_ == 0)
+    {
+        lateralFaceIndex_ = lateralRaysPtr_->lateralFaces_.getSize() ;
+    }
+
+}
+
+bool                            Pyramid::LateralRays::ConstIterator::operator == (   const   ConstIterator&              anIterator                                  ) const
+{
+    return (lateralRaysPtr_ == anIterator.lateralRaysPtr_) && (lateralFaceIndex_ == anIterator.lateralFaceIndex_) && (rayIndex_ == anIterator.rayIndex_) ;
+}
+
+bool                            Pyramid::LateralRays::ConstIterator::operator != (   const   ConstIterator&              anIterator                                  ) const
+{
+    return !((*this) == anIterator) ;
+}
+
+Ray                             Pyramid::LateralRays::ConstIterator::operator * ( ) const
+{
+
+    const LateralFace& lateralFace = lateralRaysPtr_->lateralFaces_[lateralFaceIndex_] ;
+
+    return { lateralRaysPtr_->apex_, (cosine_ * lateralFace.firstDirection) + (sine_ * lateralFace.inPlaneDirection) } ;
+
+}
+
+Pyramid::LateralRays::ConstIterator& Pyramid::LateralRays::ConstIterator::operator ++ ( )
+{
+
+    if (++rayIndex_ < lateralRaysPtr_->lateralRayCount_)
+    {
+
+        // Rotation of (cos(theta), sin(theta)) by the angular step of the face
+
+        const LateralFace& lateralFace = lateralRaysPtr_->lateralFaces_[lateralFaceIndex_] ;
+
+        const double cosine = (cosine_ * lateralFace.stepCosine) - (sine_ * lateralFace.stepSine) ;
+        const double sine = (sine_ * lateralFace.stepCosine) + (cosine_ * lateralFace.stepSine) ;
+
+        cosine_ = cosine ;
+        sine_ = sine ;
+
+    }
+    else
+    {
+
+        rayIndex_ = 0 ;
+        cosine_ = 1.0 ;
+        sine_ = 0.0 ;
+
+        ++lateralFaceIndex_ ;
+
+    }
+
+    return *this ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -80,6 +80,11 @@ bool                            Ray::isDefined                              ( )
     return origin_.isDefined() && direction_.isDefined() ;
 }
 
+Object::Type                    Ray::getType                                ( ) const
+{
+    return Object::Type::Ray ;
+}
+
 bool                            Ray::intersects                             (   const   Point&                      aPoint                                      ) const
 {
     return this->contains(aPoint) ;
@@ -11,6 +11,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 
@@ -69,6 +70,11 @@ bool                            Segment::isDefined                          ( )
     return firstPoint_.isDefined() && secondPoint_.isDefined() ;
 }
 
+Object::Type                    Segment::getType                            ( ) const
+{
+    return Object::Type::Segment ;
+}
+
 bool                            Segment::isDegenerate                       ( ) const
 {
 
@@ -281,6 +287,54 @@ Intersection                    Segment::intersectionWith                   (
 
 }
 
+Cuboid                          Segment::getBoundingBox                     ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment") ;
+    }
+
+    return Cuboid::BoundingBox({ firstPoint_, secondPoint_ }) ;
+
+}
+
+Cuboid                          Segment::getOrientedBoundingBox             ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment") ;
+    }
+
+    const Vector3d direction = secondPoint_ - firstPoint_ ;
+    const Real length = direction.norm() ;
+
+    if (length < Real::Epsilon())
+    {
+        return this->getBoundingBox() ;
+    }
+
+    const Vector3d firstAxis = direction / length ;
+    const Vector3d secondAxis = firstAxis.unitOrthogonal() ;
+    const Vector3d thirdAxis = firstAxis.cross(secondAxis) ;
+
+    return { this->getCenter(), { firstAxis, secondAxis, thirdAxis }, { length / 2.0, 0.0, 0.0 } } ;
+
+}
+
+Sphere                          Segment::getBoundingSphere                  ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment") ;
+    }
+
+    return { this->getCenter(), this->getLength() / 2.0 } ;
+
+}
+
 void                            Segment::print                              (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
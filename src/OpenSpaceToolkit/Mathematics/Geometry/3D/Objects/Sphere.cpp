@@ -13,6 +13,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
@@ -104,6 +105,11 @@ bool                            Sphere::isDefined                           ( )
     return center_.isDefined() && radius_.isDefined() ;
 }
 
+Object::Type                    Sphere::getType                             ( ) const
+{
+    return Object::Type::Sphere ;
+}
+
 bool                            Sphere::isUnitary                           ( ) const
 {
 
@@ -336,8 +342,6 @@ Real                            Sphere::getRadius                           ( )
 Intersection                    Sphere::intersectionWith                    (   const   Line&                       aLine                                       ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aLine.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Line") ;
@@ -373,7 +377,7 @@ Intersection                    Sphere::intersectionWith                    (
         }
         else if (intersectionResult.numIntersections == 2)
         {
-            return Intersection::PointSet(PointSet({ Point(SpherePointFromGteVector(intersectionResult.point[0])), Point(SpherePointFromGteVector(intersectionResult.point[1])) })) ;
+            return Intersection::PointSet(SpherePointFromGteVector(intersectionResult.point[0]), SpherePointFromGteVector(intersectionResult.point[1])) ;
         }
         else
         {
@@ -390,8 +394,6 @@ Intersection                    Sphere::intersectionWith                    (
                                                                                 const   bool                        onlyInSight                                 ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aRay.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Ray") ;
@@ -440,8 +442,6 @@ Intersection                    Sphere::intersectionWith                    (
             const Point firstPoint = SpherePointFromGteVector(intersectionResult.point[0]) ;
             const Point secondPoint = SpherePointFromGteVector(intersectionResult.point[1]) ;
 
-            const PointSet pointSet = { { firstPoint, secondPoint } } ;
-
             if ((firstPoint == aRay.getOrigin()) || (secondPoint == aRay.getOrigin()))
             {
 
@@ -457,7 +457,12 @@ Intersection                    Sphere::intersectionWith                    (
 
             }
 
-            return onlyInSight ? Intersection::Point(pointSet.getPointClosestTo(aRay.getOrigin())) : Intersection::PointSet(pointSet) ;
+            if (onlyInSight)
+            {
+                return Intersection::Point((firstPoint.distanceTo(aRay.getOrigin()) <= secondPoint.distanceTo(aRay.getOrigin())) ? firstPoint : secondPoint) ;
+            }
+
+            return Intersection::PointSet(firstPoint, secondPoint) ;
 
         }
         else
@@ -474,8 +479,6 @@ Intersection                    Sphere::intersectionWith                    (
 Intersection                    Sphere::intersectionWith                    (   const   Segment&                    aSegment                                    ) const
 {
 
-    using ostk::math::geom::d3::objects::PointSet ;
-
     if (!aSegment.isDefined())
     {
         throw ostk::core::error::runtime::Undefined("Segment") ;
@@ -577,7 +580,7 @@ Intersection                    Sphere::intersectionWith                    (
 
             }
 
-            return Intersection::PointSet(PointSet({ firstPoint, secondPoint })) ;
+            return Intersection::PointSet(firstPoint, secondPoint) ;
 
         }
         else
@@ -603,6 +606,35 @@ Intersection                    Sphere::intersectionWith                    (
     return aCone.intersectionWith(*this, onlyInSight) ;
 }
 
+Cuboid                          Sphere::getBoundingBox                      ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sphere") ;
+    }
+
+    return Cuboid::Cube(center_, radius_) ;
+
+}
+
+Cuboid                          Sphere::getOrientedBoundingBox              ( ) const
+{
+    return this->getBoundingBox() ;
+}
+
+Sphere                          Sphere::getBoundingSphere                   ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Sphere") ;
+    }
+
+    return *this ;
+
+}
+
 void                            Sphere::print                               (           std::ostream&               anOutputStream,
                                                                                         bool                        displayDecorators                           ) const
 {
@@ -648,6 +680,92 @@ Sphere                          Sphere::Unit                                (
     return { aCenter, 1.0 } ;
 }
 
+Sphere                          Sphere::BoundingSphere                      (   const   Array<Point>&               aPointArray                                 )
+{
+
+    using ostk::core::types::Index ;
+
+    if (aPointArray.isEmpty())
+    {
+        throw ostk::core::error::RuntimeError("Cannot bound empty point array.") ;
+    }
+
+    std::array<Vector3d, 3> minima = { aPointArray.accessFirst().asVector(), aPointArray.accessFirst().asVector(), aPointArray.accessFirst().asVector() } ;
+    std::array<Vector3d, 3> maxima = minima ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        if (!point.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Point") ;
+        }
+
+        const Vector3d coordinates = point.asVector() ;
+
+        for (Index axisIndex = 0 ; axisIndex < 3 ; ++axisIndex)
+        {
+
+            if (coordinates(axisIndex) < minima[axisIndex](axisIndex))
+            {
+                minima[axisIndex] = coordinates ;
+            }
+
+            if (coordinates(axisIndex) > maxima[axisIndex](axisIndex))
+            {
+                maxima[axisIndex] = coordinates ;
+            }
+
+        }
+
+    }
+
+    Index seedAxisIndex = 0 ;
+
+    for (Index axisIndex = 1 ; axisIndex < 3 ; ++axisIndex)
+    {
+
+        if ((maxima[axisIndex] - minima[axisIndex]).squaredNorm() > (maxima[seedAxisIndex] - minima[seedAxisIndex]).squaredNorm())
+        {
+            seedAxisIndex = axisIndex ;
+        }
+
+    }
+
+    Vector3d center = (minima[seedAxisIndex] + maxima[seedAxisIndex]) / 2.0 ;
+    double radius = (maxima[seedAxisIndex] - minima[seedAxisIndex]).norm() / 2.0 ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        const Vector3d offset = point.asVector() - center ;
+        const double distance = offset.norm() ;
+
+        if (distance > radius)
+        {
+
+            const double grownRadius = (radius + distance) / 2.0 ;
+
+            center += ((grownRadius - radius) / distance) * offset ;
+            radius = grownRadius ;
+
+        }
+
+    }
+
+    // Growth steps accumulate round-off: the final radius is measured rather than trusted
+
+    double squaredRadius = 0.0 ;
+
+    for (const auto& point : aPointArray)
+    {
+        squaredRadius = std::max(squaredRadius, (point.asVector() - center).squaredNorm()) ;
+    }
+
+    return { Point::Vector(center), std::sqrt(squaredRadius) } ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -0,0 +1,1340 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <future>
+#include <limits>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::math::obj::Vector3d ;
+using ostk::math::geom::d3::objects::Polygon ;
+using ostk::math::geom::d3::objects::Cuboid ;
+using ostk::math::geom::d3::objects::Sphere ;
+using ostk::math::geom::d3::objects::Ellipsoid ;
+using ostk::math::geom::d3::objects::Pyramid ;
+using ostk::math::geom::d3::objects::Composite ;
+
+// Scenes with fewer objects than this are built on a single thread
+
+constexpr std::size_t ParallelThreshold = 4096 ;
+
+constexpr double Infinity = std::numeric_limits<double>::infinity() ;
+
+struct Box
+{
+
+    Vector3d                    minimum ;
+    Vector3d                    maximum ;
+
+} ;
+
+Box                             EmptyBox                                    ( )
+{
+    return { Vector3d::Constant(Infinity), Vector3d::Constant(-Infinity) } ;
+}
+
+void                            Extend                                      (           Box&                        aBox,
+                                                                                const   Vector3d&                   aPoint                                      )
+{
+    aBox.minimum = aBox.minimum.cwiseMin(aPoint) ;
+    aBox.maximum = aBox.maximum.cwiseMax(aPoint) ;
+}
+
+void                            Extend                                      (           Box&                        aBox,
+                                                                                const   Box&                        anotherBox                                  )
+{
+    aBox.minimum = aBox.minimum.cwiseMin(anotherBox.minimum) ;
+    aBox.maximum = aBox.maximum.cwiseMax(anotherBox.maximum) ;
+}
+
+bool                            IsEmpty                                     (   const   Box&                        aBox                                        )
+{
+    return (aBox.minimum.array() > aBox.maximum.array()).any() ;
+}
+
+double                          CenterOf                                    (   const   Box&                        aBox,
+                                                                                const   Eigen::Index&               anAxisIndex                                 )
+{
+    return IsEmpty(aBox) ? -Infinity : (aBox.minimum[anAxisIndex] + aBox.maximum[anAxisIndex]) ;
+}
+
+bool                            Overlaps                                    (   const   Box&                        aBox,
+                                                                                const   Box&                        anotherBox                                  )
+{
+    return (aBox.minimum.array() <= anotherBox.maximum.array()).all() && (anotherBox.minimum.array() <= aBox.maximum.array()).all() ;
+}
+
+/// @brief                      Distance along a ray at which it enters a box, within [0, aMaximumDistance]
+///
+///                             Returns infinity if the ray misses the box. Zero direction components yield infinite inverses,
+///                             and the NaN arising when the origin also lies on a face of the box is discarded by fmin / fmax.
+
+double                          EntryDistanceOf                             (   const   Box&                        aBox,
+                                                                                const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   anInverseDirection,
+                                                                                const   double&                     aMaximumDistance                            )
+{
+
+    double nearDistance = 0.0 ;
+    double farDistance = aMaximumDistance ;
+
+    for (Eigen::Index axisIndex = 0; axisIndex < 3; ++axisIndex)
+    {
+
+        double firstDistance = (aBox.minimum[axisIndex] - anOrigin[axisIndex]) * anInverseDirection[axisIndex] ;
+        double secondDistance = (aBox.maximum[axisIndex] - anOrigin[axisIndex]) * anInverseDirection[axisIndex] ;
+
+        if (firstDistance > secondDistance)
+        {
+            std::swap(firstDistance, secondDistance) ;
+        }
+
+        nearDistance = std::fmax(nearDistance, firstDistance) ;
+        farDistance = std::fmin(farDistance, secondDistance) ;
+
+    }
+
+    return (nearDistance <= farDistance) ? nearDistance : Infinity ;
+
+}
+
+Box                             BoxOf                                       (   const   Object&                     anObject                                    )
+{
+
+    // Composites are bounded member by member, so that an empty one bounds nothing instead of throwing
+
+    if (anObject.getType() == Object::Type::Composite)
+    {
+
+        Box box = EmptyBox() ;
+
+        for (const auto& objectUPtr : static_cast<const Composite&>(anObject).accessObjects())
+        {
+            Extend(box, BoxOf(*objectUPtr)) ;
+        }
+
+        return box ;
+
+    }
+
+    const Cuboid boundingBox = anObject.getBoundingBox() ;
+
+    const Vector3d center = boundingBox.getCenter().asVector() ;
+    const Vector3d extent = { boundingBox.getFirstExtent(), boundingBox.getSecondExtent(), boundingBox.getThirdExtent() } ;
+
+    return { center - extent, center + extent } ;
+
+}
+
+/// @brief                      Distance along a ray at which it enters the unit sphere, within [0, aMaximumDistance]
+///
+///                             Origin and direction are expressed in the frame where the quadric is the unit sphere: the distance
+///                             parameter is unchanged by this affine mapping.
+
+double                          HitDistanceOfUnitSphere                     (   const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   aDirection,
+                                                                                const   double&                     aMaximumDistance                            )
+{
+
+    const double c = anOrigin.squaredNorm() - 1.0 ;
+
+    if (c <= 0.0)
+    {
+        return 0.0 ;
+    }
+
+    const double b = anOrigin.dot(aDirection) ;
+
+    if (b >= 0.0)
+    {
+        return Infinity ;
+    }
+
+    const double a = aDirection.squaredNorm() ;
+    const double discriminant = (b * b) - (a * c) ;
+
+    if (discriminant < 0.0)
+    {
+        return Infinity ;
+    }
+
+    const double distance = (-b - std::sqrt(discriminant)) / a ;
+
+    return (distance <= aMaximumDistance) ? distance : Infinity ;
+
+}
+
+double                          HitDistanceOfPolygon                        (   const   Polygon&                    aPolygon,
+                                                                                const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   aDirection,
+                                                                                const   double&                     aMaximumDistance                            )
+{
+
+    using Point2d = ostk::math::geom::d2::objects::Point ;
+
+    const Vector3d polygonOrigin = aPolygon.getOrigin().asVector() ;
+    const Vector3d normal = aPolygon.getNormalVector() ;
+
+    const double denominator = normal.dot(aDirection) ;
+
+    if (denominator == 0.0)
+    {
+        return Infinity ;
+    }
+
+    const double distance = normal.dot(polygonOrigin - anOrigin) / denominator ;
+
+    if ((distance < 0.0) || (distance > aMaximumDistance))
+    {
+        return Infinity ;
+    }
+
+    const Vector3d offset = (anOrigin + distance * aDirection) - polygonOrigin ;
+
+    return aPolygon.getPolygon2d().contains(Point2d(offset.dot(aPolygon.getXAxis()), offset.dot(aPolygon.getYAxis()))) ? distance : Infinity ;
+
+}
+
+/// @brief                      Distance along a ray (unit direction) at which it first touches an object, within [0, aMaximumDistance]
+///
+///                             Returns infinity if the object is not hit.
+
+double                          HitDistanceOf                               (   const   Object&                     anObject,
+                                                                                const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   aDirection,
+                                                                                const   double&                     aMaximumDistance                            )
+{
+
+    switch (anObject.getType())
+    {
+
+        case Object::Type::Sphere:
+        {
+
+            const Sphere& sphere = static_cast<const Sphere&>(anObject) ;
+
+            const double radius = sphere.getRadius() ;
+
+            return HitDistanceOfUnitSphere((anOrigin - sphere.getCenter().asVector()) / radius, aDirection / radius, aMaximumDistance) ;
+
+        }
+
+        case Object::Type::Ellipsoid:
+        {
+
+            const Ellipsoid& ellipsoid = static_cast<const Ellipsoid&>(anObject) ;
+
+            const Vector3d offset = anOrigin - ellipsoid.getCenter().asVector() ;
+
+            const Vector3d firstAxis = ellipsoid.getFirstAxis() ;
+            const Vector3d secondAxis = ellipsoid.getSecondAxis() ;
+            const Vector3d thirdAxis = ellipsoid.getThirdAxis() ;
+
+            const Vector3d semiAxes = { ellipsoid.getFirstPrincipalSemiAxis(), ellipsoid.getSecondPrincipalSemiAxis(), ellipsoid.getThirdPrincipalSemiAxis() } ;
+
+            const Vector3d localOrigin = Vector3d(firstAxis.dot(offset), secondAxis.dot(offset), thirdAxis.dot(offset)).cwiseQuotient(semiAxes) ;
+            const Vector3d localDirection = Vector3d(firstAxis.dot(aDirection), secondAxis.dot(aDirection), thirdAxis.dot(aDirection)).cwiseQuotient(semiAxes) ;
+
+            return HitDistanceOfUnitSphere(localOrigin, localDirection, aMaximumDistance) ;
+
+        }
+
+        case Object::Type::Cuboid:
+        {
+
+            const Cuboid& cuboid = static_cast<const Cuboid&>(anObject) ;
+
+            const Vector3d offset = anOrigin - cuboid.getCenter().asVector() ;
+
+            const std::array<Vector3d, 3> axes = { cuboid.getFirstAxis(), cuboid.getSecondAxis(), cuboid.getThirdAxis() } ;
+            const std::array<double, 3> extents = { cuboid.getFirstExtent(), cuboid.getSecondExtent(), cuboid.getThirdExtent() } ;
+
+            double nearDistance = 0.0 ;
+            double farDistance = aMaximumDistance ;
+
+            for (std::size_t axisIndex = 0; axisIndex < 3; ++axisIndex)
+            {
+
+                const double localOrigin = axes[axisIndex].dot(offset) ;
+                const double localDirection = axes[axisIndex].dot(aDirection) ;
+
+                if (localDirection == 0.0)
+                {
+
+                    if (std::abs(localOrigin) > extents[axisIndex])
+                    {
+                        return Infinity ;
+                    }
+
+                    continue ;
+
+                }
+
+                double firstDistance = (-extents[axisIndex] - localOrigin) / localDirection ;
+                double secondDistance = (extents[axisIndex] - localOrigin) / localDirection ;
+
+                if (firstDistance > secondDistance)
+                {
+                    std::swap(firstDistance, secondDistance) ;
+                }
+
+                nearDistance = std::max(nearDistance, firstDistance) ;
+                farDistance = std::min(farDistance, secondDistance) ;
+
+                if (nearDistance > farDistance)
+                {
+                    return Infinity ;
+                }
+
+            }
+
+            return nearDistance ;
+
+        }
+
+        case Object::Type::Polygon:
+            return HitDistanceOfPolygon(static_cast<const Polygon&>(anObject), anOrigin, aDirection, aMaximumDistance) ;
+
+        case Object::Type::Pyramid:
+        {
+
+            const Pyramid& pyramid = static_cast<const Pyramid&>(anObject) ;
+
+            const Polygon base = pyramid.getBase() ;
+
+            // Pyramid::contains considers the infinite pyramid: only points on the apex side of the base belong to the solid
+
+            const Vector3d baseOrigin = base.getOrigin().asVector() ;
+            const Vector3d baseNormal = base.getNormalVector() ;
+
+            const bool isOnApexSide = (baseNormal.dot(anOrigin - baseOrigin) * baseNormal.dot(pyramid.getApex().asVector() - baseOrigin)) >= 0.0 ;
+
+            if (isOnApexSide && pyramid.contains(Point::Vector(anOrigin)))
+            {
+                return 0.0 ;
+            }
+
+            double distance = HitDistanceOfPolygon(base, anOrigin, aDirection, aMaximumDistance) ;
+
+            for (Index faceIndex = 0; faceIndex < pyramid.getLateralFaceCount(); ++faceIndex)
+            {
+                distance = std::min(distance, HitDistanceOfPolygon(pyramid.getLateralFaceAt(faceIndex), anOrigin, aDirection, std::min(distance, aMaximumDistance))) ;
+            }
+
+            return distance ;
+
+        }
+
+        case Object::Type::Composite:
+        {
+
+            double distance = Infinity ;
+
+            for (const auto& objectUPtr : static_cast<const Composite&>(anObject).accessObjects())
+            {
+                distance = std::min(distance, HitDistanceOf(*objectUPtr, anOrigin, aDirection, std::min(distance, aMaximumDistance))) ;
+            }
+
+            return distance ;
+
+        }
+
+        default:
+            break ;
+
+    }
+
+    throw ostk::core::error::RuntimeError("Cannot cast ray onto object.") ;
+
+}
+
+/// @brief                      Run a function over [0, aCount), split across hardware threads for large counts
+
+template <class Function>
+void                            ParallelFor                                 (   const   std::size_t&                aCount,
+                                                                                const   Function&                   aFunction                                   )
+{
+
+    const std::size_t threadCount = (aCount >= ParallelThreshold) ? std::max<std::size_t>(std::thread::hardware_concurrency(), 1) : 1 ;
+
+    const std::size_t chunkSize = (aCount + threadCount - 1) / std::max<std::size_t>(threadCount, 1) ;
+
+    const auto run = [&aFunction, aCount, chunkSize] (const std::size_t aChunkIndex) -> void
+    {
+
+        for (std::size_t index = aChunkIndex * chunkSize; index < std::min(aCount, (aChunkIndex + 1) * chunkSize); ++index)
+        {
+            aFunction(index) ;
+        }
+
+    } ;
+
+    std::vector<std::future<void>> futures ;
+
+    for (std::size_t chunkIndex = 1; chunkIndex < threadCount; ++chunkIndex)
+    {
+        futures.push_back(std::async(std::launch::async, run, chunkIndex)) ;
+    }
+
+    run(0) ;
+
+    for (auto& future : futures)
+    {
+        future.get() ;
+    }
+
+}
+
+}
+
+/// @brief                      Bounding volume hierarchy over the objects of a scene
+///
+///                             Objects are recursively halved along the widest axis of their box centers. Since the split is on counts,
+///                             the size of every subtree is known in advance: nodes are stored in depth-first order in a preallocated array,
+///                             the left child of a node immediately following it, and large subtrees are built concurrently.
+///
+///                             A hierarchy is immutable once built, so that queries may walk it concurrently. Refitting builds a copy, in which the boxes
+///                             of the objects that moved are recomputed, then those of their ancestors (or of all nodes, when many moved).
+
+class Scene::Hierarchy
+{
+
+    public:
+
+        struct Candidate
+        {
+
+            Index               objectIndex = 0 ;
+            double              distance = Infinity ;
+
+        } ;
+
+                                Hierarchy                                   (   const   Array<Unique<Object>>&      anObjectArray                               ) ;
+
+                                Hierarchy                                   (   const   Hierarchy&                  aHierarchy,
+                                                                                const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   std::vector<Index>&         aModifiedIndexArray,
+                                                                                const   bool                        allModified                                 ) ;
+
+        Candidate               castRay                                     (   const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   aDirection,
+                                                                                const   double&                     aMaximumDistance,
+                                                                                const   bool                        stopAtFirstHit                              ) const ;
+
+        Array<Index>            getObjectIndicesOverlapping                 (   const   Box&                        aBox                                        ) const ;
+
+    private:
+
+        struct Node
+        {
+
+            Box                 box ;
+            std::size_t         beginIndex ;
+            std::size_t         endIndex ;
+            std::size_t         rightIndex ;
+            std::size_t         parentIndex ;
+
+        } ;
+
+        static constexpr std::size_t LeafSize = 8 ;
+        static constexpr std::size_t MaximumDepth = 64 ;
+
+        std::vector<Box>        boxes_ ;
+        std::vector<std::size_t> objectIndices_ ;
+        std::vector<Node>       nodes_ ;
+        std::vector<std::size_t> leafIndices_ ;
+
+        void                    refit                                       (   const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   std::vector<Index>&         aModifiedIndexArray,
+                                                                                const   bool                        allModified                                 ) ;
+
+        void                    build                                       (   const   std::size_t&                aNodeIndex,
+                                                                                const   std::size_t&                aParentIndex,
+                                                                                const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex,
+                                                                                const   std::size_t&                aParallelDepth                              ) ;
+
+        void                    fitLeaf                                     (           Node&                       aNode                                       ) ;
+
+        void                    fitNode                                     (   const   std::size_t&                aNodeIndex                                  ) ;
+
+        static bool             IsLeaf                                      (   const   Node&                       aNode                                       ) ;
+
+        static std::size_t      NodeCountOf                                 (   const   std::size_t&                anObjectCount                               ) ;
+
+} ;
+
+                                Scene::Hierarchy::Hierarchy                 (   const   Array<Unique<Object>>&      anObjectArray                               )
+                                :   boxes_(anObjectArray.getSize()),
+                                    objectIndices_(anObjectArray.getSize()),
+                                    nodes_(Scene::Hierarchy::NodeCountOf(anObjectArray.getSize())),
+                                    leafIndices_(anObjectArray.getSize())
+{
+
+    ParallelFor(anObjectArray.getSize(), [this, &anObjectArray] (const std::size_t anIndex) -> void { boxes_[anIndex] = BoxOf(*anObjectArray[anIndex]) ; }) ;
+
+    std::iota(objectIndices_.begin(), objectIndices_.end(), 0) ;
+
+    if (!nodes_.empty())
+    {
+
+        std::size_t parallelDepth = 0 ;
+
+        while ((std::size_t(1) << parallelDepth) < std::thread::hardware_concurrency())
+        {
+            ++parallelDepth ;
+        }
+
+        this->build(0, 0, 0, objectIndices_.size(), parallelDepth) ;
+
+    }
+
+}
+
+                                Scene::Hierarchy::Hierarchy                 (   const   Hierarchy&                  aHierarchy,
+                                                                                const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   std::vector<Index>&         aModifiedIndexArray,
+                                                                                const   bool                        allModified                                 )
+                                :   boxes_(aHierarchy.boxes_),
+                                    objectIndices_(aHierarchy.objectIndices_),
+                                    nodes_(aHierarchy.nodes_),
+                                    leafIndices_(aHierarchy.leafIndices_)
+{
+
+    this->refit(anObjectArray, aModifiedIndexArray, allModified) ;
+
+}
+
+Scene::Hierarchy::Candidate     Scene::Hierarchy::castRay                   (   const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   Vector3d&                   anOrigin,
+                                                                                const   Vector3d&                   aDirection,
+                                                                                const   double&                     aMaximumDistance,
+                                                                                const   bool                        stopAtFirstHit                              ) const
+{
+
+    Candidate candidate ;
+
+    if (nodes_.empty())
+    {
+        return candidate ;
+    }
+
+    const Vector3d inverseDirection = aDirection.cwiseInverse() ;
+
+    double maximumDistance = aMaximumDistance ;
+
+    std::array<std::size_t, 2 * MaximumDepth> nodeIndexStack ;
+    std::size_t stackSize = 0 ;
+
+    nodeIndexStack[stackSize++] = 0 ;
+
+    while (stackSize > 0)
+    {
+
+        const std::size_t nodeIndex = nodeIndexStack[--stackSize] ;
+
+        const Node& node = nodes_[nodeIndex] ;
+
+        if (EntryDistanceOf(node.box, anOrigin, inverseDirection, maximumDistance) == Infinity)
+        {
+            continue ;
+        }
+
+        if (Scene::Hierarchy::IsLeaf(node))
+        {
+
+            for (std::size_t index = node.beginIndex; index < node.endIndex; ++index)
+            {
+
+                const std::size_t objectIndex = objectIndices_[index] ;
+
+                const double distance = HitDistanceOf(*anObjectArray[objectIndex], anOrigin, aDirection, maximumDistance) ;
+
+                if (distance < candidate.distance)
+                {
+
+                    candidate = { objectIndex, distance } ;
+
+                    maximumDistance = distance ;
+
+                    if (stopAtFirstHit)
+                    {
+                        return candidate ;
+                    }
+
+                }
+
+            }
+
+            continue ;
+
+        }
+
+        // Push the farther child first, so that the nearer one is searched first and shrinks the search distance
+
+        std::size_t nearIndex = nodeIndex + 1 ;
+        std::size_t farIndex = node.rightIndex ;
+
+        double nearDistance = EntryDistanceOf(nodes_[nearIndex].box, anOrigin, inverseDirection, maximumDistance) ;
+        double farDistance = EntryDistanceOf(nodes_[farIndex].box, anOrigin, inverseDirection, maximumDistance) ;
+
+        if (farDistance < nearDistance)
+        {
+            std::swap(nearIndex, farIndex) ;
+            std::swap(nearDistance, farDistance) ;
+        }
+
+        if (farDistance != Infinity)
+        {
+            nodeIndexStack[stackSize++] = farIndex ;
+        }
+
+        if (nearDistance != Infinity)
+        {
+            nodeIndexStack[stackSize++] = nearIndex ;
+        }
+
+    }
+
+    return candidate ;
+
+}
+
+Array<Index>                    Scene::Hierarchy::getObjectIndicesOverlapping (   const   Box&                        aBox                                        ) const
+{
+
+    Array<Index> objectIndices = Array<Index>::Empty() ;
+
+    if (nodes_.empty())
+    {
+        return objectIndices ;
+    }
+
+    std::array<std::size_t, 2 * MaximumDepth> nodeIndexStack ;
+    std::size_t stackSize = 0 ;
+
+    nodeIndexStack[stackSize++] = 0 ;
+
+    while (stackSize > 0)
+    {
+
+        const std::size_t nodeIndex = nodeIndexStack[--stackSize] ;
+
+        const Node& node = nodes_[nodeIndex] ;
+
+        if (!Overlaps(node.box, aBox))
+        {
+            continue ;
+        }
+
+        if (Scene::Hierarchy::IsLeaf(node))
+        {
+
+            for (std::size_t index = node.beginIndex; index < node.endIndex; ++index)
+            {
+
+                if (Overlaps(boxes_[objectIndices_[index]], aBox))
+                {
+                    objectIndices.add(objectIndices_[index]) ;
+                }
+
+            }
+
+            continue ;
+
+        }
+
+        nodeIndexStack[stackSize++] = node.rightIndex ;
+        nodeIndexStack[stackSize++] = nodeIndex + 1 ;
+
+    }
+
+    std::sort(objectIndices.begin(), objectIndices.end()) ;
+
+    return objectIndices ;
+
+}
+
+void                            Scene::Hierarchy::refit                     (   const   Array<Unique<Object>>&      anObjectArray,
+                                                                                const   std::vector<Index>&         aModifiedIndexArray,
+                                                                                const   bool                        allModified                                 )
+{
+
+    if (allModified)
+    {
+        ParallelFor(anObjectArray.getSize(), [this, &anObjectArray] (const std::size_t anIndex) -> void { boxes_[anIndex] = BoxOf(*anObjectArray[anIndex]) ; }) ;
+    }
+    else
+    {
+
+        for (const auto& index : aModifiedIndexArray)
+        {
+            boxes_[index] = BoxOf(*anObjectArray[index]) ;
+        }
+
+    }
+
+    // A few moved objects only require refitting their ancestors. Otherwise, as children follow their parent,
+    // a reverse sweep over all nodes refits them first.
+
+    std::size_t depth = 0 ;
+
+    while ((LeafSize << depth) < objectIndices_.size())
+    {
+        ++depth ;
+    }
+
+    if ((!allModified) && ((aModifiedIndexArray.size() * (depth + 1)) < nodes_.size()))
+    {
+
+        for (const auto& index : aModifiedIndexArray)
+        {
+
+            std::size_t nodeIndex = leafIndices_[index] ;
+
+            this->fitLeaf(nodes_[nodeIndex]) ;
+
+            while (nodeIndex > 0)
+            {
+
+                nodeIndex = nodes_[nodeIndex].parentIndex ;
+
+                this->fitNode(nodeIndex) ;
+
+            }
+
+        }
+
+    }
+    else
+    {
+
+        for (std::size_t nodeIndex = nodes_.size(); nodeIndex-- > 0; )
+        {
+
+            if (Scene::Hierarchy::IsLeaf(nodes_[nodeIndex]))
+            {
+                this->fitLeaf(nodes_[nodeIndex]) ;
+            }
+            else
+            {
+                this->fitNode(nodeIndex) ;
+            }
+
+        }
+
+    }
+
+}
+
+void                            Scene::Hierarchy::build                     (   const   std::size_t&                aNodeIndex,
+                                                                                const   std::size_t&                aParentIndex,
+                                                                                const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex,
+                                                                                const   std::size_t&                aParallelDepth                              )
+{
+
+    Node& node = nodes_[aNodeIndex] ;
+
+    node.beginIndex = aBeginIndex ;
+    node.endIndex = anEndIndex ;
+    node.rightIndex = 0 ;
+    node.parentIndex = aParentIndex ;
+
+    if (Scene::Hierarchy::IsLeaf(node))
+    {
+
+        for (std::size_t index = aBeginIndex; index < anEndIndex; ++index)
+        {
+            leafIndices_[objectIndices_[index]] = aNodeIndex ;
+        }
+
+        this->fitLeaf(node) ;
+
+        return ;
+
+    }
+
+    // Split at the median of box centers along their widest axis (centers are compared through minimum + maximum).
+    // Empty boxes (of empty composites) have no center: they are left out of the axis choice, and sorted first.
+
+    Box centerBox = EmptyBox() ;
+
+    for (std::size_t index = aBeginIndex; index < anEndIndex; ++index)
+    {
+
+        const Box& box = boxes_[objectIndices_[index]] ;
+
+        if (!IsEmpty(box))
+        {
+            Extend(centerBox, Vector3d(box.minimum + box.maximum)) ;
+        }
+
+    }
+
+    Eigen::Index axisIndex = 0 ;
+
+    (centerBox.maximum - centerBox.minimum).maxCoeff(&axisIndex) ;
+
+    const std::size_t middleIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2 ;
+
+    std::nth_element
+    (
+        objectIndices_.begin() + aBeginIndex,
+        objectIndices_.begin() + middleIndex,
+        objectIndices_.begin() + anEndIndex,
+        [this, axisIndex] (const std::size_t anIndex, const std::size_t anotherIndex) -> bool
+        {
+            return CenterOf(boxes_[anIndex], axisIndex) < CenterOf(boxes_[anotherIndex], axisIndex) ;
+        }
+    ) ;
+
+    const std::size_t leftIndex = aNodeIndex + 1 ;
+    const std::size_t rightIndex = leftIndex + Scene::Hierarchy::NodeCountOf(middleIndex - aBeginIndex) ;
+
+    node.rightIndex = rightIndex ;
+
+    if ((aParallelDepth > 0) && ((anEndIndex - aBeginIndex) >= ParallelThreshold))
+    {
+
+        std::future<void> leftFuture = std::async(std::launch::async, [this, leftIndex, aNodeIndex, aBeginIndex, middleIndex, aParallelDepth] () -> void { this->build(leftIndex, aNodeIndex, aBeginIndex, middleIndex, aParallelDepth - 1) ; }) ;
+
+        this->build(rightIndex, aNodeIndex, middleIndex, anEndIndex, aParallelDepth - 1) ;
+
+        leftFuture.get() ;
+
+    }
+    else
+    {
+
+        this->build(leftIndex, aNodeIndex, aBeginIndex, middleIndex, 0) ;
+        this->build(rightIndex, aNodeIndex, middleIndex, anEndIndex, 0) ;
+
+    }
+
+    this->fitNode(aNodeIndex) ;
+
+}
+
+void                            Scene::Hierarchy::fitLeaf                   (           Node&                       aNode                                       )
+{
+
+    aNode.box = EmptyBox() ;
+
+    for (std::size_t index = aNode.beginIndex; index < aNode.endIndex; ++index)
+    {
+        Extend(aNode.box, boxes_[objectIndices_[index]]) ;
+    }
+
+}
+
+void                            Scene::Hierarchy::fitNode                   (   const   std::size_t&                aNodeIndex                                  )
+{
+
+    Node& node = nodes_[aNodeIndex] ;
+
+    node.box = nodes_[aNodeIndex + 1].box ;
+
+    Extend(node.box, nodes_[node.rightIndex].box) ;
+
+}
+
+bool                            Scene::Hierarchy::IsLeaf                    (   const   Node&                       aNode                                       )
+{
+    return (aNode.endIndex - aNode.beginIndex) <= LeafSize ;
+}
+
+std::size_t                     Scene::Hierarchy::NodeCountOf               (   const   std::size_t&                anObjectCount                               )
+{
+
+    if (anObjectCount == 0)
+    {
+        return 0 ;
+    }
+
+    if (anObjectCount <= LeafSize)
+    {
+        return 1 ;
+    }
+
+    return 1 + Scene::Hierarchy::NodeCountOf(anObjectCount / 2) + Scene::Hierarchy::NodeCountOf(anObjectCount - (anObjectCount / 2)) ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+bool                            Scene::Hit::isDefined                       ( ) const
+{
+    return distance.isDefined() ;
+}
+
+                                Scene::Scene                                (   const   Array<Unique<Object>>&      anObjectArray                               )
+                                :   objects_(Array<Unique<Object>>::Empty()),
+                                    hierarchySPtr_(nullptr),
+                                    modifiedIndices_(),
+                                    allModified_(false),
+                                    hierarchyMutex_()
+{
+
+    objects_.reserve(anObjectArray.getSize()) ;
+
+    for (const auto& objectUPtr : anObjectArray)
+    {
+
+        if (objectUPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Object") ;
+        }
+
+        this->addObject(*objectUPtr) ;
+
+    }
+
+}
+
+                                Scene::Scene                                (           Array<Unique<Object>>&&     anObjectArray                               )
+                                :   objects_(std::move(anObjectArray)),
+                                    hierarchySPtr_(nullptr),
+                                    modifiedIndices_(),
+                                    allModified_(false),
+                                    hierarchyMutex_()
+{
+
+    for (const auto& objectUPtr : objects_)
+    {
+
+        if (objectUPtr == nullptr)
+        {
+            throw ostk::core::error::runtime::Undefined("Object") ;
+        }
+
+        Scene::Validate(*objectUPtr) ;
+
+    }
+
+}
+
+                                Scene::Scene                                (   const   Scene&                      aScene                                      )
+                                :   objects_(Array<Unique<Object>>::Empty()),
+                                    hierarchySPtr_(nullptr),
+                                    modifiedIndices_(),
+                                    allModified_(false),
+                                    hierarchyMutex_()
+{
+
+    objects_.reserve(aScene.objects_.getSize()) ;
+
+    for (const auto& objectUPtr : aScene.objects_)
+    {
+        objects_.add(Unique<Object>(objectUPtr->clone())) ;
+    }
+
+    // Hierarchies are immutable, and only refer to objects by index: copies share them
+
+    const std::lock_guard<std::mutex> lock { aScene.hierarchyMutex_ } ;
+
+    hierarchySPtr_ = aScene.hierarchySPtr_ ;
+    modifiedIndices_ = aScene.modifiedIndices_ ;
+    allModified_ = aScene.allModified_ ;
+
+}
+
+                                Scene::Scene                                (           Scene&&                     aScene                                      )
+                                :   objects_(std::move(aScene.objects_)),
+                                    hierarchySPtr_(nullptr),
+                                    modifiedIndices_(),
+                                    allModified_(false),
+                                    hierarchyMutex_()
+{
+
+    const std::lock_guard<std::mutex> lock { aScene.hierarchyMutex_ } ;
+
+    hierarchySPtr_ = std::move(aScene.hierarchySPtr_) ;
+    modifiedIndices_ = std::move(aScene.modifiedIndices_) ;
+    allModified_ = aScene.allModified_ ;
+
+}
+
+                                Scene::~Scene                               ( )
+{
+
+}
+
+Scene&                          Scene::operator =                           (   const   Scene&                      aScene                                      )
+{
+
+    if (this != &aScene)
+    {
+
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+        objects.reserve(aScene.objects_.getSize()) ;
+
+        for (const auto& objectUPtr : aScene.objects_)
+        {
+            objects.add(Unique<Object>(objectUPtr->clone())) ;
+        }
+
+        const std::scoped_lock lock { hierarchyMutex_, aScene.hierarchyMutex_ } ;
+
+        objects_ = std::move(objects) ;
+        hierarchySPtr_ = aScene.hierarchySPtr_ ;
+        modifiedIndices_ = aScene.modifiedIndices_ ;
+        allModified_ = aScene.allModified_ ;
+
+    }
+
+    return *this ;
+
+}
+
+Scene&                          Scene::operator =                           (           Scene&&                     aScene                                      )
+{
+
+    if (this != &aScene)
+    {
+
+        const std::scoped_lock lock { hierarchyMutex_, aScene.hierarchyMutex_ } ;
+
+        objects_ = std::move(aScene.objects_) ;
+        hierarchySPtr_ = std::move(aScene.hierarchySPtr_) ;
+        modifiedIndices_ = std::move(aScene.modifiedIndices_) ;
+        allModified_ = aScene.allModified_ ;
+
+    }
+
+    return *this ;
+
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   Scene&                      aScene                                      )
+{
+
+    aScene.print(anOutputStream, true) ;
+
+    return anOutputStream ;
+
+}
+
+bool                            Scene::isEmpty                              ( ) const
+{
+    return objects_.isEmpty() ;
+}
+
+bool                            Scene::intersects                           (   const   Ray&                        aRay                                        ) const
+{
+
+    if (!aRay.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ray") ;
+    }
+
+    return this->accessHierarchy()->castRay(objects_, aRay.getOrigin().asVector(), aRay.getDirection(), Infinity, true).distance != Infinity ;
+
+}
+
+bool                            Scene::intersects                           (   const   Segment&                    aSegment                                    ) const
+{
+
+    if (!aSegment.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Segment") ;
+    }
+
+    const Vector3d firstPoint = aSegment.getFirstPoint().asVector() ;
+    const Vector3d offset = aSegment.getSecondPoint().asVector() - firstPoint ;
+
+    const double length = offset.norm() ;
+
+    // A degenerate segment is a point: any direction does, over a zero distance
+
+    const Vector3d direction = (length > 0.0) ? Vector3d(offset / length) : Vector3d::UnitX() ;
+
+    return this->accessHierarchy()->castRay(objects_, firstPoint, direction, length, true).distance != Infinity ;
+
+}
+
+const Object&                   Scene::accessObjectAt                       (   const   Index&                      anIndex                                     ) const
+{
+
+    if (anIndex >= objects_.getSize())
+    {
+        throw ostk::core::error::RuntimeError("Object index [{}] out of bounds [{}].", anIndex, objects_.getSize()) ;
+    }
+
+    return *(objects_.at(anIndex).get()) ;
+
+}
+
+Size                            Scene::getObjectCount                       ( ) const
+{
+    return objects_.getSize() ;
+}
+
+Scene::Hit                      Scene::getFirstHitOf                        (   const   Ray&                        aRay                                        ) const
+{
+
+    if (!aRay.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ray") ;
+    }
+
+    const Vector3d origin = aRay.getOrigin().asVector() ;
+    const Vector3d direction = aRay.getDirection() ;
+
+    const Scene::Hierarchy::Candidate candidate = this->accessHierarchy()->castRay(objects_, origin, direction, Infinity, false) ;
+
+    if (candidate.distance == Infinity)
+    {
+        return { 0, Point::Undefined(), Real::Undefined() } ;
+    }
+
+    return { candidate.objectIndex, Point::Vector(origin + candidate.distance * direction), candidate.distance } ;
+
+}
+
+Array<Index>                    Scene::getObjectIndicesOverlapping          (   const   Object&                     anObject                                    ) const
+{
+
+    if (!anObject.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Object") ;
+    }
+
+    return this->accessHierarchy()->getObjectIndicesOverlapping(BoxOf(anObject)) ;
+
+}
+
+Index                           Scene::addObject                            (   const   Object&                     anObject                                    )
+{
+
+    Scene::Validate(anObject) ;
+
+    objects_.add(Unique<Object>(anObject.clone())) ;
+
+    hierarchySPtr_.reset() ;
+    modifiedIndices_.clear() ;
+    allModified_ = false ;
+
+    return objects_.getSize() - 1 ;
+
+}
+
+Index                           Scene::addObject                            (           Unique<Object>&&            anObjectUPtr                                )
+{
+
+    if (anObjectUPtr == nullptr)
+    {
+        throw ostk::core::error::runtime::Undefined("Object") ;
+    }
+
+    Scene::Validate(*anObjectUPtr) ;
+
+    objects_.add(std::move(anObjectUPtr)) ;
+
+    hierarchySPtr_.reset() ;
+    modifiedIndices_.clear() ;
+    allModified_ = false ;
+
+    return objects_.getSize() - 1 ;
+
+}
+
+void                            Scene::build                                ( ) const
+{
+
+    // Queries running concurrently keep walking the previous hierarchy, which is released with its last reader
+
+    Shared<const Scene::Hierarchy> hierarchySPtr = std::make_shared<const Scene::Hierarchy>(objects_) ;
+
+    const std::lock_guard<std::mutex> lock { hierarchyMutex_ } ;
+
+    hierarchySPtr_ = std::move(hierarchySPtr) ;
+    modifiedIndices_.clear() ;
+    allModified_ = false ;
+
+}
+
+void                            Scene::print                                (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           ) const
+{
+
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Scene") : void () ;
+
+    if (!objects_.isEmpty())
+    {
+
+        ostk::core::utils::Print::Separator(anOutputStream, "Objects") ;
+
+        for (const auto& objectUPtr : objects_)
+        {
+            anOutputStream << (*objectUPtr) ;
+        }
+
+    }
+    else
+    {
+        ostk::core::utils::Print::Line(anOutputStream) << "Empty" ;
+    }
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+void                            Scene::applyTransformation                  (   const   Index&                      anIndex,
+                                                                                const   Transformation&             aTransformation                             )
+{
+
+    if (anIndex >= objects_.getSize())
+    {
+        throw ostk::core::error::RuntimeError("Object index [{}] out of bounds [{}].", anIndex, objects_.getSize()) ;
+    }
+
+    objects_[anIndex]->applyTransformation(aTransformation) ;
+
+    if ((hierarchySPtr_ != nullptr) && (!allModified_))
+    {
+        modifiedIndices_.push_back(anIndex) ;
+    }
+
+}
+
+void                            Scene::applyTransformation                  (   const   Transformation&             aTransformation                             )
+{
+
+    for (auto& objectUPtr : objects_)
+    {
+        objectUPtr->applyTransformation(aTransformation) ;
+    }
+
+    if (hierarchySPtr_ != nullptr)
+    {
+
+        allModified_ = true ;
+
+        modifiedIndices_.clear() ;
+
+    }
+
+}
+
+Scene                           Scene::Empty                                ( )
+{
+    return Scene { Array<Unique<Object>>::Empty() } ;
+}
+
+Shared<const Scene::Hierarchy>  Scene::accessHierarchy                      ( ) const
+{
+
+    const std::lock_guard<std::mutex> lock { hierarchyMutex_ } ;
+
+    if (hierarchySPtr_ == nullptr)
+    {
+        hierarchySPtr_ = std::make_shared<const Scene::Hierarchy>(objects_) ;
+    }
+    else if (allModified_ || (!modifiedIndices_.empty()))
+    {
+
+        // Other queries may still walk the current hierarchy: the refitted one is built aside, then swapped in
+
+        hierarchySPtr_ = std::make_shared<const Scene::Hierarchy>(*hierarchySPtr_, objects_, modifiedIndices_, allModified_) ;
+
+        modifiedIndices_.clear() ;
+        allModified_ = false ;
+
+    }
+
+    return hierarchySPtr_ ;
+
+}
+
+void                            Scene::Validate                             (   const   Object&                     anObject                                    )
+{
+
+    if (!anObject.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Object") ;
+    }
+
+    switch (anObject.getType())
+    {
+
+        case Object::Type::Sphere:
+        case Object::Type::Ellipsoid:
+        case Object::Type::Cuboid:
+        case Object::Type::Pyramid:
+        case Object::Type::Polygon:
+            return ;
+
+        case Object::Type::Composite:
+        {
+
+            for (const auto& objectUPtr : static_cast<const Composite&>(anObject).accessObjects())
+            {
+                Scene::Validate(*objectUPtr) ;
+            }
+
+            return ;
+
+        }
+
+        default:
+            break ;
+
+    }
+
+    throw ostk::core::error::RuntimeError("Scene only supports spheres, ellipsoids, cuboids, pyramids, polygons, and composites of these.") ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,427 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+/// @brief                      Great arc between two unit quaternions, in the XYZS format
+///
+///                             Points along the arc are cos(ratio * angle) * start + sin(ratio * angle) * direction,
+///                             where direction is the unit quaternion orthogonal to start in the plane of the arc.
+///                             Arcs with a zero angle are straight lines, normalized on evaluation (NLERP).
+
+struct Arc
+{
+
+    Vector4d                    start ;
+    Vector4d                    direction ;
+    double                      angle ;
+
+} ;
+
+Arc                             LineBetween                                 (   const   Vector4d&                   aStart,
+                                                                                const   Vector4d&                   anEnd                                       )
+{
+    return { aStart, ((aStart.dot(anEnd) < 0.0) ? Vector4d(-anEnd) : anEnd) - aStart, 0.0 } ;
+}
+
+Arc                             ArcBetween                                  (   const   Vector4d&                   aStart,
+                                                                                const   Vector4d&                   anEnd                                       )
+{
+
+    // Shortest path: q and -q represent the same rotation
+
+    const double cosine = aStart.dot(anEnd) ;
+
+    const Vector4d end = (cosine < 0.0) ? Vector4d(-anEnd) : anEnd ;
+
+    const double angle = std::acos(std::min(std::abs(cosine), 1.0)) ;
+
+    // Nearly identical quaternions: fall back to a line, as sin(angle) vanishes
+
+    if (angle <= 1e-6)
+    {
+        return { aStart, end - aStart, 0.0 } ;
+    }
+
+    return { aStart, (end - std::abs(cosine) * aStart) / std::sin(angle), angle } ;
+
+}
+
+Vector4d                        PointOn                                     (   const   Arc&                        anArc,
+                                                                                const   double                      aRatio                                      )
+{
+
+    if (anArc.angle == 0.0)
+    {
+        return (anArc.start + aRatio * anArc.direction).normalized() ;
+    }
+
+    const double angle = aRatio * anArc.angle ;
+
+    return std::cos(angle) * anArc.start + std::sin(angle) * anArc.direction ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Precomputed terms of the interpolation between two successive samples
+
+class AttitudeInterpolator::Segment
+{
+
+    public:
+
+                                Segment                                     (   const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   Arc&                        anArc,
+                                                                                const   Arc&                        aControlArc                                 ) ;
+
+        double                  startTime ;
+        double                  inverseDuration ;
+
+        Arc                     arc ;
+        Arc                     controlArc ;
+
+} ;
+
+                                AttitudeInterpolator::Segment::Segment      (   const   double                      aStartTime,
+                                                                                const   double                      anEndTime,
+                                                                                const   Arc&                        anArc,
+                                                                                const   Arc&                        aControlArc                                 )
+                                :   startTime(aStartTime),
+                                    inverseDuration(1.0 / (anEndTime - aStartTime)),
+                                    arc(anArc),
+                                    controlArc(aControlArc)
+{
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                AttitudeInterpolator::AttitudeInterpolator  (   const   VectorXd&                   aTimeArray,
+                                                                                const   Array<Quaternion>&          aQuaternionArray,
+                                                                                const   AttitudeInterpolator::Type& aType                                       )
+                                :   type_(aType),
+                                    times_(aTimeArray),
+                                    segments_()
+{
+
+    if (type_ == AttitudeInterpolator::Type::Undefined)
+    {
+        throw ostk::core::error::runtime::Undefined("Type") ;
+    }
+
+    if (!times_.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Times") ;
+    }
+
+    if (static_cast<Size>(times_.size()) != aQuaternionArray.getSize())
+    {
+        throw ostk::core::error::RuntimeError("Time array size [{}] differs from quaternion array size [{}].", times_.size(), aQuaternionArray.getSize()) ;
+    }
+
+    if (times_.size() < 2)
+    {
+        throw ostk::core::error::RuntimeError("Sample count [{}] is lower than 2.", times_.size()) ;
+    }
+
+    for (Eigen::Index index = 1; index < times_.size(); ++index)
+    {
+
+        if (times_(index) <= times_(index - 1))
+        {
+            throw ostk::core::error::RuntimeError("Times are not strictly increasing.") ;
+        }
+
+    }
+
+    // Samples on a continuous hemisphere, so that each segment follows the shortest path
+
+    const Size sampleCount = aQuaternionArray.getSize() ;
+
+    std::vector<Vector4d> samples ;
+
+    samples.reserve(sampleCount) ;
+
+    for (const auto& quaternion : aQuaternionArray)
+    {
+
+        if (!quaternion.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Quaternion") ;
+        }
+
+        if (!quaternion.isUnitary())
+        {
+            throw ostk::core::error::RuntimeError("Quaternion is not unitary.") ;
+        }
+
+        const Vector4d sample = quaternion.toVector(Quaternion::Format::XYZS) ;
+
+        samples.push_back(((!samples.empty()) && (samples.back().dot(sample) < 0.0)) ? Vector4d(-sample) : sample) ;
+
+    }
+
+    std::vector<Vector4d> controlPoints ;
+
+    if (type_ == AttitudeInterpolator::Type::SQUAD)
+    {
+
+        controlPoints.reserve(sampleCount) ;
+
+        controlPoints.push_back(samples.front()) ;
+
+        for (Index index = 1; (index + 1) < sampleCount; ++index)
+        {
+
+            const Vector4d controlPoint = Quaternion::SQUADControlPoint
+            (
+                Quaternion(samples[index - 1], Quaternion::Format::XYZS),
+                Quaternion(samples[index], Quaternion::Format::XYZS),
+                Quaternion(samples[index + 1], Quaternion::Format::XYZS)
+            ).toVector(Quaternion::Format::XYZS) ;
+
+            controlPoints.push_back((samples[index].dot(controlPoint) < 0.0) ? Vector4d(-controlPoint) : controlPoint) ;
+
+        }
+
+        controlPoints.push_back(samples.back()) ;
+
+    }
+
+    segments_.reserve(sampleCount - 1) ;
+
+    for (Index index = 0; (index + 1) < sampleCount; ++index)
+    {
+
+        const Arc arc = (type_ == AttitudeInterpolator::Type::NLERP)
+                      ? LineBetween(samples[index], samples[index + 1])
+                      : ArcBetween(samples[index], samples[index + 1]) ;
+
+        const Arc controlArc = (type_ == AttitudeInterpolator::Type::SQUAD)
+                             ? ArcBetween(controlPoints[index], controlPoints[index + 1])
+                             : arc ;
+
+        segments_.emplace_back(times_(index), times_(index + 1), arc, controlArc) ;
+
+    }
+
+}
+
+                                AttitudeInterpolator::AttitudeInterpolator  (   const   AttitudeInterpolator&       anAttitudeInterpolator                      ) = default ;
+
+                                AttitudeInterpolator::~AttitudeInterpolator ( ) = default ;
+
+AttitudeInterpolator&           AttitudeInterpolator::operator =            (   const   AttitudeInterpolator&       anAttitudeInterpolator                      ) = default ;
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   AttitudeInterpolator&       anAttitudeInterpolator                      )
+{
+
+    anAttitudeInterpolator.print(anOutputStream, true) ;
+
+    return anOutputStream ;
+
+}
+
+Size                            AttitudeInterpolator::getSampleCount        ( ) const
+{
+    return times_.size() ;
+}
+
+AttitudeInterpolator::Type      AttitudeInterpolator::getType               ( ) const
+{
+    return type_ ;
+}
+
+Real                            AttitudeInterpolator::getFirstTime          ( ) const
+{
+    return times_(0) ;
+}
+
+Real                            AttitudeInterpolator::getLastTime           ( ) const
+{
+    return times_(times_.size() - 1) ;
+}
+
+Quaternion                      AttitudeInterpolator::evaluate              (   const   Real&                       aTime                                       ) const
+{
+
+    if (!aTime.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Time") ;
+    }
+
+    const double time = aTime ;
+
+    return this->evaluateSegmentAt(this->getSegmentIndexAt(time, 0), time) ;
+
+}
+
+Array<Quaternion>               AttitudeInterpolator::evaluate              (   const   VectorXd&                   aTimeArray                                  ) const
+{
+
+    if (!aTimeArray.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Times") ;
+    }
+
+    Array<Quaternion> quaternions = Array<Quaternion>::Empty() ;
+
+    quaternions.reserve(aTimeArray.size()) ;
+
+    Index segmentIndex = 0 ;
+
+    for (Eigen::Index index = 0; index < aTimeArray.size(); ++index)
+    {
+
+        segmentIndex = this->getSegmentIndexAt(aTimeArray(index), segmentIndex) ;
+
+        quaternions.add(this->evaluateSegmentAt(segmentIndex, aTimeArray(index))) ;
+
+    }
+
+    return quaternions ;
+
+}
+
+void                            AttitudeInterpolator::print                 (           std::ostream&               anOutputStream,
+                                                                                        bool                        displayDecorators                           ) const
+{
+
+    displayDecorators ? ostk::core::utils::Print::Header(anOutputStream, "Attitude Interpolator") : void () ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Type:"                << AttitudeInterpolator::StringFromType(type_) ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Sample count:"        << this->getSampleCount() ;
+    ostk::core::utils::Print::Line(anOutputStream) << "First time:"          << this->getFirstTime().toString() ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Last time:"           << this->getLastTime().toString() ;
+
+    displayDecorators ? ostk::core::utils::Print::Footer(anOutputStream) : void () ;
+
+}
+
+String                          AttitudeInterpolator::StringFromType        (   const   AttitudeInterpolator::Type& aType                                       )
+{
+
+    switch (aType)
+    {
+
+        case AttitudeInterpolator::Type::Undefined:
+            return "Undefined" ;
+
+        case AttitudeInterpolator::Type::NLERP:
+            return "NLERP" ;
+
+        case AttitudeInterpolator::Type::SLERP:
+            return "SLERP" ;
+
+        case AttitudeInterpolator::Type::SQUAD:
+            return "SQUAD" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Type") ;
+            break ;
+
+    }
+
+    return String::Empty() ;
+
+}
+
+Index                           AttitudeInterpolator::getSegmentIndexAt     (   const   double                      aTime,
+                                                                                const   Index&                      aSegmentIndexGuess                          ) const
+{
+
+    const Index lastIndex = times_.size() - 1 ;
+
+    if ((aTime < times_(0)) || (aTime > times_(lastIndex)))
+    {
+        throw ostk::core::error::RuntimeError("Time [{}] is outside of sample times [{}, {}].", aTime, times_(0), times_(lastIndex)) ;
+    }
+
+    // Sorted times mostly stay in the same segment, or move to the next one.
+    // Segments are [start, end), but for the last one, so that a time maps to the same segment whatever the guess.
+
+    for (Index segmentIndex = aSegmentIndexGuess; (segmentIndex < lastIndex) && (segmentIndex <= (aSegmentIndexGuess + 1)); ++segmentIndex)
+    {
+
+        if ((times_(segmentIndex) <= aTime) && ((aTime < times_(segmentIndex + 1)) || ((segmentIndex + 1) == lastIndex)))
+        {
+            return segmentIndex ;
+        }
+
+    }
+
+    const double* timeIterator = std::upper_bound(times_.data(), times_.data() + times_.size(), aTime) ;
+
+    return std::min<Index>(std::max<std::ptrdiff_t>(timeIterator - times_.data() - 1, 0), lastIndex - 1) ;
+
+}
+
+Quaternion                      AttitudeInterpolator::evaluateSegmentAt     (   const   Index&                      aSegmentIndex,
+                                                                                const   double                      aTime                                       ) const
+{
+
+    const AttitudeInterpolator::Segment& segment = segments_[aSegmentIndex] ;
+
+    const double ratio = std::min(std::max((aTime - segment.startTime) * segment.inverseDuration, 0.0), 1.0) ;
+
+    if (type_ != AttitudeInterpolator::Type::SQUAD)
+    {
+        return { PointOn(segment.arc, ratio).normalized(), Quaternion::Format::XYZS } ;
+    }
+
+    // SLERP between the sample and control arcs, the only arc not known in advance
+
+    const Vector4d point = PointOn(segment.arc, ratio) ;
+    const Vector4d controlPoint = PointOn(segment.controlArc, ratio) ;
+
+    return { PointOn(ArcBetween(point, controlPoint), 2.0 * ratio * (1.0 - ratio)).normalized(), Quaternion::Format::XYZS } ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,259 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.tpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.hpp>
+
+#include <OpenSpaceToolkit/Core/Error.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                template <Axis anAxis>
+                                ElementaryRotation<anAxis>::ElementaryRotation (   const   Angle&                   aRotationAngle                              )
+                                :   cosine_(0.0),
+                                    sine_(0.0)
+{
+
+    if (!aRotationAngle.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rotation angle") ;
+    }
+
+    const double rotationAngle_rad = aRotationAngle.inRadians() ;
+
+    cosine_ = std::cos(rotationAngle_rad) ;
+    sine_ = std::sin(rotationAngle_rad) ;
+
+}
+
+                                template <Axis anAxis>
+ElementaryRotation<anAxis>      ElementaryRotation<anAxis>::operator *      (   const   ElementaryRotation&         anElementaryRotation                        ) const
+{
+    return { (cosine_ * anElementaryRotation.cosine_) - (sine_ * anElementaryRotation.sine_), (sine_ * anElementaryRotation.cosine_) + (cosine_ * anElementaryRotation.sine_) } ;
+}
+
+                                template <Axis anAxis>
+                                template <Axis anotherAxis>
+RotationMatrix                  ElementaryRotation<anAxis>::operator *      (   const   ElementaryRotation<anotherAxis>& anElementaryRotation                   ) const
+{
+
+    RotationMatrix rotationMatrix = anElementaryRotation.toRotationMatrix() ;
+
+    this->applyOnTheLeft(rotationMatrix) ;
+
+    return rotationMatrix ;
+
+}
+
+                                template <Axis anAxis>
+RotationMatrix                  ElementaryRotation<anAxis>::operator *      (   const   RotationMatrix&             aRotationMatrix                             ) const
+{
+
+    if (!aRotationMatrix.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rotation matrix") ;
+    }
+
+    RotationMatrix rotationMatrix = aRotationMatrix ;
+
+    this->applyOnTheLeft(rotationMatrix) ;
+
+    return rotationMatrix ;
+
+}
+
+                                template <Axis anAxis>
+Quaternion                      ElementaryRotation<anAxis>::operator *      (   const   Quaternion&                 aQuaternion                                 ) const
+{
+    return this->toQuaternion() * aQuaternion ;
+}
+
+                                template <Axis anAxis>
+Vector3d                        ElementaryRotation<anAxis>::operator *      (   const   Vector3d&                   aVector                                     ) const
+{
+
+    if (!aVector.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Vector") ;
+    }
+
+    Vector3d vector = aVector ;
+
+    vector(FirstIndex) = (cosine_ * aVector(FirstIndex)) + (sine_ * aVector(SecondIndex)) ;
+    vector(SecondIndex) = (cosine_ * aVector(SecondIndex)) - (sine_ * aVector(FirstIndex)) ;
+
+    return vector ;
+
+}
+
+                                template <Axis anAxis>
+RotationMatrix                  operator *                                  (   const   RotationMatrix&             aRotationMatrix,
+                                                                                const   ElementaryRotation<anAxis>& anElementaryRotation                        )
+{
+
+    if (!aRotationMatrix.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rotation matrix") ;
+    }
+
+    RotationMatrix rotationMatrix = aRotationMatrix ;
+
+    anElementaryRotation.applyOnTheRight(rotationMatrix) ;
+
+    return rotationMatrix ;
+
+}
+
+                                template <Axis anAxis>
+Quaternion                      operator *                                  (   const   Quaternion&                 aQuaternion,
+                                                                                const   ElementaryRotation<anAxis>& anElementaryRotation                        )
+{
+    return aQuaternion * anElementaryRotation.toQuaternion() ;
+}
+
+                                template <Axis anAxis>
+Angle                           ElementaryRotation<anAxis>::getAngle        ( ) const
+{
+    return Angle::Radians(std::atan2(sine_, cosine_)) ;
+}
+
+                                template <Axis anAxis>
+ElementaryRotation<anAxis>      ElementaryRotation<anAxis>::toInverse       ( ) const
+{
+    return { cosine_, -sine_ } ;
+}
+
+                                template <Axis anAxis>
+RotationMatrix                  ElementaryRotation<anAxis>::toRotationMatrix ( ) const
+{
+
+    RotationMatrix rotationMatrix ;
+
+    rotationMatrix.matrix_.setIdentity() ;
+
+    rotationMatrix.matrix_(FirstIndex, FirstIndex) = +cosine_ ;
+    rotationMatrix.matrix_(FirstIndex, SecondIndex) = +sine_ ;
+    rotationMatrix.matrix_(SecondIndex, FirstIndex) = -sine_ ;
+    rotationMatrix.matrix_(SecondIndex, SecondIndex) = +cosine_ ;
+
+    return rotationMatrix ;
+
+}
+
+                                template <Axis anAxis>
+Quaternion                      ElementaryRotation<anAxis>::toQuaternion    ( ) const
+{
+
+    // Half angle, in [-90, 90] [deg], from the cosine and sine of the angle (no trigonometric call)
+
+    double halfAngleCosine ;
+    double halfAngleSine ;
+
+    if (cosine_ >= 0.0)
+    {
+        halfAngleCosine = std::sqrt(0.5 * (1.0 + cosine_)) ;
+        halfAngleSine = sine_ / (2.0 * halfAngleCosine) ;
+    }
+    else
+    {
+        halfAngleSine = std::copysign(std::sqrt(0.5 * (1.0 - cosine_)), sine_) ;
+        halfAngleCosine = sine_ / (2.0 * halfAngleSine) ;
+    }
+
+    Vector3d vectorPart = Vector3d::Zero() ;
+
+    vectorPart(AxisIndex) = halfAngleSine ;
+
+    return Quaternion(vectorPart, halfAngleCosine).normalize() ;
+
+}
+
+                                template <Axis anAxis>
+ElementaryRotation<anAxis>      ElementaryRotation<anAxis>::Unit            ( )
+{
+    return { 1.0, 0.0 } ;
+}
+
+                                template <Axis anAxis>
+                                ElementaryRotation<anAxis>::ElementaryRotation (   const   double                   aCosine,
+                                                                                const   double                      aSine                                       )
+                                :   cosine_(aCosine),
+                                    sine_(aSine)
+{
+
+}
+
+                                template <Axis anAxis>
+void                            ElementaryRotation<anAxis>::applyOnTheLeft  (           RotationMatrix&             aRotationMatrix                             ) const
+{
+
+    Matrix3d& matrix = aRotationMatrix.matrix_ ;
+
+    // Only the rows of the mixed coordinates are updated: 12 multiplications instead of 27
+
+    for (Index columnIndex = 0; columnIndex < 3; ++columnIndex)
+    {
+
+        const double first = matrix(FirstIndex, columnIndex) ;
+        const double second = matrix(SecondIndex, columnIndex) ;
+
+        matrix(FirstIndex, columnIndex) = (cosine_ * first) + (sine_ * second) ;
+        matrix(SecondIndex, columnIndex) = (cosine_ * second) - (sine_ * first) ;
+
+    }
+
+}
+
+                                template <Axis anAxis>
+void                            ElementaryRotation<anAxis>::applyOnTheRight (           RotationMatrix&             aRotationMatrix                             ) const
+{
+
+    Matrix3d& matrix = aRotationMatrix.matrix_ ;
+
+    // Only the columns of the mixed coordinates are updated: 12 multiplications instead of 27
+
+    for (Index rowIndex = 0; rowIndex < 3; ++rowIndex)
+    {
+
+        const double first = matrix(rowIndex, FirstIndex) ;
+        const double second = matrix(rowIndex, SecondIndex) ;
+
+        matrix(rowIndex, FirstIndex) = (cosine_ * first) - (sine_ * second) ;
+        matrix(rowIndex, SecondIndex) = (sine_ * first) + (cosine_ * second) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,579 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+#include <OpenSpaceToolkit/Core/Error.hpp>
+#include <OpenSpaceToolkit/Core/Utilities.hpp>
+
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+namespace d3
+{
+namespace trf
+{
+namespace rot
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::core::types::Index ;
+using ostk::math::obj::Vector4d ;
+using ostk::math::obj::Matrix3d ;
+
+/// @brief                      Axis indices of an axis sequence
+///
+///                             The third index is the axis orthogonal to the first two ones (equal to the last axis for
+///                             Tait-Bryan sequences), and the parity is +1 if (first, second, third) is a cyclic permutation
+///                             of (X, Y, Z), -1 otherwise.
+
+struct Axes
+{
+
+    Index                       first ;
+    Index                       second ;
+    Index                       third ;
+    bool                        isProper ;
+    double                      parity ;
+
+} ;
+
+/// Relative magnitude under which the middle angle is considered at its bounds (gimbal lock)
+
+constexpr double                GimbalLockTolerance                         =   1e-12 ;
+
+Axes                            AxesFromSequence                            (   const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    const auto axes = [] (const Index aFirstIndex, const Index aSecondIndex, const Index aLastIndex) -> Axes
+    {
+
+        const Index thirdIndex = 3 - aFirstIndex - aSecondIndex ;
+
+        return { aFirstIndex, aSecondIndex, thirdIndex, (aFirstIndex == aLastIndex), ((aSecondIndex == ((aFirstIndex + 1) % 3)) ? +1.0 : -1.0) } ;
+
+    } ;
+
+    switch (anAxisSequence)
+    {
+
+        case EulerAngle::AxisSequence::XYX:
+            return axes(0, 1, 0) ;
+
+        case EulerAngle::AxisSequence::XYZ:
+            return axes(0, 1, 2) ;
+
+        case EulerAngle::AxisSequence::XZX:
+            return axes(0, 2, 0) ;
+
+        case EulerAngle::AxisSequence::XZY:
+            return axes(0, 2, 1) ;
+
+        case EulerAngle::AxisSequence::YXY:
+            return axes(1, 0, 1) ;
+
+        case EulerAngle::AxisSequence::YXZ:
+            return axes(1, 0, 2) ;
+
+        case EulerAngle::AxisSequence::YZX:
+            return axes(1, 2, 0) ;
+
+        case EulerAngle::AxisSequence::YZY:
+            return axes(1, 2, 1) ;
+
+        case EulerAngle::AxisSequence::ZXY:
+            return axes(2, 0, 1) ;
+
+        case EulerAngle::AxisSequence::ZXZ:
+            return axes(2, 0, 2) ;
+
+        case EulerAngle::AxisSequence::ZYX:
+            return axes(2, 1, 0) ;
+
+        case EulerAngle::AxisSequence::ZYZ:
+            return axes(2, 1, 2) ;
+
+        case EulerAngle::AxisSequence::Undefined:
+            throw ostk::core::error::runtime::Undefined("Axis sequence") ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Axis sequence") ;
+
+    }
+
+    return {} ;
+
+}
+
+double                          Wrapped                                     (   const   double                      anAngle                                     )
+{
+
+    if (anAngle > M_PI)
+    {
+        return anAngle - 2.0 * M_PI ;
+    }
+
+    if (anAngle <= -M_PI)
+    {
+        return anAngle + 2.0 * M_PI ;
+    }
+
+    return anAngle ;
+
+}
+
+/// @brief                      Unit quaternion (XYZS) from Euler angles [rad]
+///
+///                             Closed-form product of the three elementary quaternions, from the half angles.
+
+Vector4d                        QuaternionFromAngles                        (   const   Axes&                       anAxes,
+                                                                                const   double                      aPhi,
+                                                                                const   double                      aTheta,
+                                                                                const   double                      aPsi                                        )
+{
+
+    const double e = anAxes.parity ;
+
+    Vector4d quaternion ;
+
+    if (anAxes.isProper)
+    {
+
+        const double halfSum = 0.5 * (aPhi + aPsi) ;
+        const double halfDifference = 0.5 * (aPhi - aPsi) ;
+
+        const double c2 = std::cos(0.5 * aTheta) ;
+        const double s2 = std::sin(0.5 * aTheta) ;
+
+        quaternion(anAxes.first) = c2 * std::sin(halfSum) ;
+        quaternion(anAxes.second) = s2 * std::cos(halfDifference) ;
+        quaternion(anAxes.third) = e * s2 * std::sin(halfDifference) ;
+        quaternion(3) = c2 * std::cos(halfSum) ;
+
+    }
+    else
+    {
+
+        const double c1 = std::cos(0.5 * aPhi) ;
+        const double s1 = std::sin(0.5 * aPhi) ;
+        const double c2 = std::cos(0.5 * aTheta) ;
+        const double s2 = std::sin(0.5 * aTheta) ;
+        const double c3 = std::cos(0.5 * aPsi) ;
+        const double s3 = std::sin(0.5 * aPsi) ;
+
+        quaternion(anAxes.first) = (s1 * c2 * c3) + e * (c1 * s2 * s3) ;
+        quaternion(anAxes.second) = (c1 * s2 * c3) - e * (s1 * c2 * s3) ;
+        quaternion(anAxes.third) = (c1 * c2 * s3) + e * (s1 * s2 * c3) ;
+        quaternion(3) = (c1 * c2 * c3) - e * (s1 * s2 * s3) ;
+
+    }
+
+    return quaternion.normalized() ;
+
+}
+
+/// @brief                      Euler angles [rad] from a non-zero quaternion (XYZS)
+///
+///                             The quaternion components are combined into two pairs, whose polar angles are the half sum and the
+///                             half difference of the first and third angles, and whose magnitudes give the middle angle.
+///                             Tait-Bryan sequences are handled as proper Euler sequences, with the middle angle shifted by 90 [deg].
+///
+/// @ref                        Bernardes E., Viollet S. (2022), Quaternion to Euler angles conversion: A direct, general and computationally efficient method
+
+Vector3d                        AnglesFromQuaternion                        (   const   Axes&                       anAxes,
+                                                                                const   Vector4d&                   aQuaternion                                 )
+{
+
+    const double e = anAxes.parity ;
+
+    const double s = aQuaternion(3) ;
+    const double x_1 = aQuaternion(anAxes.first) ;
+    const double x_2 = aQuaternion(anAxes.second) ;
+    const double x_3 = aQuaternion(anAxes.third) ;
+
+    const double a = anAxes.isProper ? s : (s - x_2) ;
+    const double b = anAxes.isProper ? x_1 : (x_1 - e * x_3) ;
+    const double c = anAxes.isProper ? x_2 : (s + x_2) ;
+    const double d = anAxes.isProper ? (e * x_3) : (x_1 + e * x_3) ;
+
+    const double firstNorm = std::hypot(a, b) ;
+    const double secondNorm = std::hypot(c, d) ;
+
+    const double theta = 2.0 * std::atan2(secondNorm, firstNorm) - (anAxes.isProper ? 0.0 : M_PI_2) ;
+
+    const double firstHalfAngle = std::atan2(b, a) ;
+    const double secondHalfAngle = std::atan2(d, c) ;
+
+    if (secondNorm <= GimbalLockTolerance * firstNorm)
+    {
+        return { Wrapped(2.0 * firstHalfAngle), theta, 0.0 } ;
+    }
+
+    if (firstNorm <= GimbalLockTolerance * secondNorm)
+    {
+        return { Wrapped(2.0 * secondHalfAngle), theta, 0.0 } ;
+    }
+
+    const double phi = firstHalfAngle + secondHalfAngle ;
+    const double psi = anAxes.isProper ? (firstHalfAngle - secondHalfAngle) : (e * (secondHalfAngle - firstHalfAngle)) ;
+
+    return { Wrapped(phi), theta, Wrapped(psi) } ;
+
+}
+
+/// @brief                      Euler angles [rad] from a rotation matrix
+
+Vector3d                        AnglesFromMatrix                            (   const   Axes&                       anAxes,
+                                                                                const   Matrix3d&                   aMatrix                                     )
+{
+
+    const double e = anAxes.parity ;
+
+    const Index i = anAxes.first ;
+    const Index j = anAxes.second ;
+    const Index k = anAxes.third ;
+
+    if (anAxes.isProper)
+    {
+
+        const double sine = std::hypot(aMatrix(i, j), aMatrix(i, k)) ;
+        const double theta = std::atan2(sine, aMatrix(i, i)) ;
+
+        if (sine <= GimbalLockTolerance)
+        {
+            return { std::atan2(e * aMatrix(j, k), aMatrix(j, j)), theta, 0.0 } ;
+        }
+
+        return { std::atan2(aMatrix(i, j), -e * aMatrix(i, k)), theta, std::atan2(aMatrix(j, i), e * aMatrix(k, i)) } ;
+
+    }
+
+    const double cosine = std::hypot(aMatrix(k, k), aMatrix(k, j)) ;
+    const double theta = std::atan2(e * aMatrix(k, i), cosine) ;
+
+    if (cosine <= GimbalLockTolerance)
+    {
+        return { std::atan2(e * aMatrix(j, k), aMatrix(j, j)), theta, 0.0 } ;
+    }
+
+    return { std::atan2(-e * aMatrix(k, j), aMatrix(k, k)), theta, std::atan2(-e * aMatrix(j, i), aMatrix(i, i)) } ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                EulerAngle::EulerAngle                      (   const   Angle&                      aFirstAngle,
+                                                                                const   Angle&                      aSecondAngle,
+                                                                                const   Angle&                      aThirdAngle,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+                                :   phi_(aFirstAngle),
+                                    theta_(aSecondAngle),
+                                    psi_(aThirdAngle),
+                                    axisSequence_(anAxisSequence)
+{
+
+}
+
+bool                            EulerAngle::operator ==                     (   const   EulerAngle&                 anEulerAngle                                ) const
+{
+
+    if ((!this->isDefined()) || (!anEulerAngle.isDefined()))
+    {
+        return false ;
+    }
+
+    return (phi_ == anEulerAngle.phi_) && (theta_ == anEulerAngle.theta_) && (psi_ == anEulerAngle.psi_) && (axisSequence_ == anEulerAngle.axisSequence_) ;
+
+}
+
+bool                            EulerAngle::operator !=                     (   const   EulerAngle&                 anEulerAngle                                ) const
+{
+    return !((*this) == anEulerAngle) ;
+}
+
+std::ostream&                   operator <<                                 (           std::ostream&               anOutputStream,
+                                                                                const   EulerAngle&                 anEulerAngle                                )
+{
+
+    ostk::core::utils::Print::Header(anOutputStream, "Euler Angle") ;
+
+    ostk::core::utils::Print::Line(anOutputStream) << "Phi:" << (anEulerAngle.phi_.isDefined() ? anEulerAngle.phi_.toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Theta:" << (anEulerAngle.theta_.isDefined() ? anEulerAngle.theta_.toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Psi:" << (anEulerAngle.psi_.isDefined() ? anEulerAngle.psi_.toString() : "Undefined") ;
+    ostk::core::utils::Print::Line(anOutputStream) << "Axis sequence:" << EulerAngle::StringFromAxisSequence(anEulerAngle.axisSequence_) ;
+
+    ostk::core::utils::Print::Footer(anOutputStream) ;
+
+    return anOutputStream ;
+
+}
+
+bool                            EulerAngle::isDefined                       ( ) const
+{
+    return phi_.isDefined() && theta_.isDefined() && psi_.isDefined() && (axisSequence_ != EulerAngle::AxisSequence::Undefined) ;
+}
+
+Angle                           EulerAngle::getPhi                          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return phi_ ;
+
+}
+
+Angle                           EulerAngle::getTheta                        ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return theta_ ;
+
+}
+
+Angle                           EulerAngle::getPsi                          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return psi_ ;
+
+}
+
+EulerAngle::AxisSequence        EulerAngle::getAxisSequence                 ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return axisSequence_ ;
+
+}
+
+Vector3d                        EulerAngle::toVector                        (   const   Angle::Unit&                anAngleUnit                                 ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return { phi_.in(anAngleUnit), theta_.in(anAngleUnit), psi_.in(anAngleUnit) } ;
+
+}
+
+rot::Quaternion                 EulerAngle::toQuaternion                    ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return { QuaternionFromAngles(AxesFromSequence(axisSequence_), phi_.inRadians(), theta_.inRadians(), psi_.inRadians()), rot::Quaternion::Format::XYZS } ;
+
+}
+
+rot::RotationMatrix             EulerAngle::toRotationMatrix                ( ) const
+{
+    return rot::RotationMatrix::Quaternion(this->toQuaternion()) ;
+}
+
+String                          EulerAngle::toString                        (   const   Integer&                    aPrecision                                  ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Euler angle") ;
+    }
+
+    return String::Format("[{}, {}, {}] ({})", phi_.toString(aPrecision), theta_.toString(aPrecision), psi_.toString(aPrecision), EulerAngle::StringFromAxisSequence(axisSequence_)) ;
+
+}
+
+EulerAngle                      EulerAngle::Undefined                       ( )
+{
+    return { Angle::Undefined(), Angle::Undefined(), Angle::Undefined(), EulerAngle::AxisSequence::Undefined } ;
+}
+
+EulerAngle                      EulerAngle::Vector                          (   const   Vector3d&                   aVector,
+                                                                                const   Angle::Unit&                anAngleUnit,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    if (!aVector.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Vector") ;
+    }
+
+    return { Angle(aVector.x(), anAngleUnit), Angle(aVector.y(), anAngleUnit), Angle(aVector.z(), anAngleUnit), anAxisSequence } ;
+
+}
+
+EulerAngle                      EulerAngle::Quaternion                      (   const   rot::Quaternion&            aQuaternion,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    if (!aQuaternion.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Quaternion") ;
+    }
+
+    if (!aQuaternion.isUnitary())
+    {
+        throw ostk::core::error::RuntimeError("Quaternion is not unitary.") ;
+    }
+
+    const Vector3d angles = AnglesFromQuaternion(AxesFromSequence(anAxisSequence), aQuaternion.toVector(rot::Quaternion::Format::XYZS)) ;
+
+    return EulerAngle::Vector(angles, Angle::Unit::Radian, anAxisSequence) ;
+
+}
+
+EulerAngle                      EulerAngle::RotationMatrix                  (   const   rot::RotationMatrix&        aRotationMatrix,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    if (!aRotationMatrix.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Rotation matrix") ;
+    }
+
+    const Vector3d angles = AnglesFromMatrix(AxesFromSequence(anAxisSequence), aRotationMatrix.accessMatrix()) ;
+
+    return EulerAngle::Vector(angles, Angle::Unit::Radian, anAxisSequence) ;
+
+}
+
+Matrix4Xd                       EulerAngle::QuaternionsFromAngles           (   const   Matrix3Xd&                  anAngleArray,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    const Axes axes = AxesFromSequence(anAxisSequence) ;
+
+    Matrix4Xd quaternions(4, anAngleArray.cols()) ;
+
+    for (Eigen::Index index = 0; index < anAngleArray.cols(); ++index)
+    {
+        quaternions.col(index) = QuaternionFromAngles(axes, anAngleArray(0, index), anAngleArray(1, index), anAngleArray(2, index)) ;
+    }
+
+    return quaternions ;
+
+}
+
+Matrix3Xd                       EulerAngle::AnglesFromQuaternions           (   const   Matrix4Xd&                  aQuaternionArray,
+                                                                                const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    const Axes axes = AxesFromSequence(anAxisSequence) ;
+
+    Matrix3Xd angles(3, aQuaternionArray.cols()) ;
+
+    for (Eigen::Index index = 0; index < aQuaternionArray.cols(); ++index)
+    {
+        angles.col(index) = AnglesFromQuaternion(axes, aQuaternionArray.col(index)) ;
+    }
+
+    return angles ;
+
+}
+
+String                          EulerAngle::StringFromAxisSequence          (   const   EulerAngle::AxisSequence&   anAxisSequence                              )
+{
+
+    switch (anAxisSequence)
+    {
+
+        case EulerAngle::AxisSequence::Undefined:
+            return "Undefined" ;
+
+        case EulerAngle::AxisSequence::XYX:
+            return "XYX" ;
+
+        case EulerAngle::AxisSequence::XYZ:
+            return "XYZ" ;
+
+        case EulerAngle::AxisSequence::XZX:
+            return "XZX" ;
+
+        case EulerAngle::AxisSequence::XZY:
+            return "XZY" ;
+
+        case EulerAngle::AxisSequence::YXY:
+            return "YXY" ;
+
+        case EulerAngle::AxisSequence::YXZ:
+            return "YXZ" ;
+
+        case EulerAngle::AxisSequence::YZX:
+            return "YZX" ;
+
+        case EulerAngle::AxisSequence::YZY:
+            return "YZY" ;
+
+        case EulerAngle::AxisSequence::ZXY:
+            return "ZXY" ;
+
+        case EulerAngle::AxisSequence::ZXZ:
+            return "ZXZ" ;
+
+        case EulerAngle::AxisSequence::ZYX:
+            return "ZYX" ;
+
+        case EulerAngle::AxisSequence::ZYZ:
+            return "ZYZ" ;
+
+        default:
+            throw ostk::core::error::runtime::Wrong("Axis sequence") ;
+            break ;
+
+    }
+
+    return String::Empty() ;
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -10,10 +10,13 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationVector.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/QuaternionKernel.hpp>
 
 #include <OpenSpaceToolkit/Core/Error.hpp>
 #include <OpenSpaceToolkit/Core/Utilities.hpp>
 
+#include <initializer_list>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace ostk
@@ -29,6 +32,44 @@ namespace trf
 namespace rot
 {
 
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+void                            ValidateInterpolationInputs                 (   const   std::initializer_list<Quaternion>& aQuaternionList,
+                                                                                const   Real&                       aRatio                                      )
+{
+
+    for (const auto& quaternion : aQuaternionList)
+    {
+
+        if (!quaternion.isDefined())
+        {
+            throw ostk::core::error::runtime::Undefined("Quaternion") ;
+        }
+
+        if (!quaternion.isUnitary())
+        {
+            throw ostk::core::error::RuntimeError("Quaternion is not unitary.") ;
+        }
+
+    }
+
+    if (!aRatio.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Ratio") ;
+    }
+
+    if ((aRatio < 0.0) || (aRatio > 1.0))
+    {
+        throw ostk::core::error::RuntimeError("Ratio [{}] is not in [0, 1].", aRatio) ;
+    }
+
+}
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
                                 Quaternion::Quaternion                      (   const   Real&                       aFirstComponent,
@@ -119,12 +160,22 @@ Quaternion                      Quaternion::operator /                      (
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    if (aQuaternion.norm() < Real::Epsilon())
+    const double left[4] = { x_, y_, z_, s_ } ;
+
+    double right[4] = { aQuaternion.x_, aQuaternion.y_, aQuaternion.z_, aQuaternion.s_ } ;
+
+    if (std::sqrt(kernel::SquaredNorm(right)) < Real::Epsilon())
     {
         throw ostk::core::error::RuntimeError("Cannot divide by quaternion with zero norm.") ;
     }
 
-    return this->crossMultiply(aQuaternion.toInverse()) ;
+    kernel::Inverse(right) ;
+
+    double result[4] ;
+
+    kernel::CrossMultiply(left, right, result) ;
+
+    return { result[0], result[1], result[2], result[3], Quaternion::Format::XYZS } ;
 
 }
 
@@ -136,7 +187,16 @@ Quaternion&                     Quaternion::operator *=                     (
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    (*this) = this->crossMultiply(aQuaternion) ; // [TBI] This is a shortcut... could be optimized
+    double components[4] = { x_, y_, z_, s_ } ;
+
+    const double right[4] = { aQuaternion.x_, aQuaternion.y_, aQuaternion.z_, aQuaternion.s_ } ;
+
+    kernel::CrossMultiply(components, right, components) ;
+
+    x_ = components[0] ;
+    y_ = components[1] ;
+    z_ = components[2] ;
+    s_ = components[3] ;
 
     return *this ;
 
@@ -150,12 +210,22 @@ Quaternion&                     Quaternion::operator /=                     (
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    if (aQuaternion.norm() < Real::Epsilon())
+    double components[4] = { x_, y_, z_, s_ } ;
+
+    double right[4] = { aQuaternion.x_, aQuaternion.y_, aQuaternion.z_, aQuaternion.s_ } ;
+
+    if (std::sqrt(kernel::SquaredNorm(right)) < Real::Epsilon())
     {
         throw ostk::core::error::RuntimeError("Cannot divide by quaternion with zero norm.") ;
     }
 
-    (*this) = this->crossMultiply(aQuaternion.toInverse()) ; // [TBI] This is a shortcut... could be optimized
+    kernel::Inverse(right) ;
+    kernel::CrossMultiply(components, right, components) ;
+
+    x_ = components[0] ;
+    y_ = components[1] ;
+    z_ = components[2] ;
+    s_ = components[3] ;
 
     return *this ;
 
@@ -287,17 +357,20 @@ Real                            Quaternion::getScalarPart                   ( )
 
 Quaternion                      Quaternion::toNormalized                    ( ) const
 {
-
-    if (!this->isDefined())
-    {
-        throw ostk::core::error::runtime::Undefined("Quaternion") ;
-    }
-
     return Quaternion(*this).normalize() ;
-
 }
 
 Quaternion                      Quaternion::toConjugate                     ( ) const
+{
+    return Quaternion(*this).conjugate() ;
+}
+
+Quaternion                      Quaternion::toInverse                       ( ) const
+{
+    return Quaternion(*this).inverse() ;
+}
+
+Quaternion                      Quaternion::pow                             (   const   Real&                       aValue                                      ) const
 {
 
     if (!this->isDefined())
@@ -305,11 +378,20 @@ Quaternion                      Quaternion::toConjugate                     ( )
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    return Quaternion(*this).conjugate() ;
+    if (!aValue.isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Value") ;
+    }
+
+    const Quaternion logarithm = this->log() ;
+
+    const double value = aValue ;
+
+    return Quaternion(value * logarithm.getVectorPart(), value * logarithm.s_).exp() ;
 
 }
 
-Quaternion                      Quaternion::toInverse                       ( ) const
+Quaternion                      Quaternion::exp                             ( ) const
 {
 
     if (!this->isDefined())
@@ -317,45 +399,46 @@ Quaternion                      Quaternion::toInverse                       ( )
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    return Quaternion(*this).inverse() ;
+    const Vector3d vectorPart = this->getVectorPart() ;
 
-}
+    const double angle = vectorPart.norm() ;
+    const double scale = std::exp(static_cast<double>(s_)) ;
+
+    // sin(angle) / angle tends to 1 as angle tends to 0
 
-// Quaternion                      Quaternion::pow                             (   const   Real&                       aValue                                      ) const
-// {
+    const double sinc = (angle > 1e-8) ? (std::sin(angle) / angle) : (1.0 - (angle * angle) / 6.0) ;
 
-//     if (!this->isDefined())
-//     {
-//         throw ostk::core::error::runtime::Undefined("Quaternion") ;
-//     }
+    return { scale * sinc * vectorPart, scale * std::cos(angle) } ;
 
-//     AAAAAAA
+}
+
+Quaternion                      Quaternion::log                             ( ) const
+{
 
-// }
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Quaternion") ;
+    }
 
-// Quaternion                      Quaternion::exp                             ( ) const
-// {
+    const Real norm = this->norm() ;
 
-//     if (!this->isDefined())
-//     {
-//         throw ostk::core::error::runtime::Undefined("Quaternion") ;
-//     }
+    if (norm < Real::Epsilon())
+    {
+        throw ostk::core::error::RuntimeError("Quaternion norm is zero.") ;
+    }
 
-//     AAAAAAA
+    const Vector3d vectorPart = this->getVectorPart() ;
 
-// }
+    const double vectorNorm = vectorPart.norm() ;
+    const double angle = std::atan2(vectorNorm, static_cast<double>(s_)) ;
 
-// Quaternion                      Quaternion::log                             ( ) const
-// {
+    // angle / sin(angle) tends to 1 as angle tends to 0
 
-//     if (!this->isDefined())
-//     {
-//         throw ostk::core::error::runtime::Undefined("Quaternion") ;
-//     }
+    const double scale = (vectorNorm > 1e-12) ? (angle / vectorNorm) : (1.0 / static_cast<double>(norm)) ;
 
-//     AAAAAAA
+    return { scale * vectorPart, std::log(static_cast<double>(norm)) } ;
 
-// }
+}
 
 Real                            Quaternion::norm                            ( ) const
 {
@@ -377,16 +460,14 @@ Quaternion                      Quaternion::crossMultiply                   (
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    const Vector3d leftVectorPart = this->getVectorPart() ;
-    const Real& leftScalarPart = s_ ;
+    const double left[4] = { x_, y_, z_, s_ } ;
+    const double right[4] = { aQuaternion.x_, aQuaternion.y_, aQuaternion.z_, aQuaternion.s_ } ;
 
-    const Vector3d rightVectorPart = aQuaternion.getVectorPart() ;
-    const Real& rightScalarPart = aQuaternion.s_ ;
+    double result[4] ;
 
-    const Vector3d vectorPart = (rightScalarPart * leftVectorPart) + (leftScalarPart * rightVectorPart) - leftVectorPart.cross(rightVectorPart) ;
-    const Real scalarPart = (leftScalarPart * rightScalarPart) - leftVectorPart.dot(rightVectorPart) ;
+    kernel::CrossMultiply(left, right, result) ;
 
-    return { vectorPart, scalarPart } ;
+    return { result[0], result[1], result[2], result[3], Quaternion::Format::XYZS } ;
 
 }
 
@@ -398,16 +479,14 @@ Quaternion                      Quaternion::dotMultiply                     (
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    const Vector3d leftVectorPart = this->getVectorPart() ;
-    const Real& leftScalarPart = s_ ;
+    const double left[4] = { x_, y_, z_, s_ } ;
+    const double right[4] = { aQuaternion.x_, aQuaternion.y_, aQuaternion.z_, aQuaternion.s_ } ;
 
-    const Vector3d rightVectorPart = aQuaternion.getVectorPart() ;
-    const Real& rightScalarPart = aQuaternion.s_ ;
+    double result[4] ;
 
-    const Vector3d vectorPart = (rightScalarPart * leftVectorPart) + (leftScalarPart * rightVectorPart) + leftVectorPart.cross(rightVectorPart) ;
-    const Real scalarPart = (leftScalarPart * rightScalarPart) - leftVectorPart.dot(rightVectorPart) ;
+    kernel::DotMultiply(left, right, result) ;
 
-    return { vectorPart, scalarPart } ;
+    return { result[0], result[1], result[2], result[3], Quaternion::Format::XYZS } ;
 
 }
 
@@ -429,7 +508,40 @@ Vector3d                        Quaternion::rotateVector                    (
         throw ostk::core::error::RuntimeError("Quaternion with norm [{}] is not unitary.", this->norm()) ;
     }
 
-    return this->crossMultiply(Quaternion(aVector, 0.0)).crossMultiply(this->toConjugate()).getVectorPart() ;
+    const double components[4] = { x_, y_, z_, s_ } ;
+
+    Vector3d vector ;
+
+    kernel::RotateVector(components, aVector.data(), vector.data()) ;
+
+    return vector ;
+
+}
+
+Matrix3Xd                       Quaternion::rotateVectors                   (   const   Matrix3Xd&                  aVectorArray                                ) const
+{
+
+    const Matrix3d rotationMatrix = this->toVectorRotationMatrix() ;
+
+    Matrix3Xd vectorArray(3, aVectorArray.cols()) ;
+
+    vectorArray.noalias() = rotationMatrix * aVectorArray ;
+
+    return vectorArray ;
+
+}
+
+void                            Quaternion::rotateVectorsInPlace            (           Matrix3Xd&                  aVectorArray                                ) const
+{
+
+    const Matrix3d rotationMatrix = this->toVectorRotationMatrix() ;
+
+    // Column by column, so that no temporary of the size of the batch is allocated
+
+    for (Eigen::Index columnIndex = 0; columnIndex < aVectorArray.cols(); ++columnIndex)
+    {
+        aVectorArray.col(columnIndex) = rotationMatrix * aVectorArray.col(columnIndex) ;
+    }
 
 }
 
@@ -493,17 +605,19 @@ Quaternion&                     Quaternion::normalize                       ( )
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    const Real norm = this->norm() ;
+    double components[4] = { x_, y_, z_, s_ } ;
 
-    if (norm.abs() < Real::Epsilon())
+    if (std::sqrt(kernel::SquaredNorm(components)) < Real::Epsilon())
     {
         throw ostk::core::error::RuntimeError("Quaternion norm is zero.") ;
     }
 
-    x_ /= norm ;
-    y_ /= norm ;
-    z_ /= norm ;
-    s_ /= norm ;
+    kernel::Normalize(components) ;
+
+    x_ = components[0] ;
+    y_ = components[1] ;
+    z_ = components[2] ;
+    s_ = components[3] ;
 
     return *this ;
 
@@ -533,17 +647,19 @@ Quaternion&                     Quaternion::inverse                         ( )
         throw ostk::core::error::runtime::Undefined("Quaternion") ;
     }
 
-    const Real reducedNorm = (x_ * x_) + (y_ * y_) + (z_ * z_) + (s_ * s_) ;
+    double components[4] = { x_, y_, z_, s_ } ;
 
-    if (reducedNorm.abs() < Real::Epsilon())
+    if (kernel::SquaredNorm(components) < Real::Epsilon())
     {
         throw ostk::core::error::RuntimeError("Quaternion norm is zero.") ;
     }
 
-    x_ = -x_ / reducedNorm ;
-    y_ = -y_ / reducedNorm ;
-    z_ = -z_ / reducedNorm ;
-    s_ = +s_ / reducedNorm ;
+    kernel::Inverse(components) ;
+
+    x_ = components[0] ;
+    y_ = components[1] ;
+    z_ = components[2] ;
+    s_ = components[3] ;
 
     return *this ;
 
@@ -724,6 +840,136 @@ Quaternion                      Quaternion::Parse                           (
 
 }
 
+Quaternion                      Quaternion::SLERP                           (   const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Real&                       aRatio                                      )
+{
+
+    ValidateInterpolationInputs({ aFirstQuaternion, aSecondQuaternion }, aRatio) ;
+
+    const Vector4d firstVector = aFirstQuaternion.toVector() ;
+    Vector4d secondVector = aSecondQuaternion.toVector() ;
+
+    // Shortest path: q and -q represent the same rotation
+
+    double cosine = firstVector.dot(secondVector) ;
+
+    if (cosine < 0.0)
+    {
+        secondVector = -secondVector ;
+        cosine = -cosine ;
+    }
+
+    const double ratio = aRatio ;
+    const double angle = std::acos(std::min(cosine, 1.0)) ;
+
+    // Nearly identical quaternions: fall back to linear interpolation, as sin(angle) vanishes
+
+    const Vector4d vector = (angle > 1e-6)
+                          ? Vector4d((std::sin((1.0 - ratio) * angle) * firstVector + std::sin(ratio * angle) * secondVector) / std::sin(angle))
+                          : Vector4d((1.0 - ratio) * firstVector + ratio * secondVector) ;
+
+    return { vector.normalized(), Quaternion::Format::XYZS } ;
+
+}
+
+Quaternion                      Quaternion::NLERP                           (   const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Real&                       aRatio                                      )
+{
+
+    ValidateInterpolationInputs({ aFirstQuaternion, aSecondQuaternion }, aRatio) ;
+
+    const Vector4d firstVector = aFirstQuaternion.toVector() ;
+    Vector4d secondVector = aSecondQuaternion.toVector() ;
+
+    if (firstVector.dot(secondVector) < 0.0)
+    {
+        secondVector = -secondVector ;
+    }
+
+    const double ratio = aRatio ;
+
+    return { Vector4d((1.0 - ratio) * firstVector + ratio * secondVector).normalized(), Quaternion::Format::XYZS } ;
+
+}
+
+Quaternion                      Quaternion::SQUAD                           (   const   Quaternion&                 aPreviousQuaternion,
+                                                                                const   Quaternion&                 aFirstQuaternion,
+                                                                                const   Quaternion&                 aSecondQuaternion,
+                                                                                const   Quaternion&                 aNextQuaternion,
+                                                                                const   Real&                       aRatio                                      )
+{
+
+    ValidateInterpolationInputs({ aPreviousQuaternion, aFirstQuaternion, aSecondQuaternion, aNextQuaternion }, aRatio) ;
+
+    const Quaternion firstControlQuaternion = Quaternion::SQUADControlPoint(aPreviousQuaternion, aFirstQuaternion, aSecondQuaternion) ;
+    const Quaternion secondControlQuaternion = Quaternion::SQUADControlPoint(aFirstQuaternion, aSecondQuaternion, aNextQuaternion) ;
+
+    const Real ratio = aRatio ;
+
+    return Quaternion::SLERP
+    (
+        Quaternion::SLERP(aFirstQuaternion, aSecondQuaternion, ratio),
+        Quaternion::SLERP(firstControlQuaternion, secondControlQuaternion, ratio),
+        2.0 * ratio * (1.0 - ratio)
+    ) ;
+
+}
+
+Quaternion                      Quaternion::SQUADControlPoint               (   const   Quaternion&                 aPreviousQuaternion,
+                                                                                const   Quaternion&                 aQuaternion,
+                                                                                const   Quaternion&                 aNextQuaternion                             )
+{
+
+    ValidateInterpolationInputs({ aPreviousQuaternion, aQuaternion, aNextQuaternion }, 0.0) ;
+
+    // s = q exp(-(log(q* q_next) + log(q* q_previous)) / 4), with neighbors on the same hemisphere as q
+
+    const Vector4d vector = aQuaternion.toVector() ;
+
+    const Quaternion previousQuaternion = (vector.dot(aPreviousQuaternion.toVector()) < 0.0) ? Quaternion(-aPreviousQuaternion.toVector(), Quaternion::Format::XYZS) : aPreviousQuaternion ;
+    const Quaternion nextQuaternion = (vector.dot(aNextQuaternion.toVector()) < 0.0) ? Quaternion(-aNextQuaternion.toVector(), Quaternion::Format::XYZS) : aNextQuaternion ;
+
+    const Quaternion conjugateQuaternion = aQuaternion.toConjugate() ;
+
+    const Vector3d tangent = conjugateQuaternion.crossMultiply(nextQuaternion).log().getVectorPart()
+                           + conjugateQuaternion.crossMultiply(previousQuaternion).log().getVectorPart() ;
+
+    return aQuaternion.crossMultiply(Quaternion(-0.25 * tangent, 0.0).exp()).normalize() ;
+
+}
+
+Matrix3d                        Quaternion::toVectorRotationMatrix          ( ) const
+{
+
+    if (!this->isDefined())
+    {
+        throw ostk::core::error::runtime::Undefined("Quaternion") ;
+    }
+
+    if (!this->isUnitary())
+    {
+        throw ostk::core::error::RuntimeError("Quaternion with norm [{}] is not unitary.", this->norm()) ;
+    }
+
+    const double x = x_ ;
+    const double y = y_ ;
+    const double z = z_ ;
+    const double s = s_ ;
+
+    // Matrix of v -> q v q*, with the crossMultiply convention
+
+    Matrix3d rotationMatrix ;
+
+    rotationMatrix << 1.0 - 2.0 * (y * y + z * z),       2.0 * (x * y + z * s),       2.0 * (x * z - y * s),
+                            2.0 * (x * y - z * s), 1.0 - 2.0 * (x * x + z * z),       2.0 * (y * z + x * s),
+                            2.0 * (x * z + y * s),       2.0 * (y * z - x * s), 1.0 - 2.0 * (x * x + y * y) ;
+
+    return rotationMatrix ;
+
+}
+
 ///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 }
@@ -0,0 +1,261 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+                                template <class PointType>
+                                SegmentTree<PointType>::SegmentTree         (   const   Array<PointType>&           aPointArray                                 )
+                                :   vertices_(),
+                                    arcLengths_(),
+                                    nodes_()
+{
+
+    vertices_.reserve(aPointArray.getSize()) ;
+    arcLengths_.reserve(aPointArray.getSize()) ;
+
+    for (const auto& point : aPointArray)
+    {
+
+        vertices_.push_back(point.asVector()) ;
+
+        arcLengths_.push_back((vertices_.size() == 1) ? 0.0 : (arcLengths_.back() + (vertices_[vertices_.size() - 1] - vertices_[vertices_.size() - 2]).norm())) ;
+
+    }
+
+    if (this->getSegmentCount() > 0)
+    {
+
+        nodes_.reserve(2 * (this->getSegmentCount() / LeafSize + 1)) ;
+
+        this->build(0, this->getSegmentCount()) ;
+
+    }
+
+}
+
+template <class PointType>
+Size                            SegmentTree<PointType>::getSegmentCount     ( ) const
+{
+    return (vertices_.size() > 1) ? (vertices_.size() - 1) : 0 ;
+}
+
+template <class PointType>
+typename SegmentTree<PointType>::Projection SegmentTree<PointType>::project (   const   Vector&                     aPoint                                      ) const
+{
+
+    if (this->getSegmentCount() == 0)
+    {
+        return { PointType::Vector(vertices_.front()), 0, 0.0, (vertices_.front() - aPoint).norm() } ;
+    }
+
+    Candidate candidate ;
+
+    this->search(0, aPoint, candidate) ;
+
+    const Vector& firstVertex = vertices_[candidate.segmentIndex] ;
+    const Vector& secondVertex = vertices_[candidate.segmentIndex + 1] ;
+
+    const double segmentLength = arcLengths_[candidate.segmentIndex + 1] - arcLengths_[candidate.segmentIndex] ;
+
+    return
+    {
+        PointType::Vector(firstVertex + candidate.parameter * (secondVertex - firstVertex)),
+        candidate.segmentIndex,
+        arcLengths_[candidate.segmentIndex] + candidate.parameter * segmentLength,
+        std::sqrt(candidate.squaredDistance)
+    } ;
+
+}
+
+template <class PointType>
+typename SegmentTree<PointType>::Projection SegmentTree<PointType>::Project (   const   Array<PointType>&           aPointArray,
+                                                                                const   Vector&                     aPoint                                      )
+{
+
+    const Vector firstPoint = aPointArray.accessFirst().asVector() ;
+
+    if (aPointArray.getSize() == 1)
+    {
+        return { PointType::Vector(firstPoint), 0, 0.0, (firstPoint - aPoint).norm() } ;
+    }
+
+    Candidate candidate ;
+
+    Vector firstVertex = firstPoint ;
+
+    for (std::size_t segmentIndex = 0; (segmentIndex + 1) < aPointArray.getSize(); ++segmentIndex)
+    {
+
+        const Vector secondVertex = aPointArray[segmentIndex + 1].asVector() ;
+
+        SegmentTree::Visit(segmentIndex, firstVertex, secondVertex, aPoint, candidate) ;
+
+        firstVertex = secondVertex ;
+
+    }
+
+    // Arc length is only accumulated up to the closest segment
+
+    double arcLength = 0.0 ;
+
+    for (std::size_t segmentIndex = 0; segmentIndex < candidate.segmentIndex; ++segmentIndex)
+    {
+        arcLength += (aPointArray[segmentIndex + 1].asVector() - aPointArray[segmentIndex].asVector()).norm() ;
+    }
+
+    const Vector closestFirstVertex = aPointArray[candidate.segmentIndex].asVector() ;
+    const Vector closestDirection = aPointArray[candidate.segmentIndex + 1].asVector() - closestFirstVertex ;
+
+    return
+    {
+        PointType::Vector(closestFirstVertex + candidate.parameter * closestDirection),
+        candidate.segmentIndex,
+        arcLength + candidate.parameter * closestDirection.norm(),
+        std::sqrt(candidate.squaredDistance)
+    } ;
+
+}
+
+template <class PointType>
+void                            SegmentTree<PointType>::build               (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex                                  )
+{
+
+    const std::size_t nodeIndex = nodes_.size() ;
+
+    Vector minimum = vertices_[aBeginIndex] ;
+    Vector maximum = vertices_[aBeginIndex] ;
+
+    for (std::size_t vertexIndex = aBeginIndex + 1; vertexIndex <= anEndIndex; ++vertexIndex)
+    {
+        minimum = minimum.cwiseMin(vertices_[vertexIndex]) ;
+        maximum = maximum.cwiseMax(vertices_[vertexIndex]) ;
+    }
+
+    nodes_.push_back({ minimum, maximum, aBeginIndex, anEndIndex, 0 }) ;
+
+    if ((anEndIndex - aBeginIndex) <= LeafSize)
+    {
+        return ;
+    }
+
+    const std::size_t middleIndex = aBeginIndex + (anEndIndex - aBeginIndex) / 2 ;
+
+    this->build(aBeginIndex, middleIndex) ;
+
+    nodes_[nodeIndex].rightIndex = nodes_.size() ;
+
+    this->build(middleIndex, anEndIndex) ;
+
+}
+
+template <class PointType>
+void                            SegmentTree<PointType>::search              (   const   std::size_t&                aNodeIndex,
+                                                                                const   Vector&                     aPoint,
+                                                                                        Candidate&                  aCandidate                                  ) const
+{
+
+    const Node& node = nodes_[aNodeIndex] ;
+
+    if ((node.endIndex - node.beginIndex) <= LeafSize)
+    {
+
+        for (std::size_t segmentIndex = node.beginIndex; segmentIndex < node.endIndex; ++segmentIndex)
+        {
+            SegmentTree::Visit(segmentIndex, vertices_[segmentIndex], vertices_[segmentIndex + 1], aPoint, aCandidate) ;
+        }
+
+        return ;
+
+    }
+
+    const std::size_t leftIndex = aNodeIndex + 1 ;
+    const std::size_t rightIndex = node.rightIndex ;
+
+    const double leftSquaredDistance = this->getSquaredDistanceToBox(nodes_[leftIndex], aPoint) ;
+    const double rightSquaredDistance = this->getSquaredDistanceToBox(nodes_[rightIndex], aPoint) ;
+
+    // Descend into the closest child first, then into the other one if it may still hold a closer segment
+
+    const bool leftFirst = leftSquaredDistance <= rightSquaredDistance ;
+
+    const std::size_t nearIndex = leftFirst ? leftIndex : rightIndex ;
+    const std::size_t farIndex = leftFirst ? rightIndex : leftIndex ;
+    const double farSquaredDistance = leftFirst ? rightSquaredDistance : leftSquaredDistance ;
+
+    if ((leftFirst ? leftSquaredDistance : rightSquaredDistance) < aCandidate.squaredDistance)
+    {
+        this->search(nearIndex, aPoint, aCandidate) ;
+    }
+
+    if (farSquaredDistance < aCandidate.squaredDistance)
+    {
+        this->search(farIndex, aPoint, aCandidate) ;
+    }
+
+}
+
+template <class PointType>
+double                          SegmentTree<PointType>::getSquaredDistanceToBox (   const   Node&                   aNode,
+                                                                                const   Vector&                     aPoint                                      ) const
+{
+    return ((aNode.minimum - aPoint).cwiseMax(aPoint - aNode.maximum)).cwiseMax(0.0).squaredNorm() ;
+}
+
+template <class PointType>
+void                            SegmentTree<PointType>::Visit               (   const   std::size_t&                aSegmentIndex,
+                                                                                const   Vector&                     aFirstVertex,
+                                                                                const   Vector&                     aSecondVertex,
+                                                                                const   Vector&                     aPoint,
+                                                                                        Candidate&                  aCandidate                                  )
+{
+
+    const Vector direction = aSecondVertex - aFirstVertex ;
+
+    const double squaredLength = direction.squaredNorm() ;
+
+    const double parameter = (squaredLength > 0.0) ? std::clamp((aPoint - aFirstVertex).dot(direction) / squaredLength, 0.0, 1.0) : 0.0 ;
+
+    const double squaredDistance = (aFirstVertex + parameter * direction - aPoint).squaredNorm() ;
+
+    if (squaredDistance < aCandidate.squaredDistance)
+    {
+        aCandidate = { aSegmentIndex, parameter, squaredDistance } ;
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+template class SegmentTree<d2::objects::Point> ;
+template class SegmentTree<d3::objects::Point> ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,138 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.hpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef __OpenSpaceToolkit_Mathematics_Geometry_SegmentTree__
+#define __OpenSpaceToolkit_Mathematics_Geometry_SegmentTree__
+
+#include <OpenSpaceToolkit/Core/Containers/Array.hpp>
+#include <OpenSpaceToolkit/Core/Types/Size.hpp>
+#include <OpenSpaceToolkit/Core/Types/Index.hpp>
+
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace ostk
+{
+namespace math
+{
+namespace geom
+{
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+using ostk::core::types::Index ;
+using ostk::core::types::Size ;
+using ostk::core::ctnr::Array ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @brief                      Bounding volume hierarchy over the segments of a line string
+///
+///                             Consecutive segments of a line string are spatially coherent, so the hierarchy simply halves ranges of segment
+///                             indices, each node holding the bounding box of its range. Nodes are stored in depth-first order: the left child
+///                             of a node immediately follows it. Small ranges are leaves, scanned linearly.
+///
+///                             Defined for 2D and 3D points, which are converted to vectors through Point::asVector.
+
+template <class PointType>
+class SegmentTree
+{
+
+    public:
+
+        typedef                 decltype(std::declval<const PointType&>().asVector()) Vector ;
+
+        /// @brief              Projection of a point onto the line string
+
+        struct Projection
+        {
+
+            PointType           point ;
+            Index               segmentIndex ;
+            double              arcLength ;
+            double              distance ;
+
+        } ;
+
+                                SegmentTree                                 (   const   Array<PointType>&           aPointArray                                 ) ;
+
+        Size                    getSegmentCount                             ( ) const ;
+
+        SegmentTree::Projection project                                     (   const   Vector&                     aPoint                                      ) const ;
+
+        /// @brief              Project a point onto a line string by scanning all of its segments, without building a hierarchy
+        ///
+        /// @param              [in] aPointArray A non-empty point array
+        /// @param              [in] aPoint A point
+        /// @return             Projection
+
+        static SegmentTree::Projection Project                              (   const   Array<PointType>&           aPointArray,
+                                                                                const   Vector&                     aPoint                                      ) ;
+
+    private:
+
+        struct Node
+        {
+
+            Vector              minimum ;
+            Vector              maximum ;
+            std::size_t         beginIndex ;
+            std::size_t         endIndex ;
+            std::size_t         rightIndex ;
+
+        } ;
+
+        struct Candidate
+        {
+
+            std::size_t         segmentIndex = 0 ;
+            double              parameter = 0.0 ;
+            double              squaredDistance = std::numeric_limits<double>::infinity() ;
+
+        } ;
+
+        static constexpr std::size_t LeafSize = 8 ;
+
+        std::vector<Vector>     vertices_ ;
+        std::vector<double>     arcLengths_ ;
+        std::vector<Node>       nodes_ ;
+
+        void                    build                                       (   const   std::size_t&                aBeginIndex,
+                                                                                const   std::size_t&                anEndIndex                                  ) ;
+
+        void                    search                                      (   const   std::size_t&                aNodeIndex,
+                                                                                const   Vector&                     aPoint,
+                                                                                        Candidate&                  aCandidate                                  ) const ;
+
+        double                  getSquaredDistanceToBox                     (   const   Node&                       aNode,
+                                                                                const   Vector&                     aPoint                                      ) const ;
+
+        static void             Visit                                       (   const   std::size_t&                aSegmentIndex,
+                                                                                const   Vector&                     aFirstVertex,
+                                                                                const   Vector&                     aSecondVertex,
+                                                                                const   Vector&                     aPoint,
+                                                                                        Candidate&                  aCandidate                                  ) ;
+
+} ;
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+}
+}
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -253,6 +253,174 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_LineString, GetPointCount
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_LineString, GetProjectionOf)
+{
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::LineString ;
+
+    {
+
+        const LineString lineString = { { { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 2.0 } } } ;
+
+        const LineString::Projection projection = lineString.getProjectionOf({ 1.0, 1.0 }) ;
+
+        EXPECT_EQ(Point(1.0, 0.0), projection.point) ;
+        EXPECT_EQ(0, projection.segmentIndex) ;
+        EXPECT_NEAR(1.0, projection.arcLength, 1e-15) ;
+        EXPECT_NEAR(1.0, projection.distance, 1e-15) ;
+
+        EXPECT_EQ(Point(2.0, 1.5), lineString.getProjectionOf({ 3.0, 1.5 }).point) ;
+        EXPECT_EQ(1, lineString.getProjectionOf({ 3.0, 1.5 }).segmentIndex) ;
+        EXPECT_NEAR(3.5, lineString.getProjectionOf({ 3.0, 1.5 }).arcLength, 1e-15) ;
+
+        EXPECT_EQ(Point(0.0, 0.0), lineString.getProjectionOf({ -1.0, -1.0 }).point) ;
+        EXPECT_EQ(Point(2.0, 2.0), lineString.getProjectionOf({ 3.0, 3.0 }).point) ;
+        EXPECT_NEAR(4.0, lineString.getProjectionOf({ 3.0, 3.0 }).arcLength, 1e-15) ;
+
+        EXPECT_EQ(Point(1.0, 1.0), LineString({ { 1.0, 1.0 } }).getProjectionOf({ 1.0, 2.0 }).point) ;
+        EXPECT_NEAR(1.0, LineString({ { 1.0, 1.0 } }).getProjectionOf({ 1.0, 2.0 }).distance, 1e-15) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().getProjectionOf({ 0.0, 0.0 })) ;
+        EXPECT_ANY_THROW(LineString({ { 0.0, 0.0 } }).getProjectionOf(Point::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_LineString, BuildIndex)
+{
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::LineString ;
+
+    {
+
+        const LineString lineString = { { { 0.0, 0.0 }, { 2.0, 0.0 } } } ;
+
+        EXPECT_NO_THROW(lineString.buildIndex()) ;
+
+        EXPECT_EQ(Point(1.0, 0.0), lineString.getProjectionOf({ 1.0, 1.0 }).point) ;
+
+        const LineString lineStringCopy = lineString ;
+
+        EXPECT_EQ(Point(1.5, 0.0), lineStringCopy.getProjectionOf({ 1.5, -1.0 }).point) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().buildIndex()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_LineString, Simplify)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::LineString ;
+
+    {
+
+        // Noisy straight line collapses onto its end points
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        for (int index = 0; index <= 100; ++index)
+        {
+            points.add(Point(0.1 * index, ((index % 2) == 0) ? 0.0 : 0.001)) ;
+        }
+
+        points.accessLast() = Point(10.0, 0.0) ;
+
+        const LineString lineString = { points } ;
+
+        EXPECT_EQ(LineString({ { 0.0, 0.0 }, { 10.0, 0.0 } }), lineString.simplify(0.01)) ;
+        EXPECT_EQ(LineString({ { 0.0, 0.0 }, { 10.0, 0.0 } }), lineString.simplify(0.1, LineString::SimplificationMethod::Visvalingam)) ;
+
+        EXPECT_EQ(lineString, lineString.simplify(0.0001)) ;
+
+    }
+
+    {
+
+        // Corners are kept, collinear vertices go even at zero tolerance
+
+        const LineString lineString = { { { 0.0, 0.0 }, { 1.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 1.0 }, { 2.0, 2.0 } } } ;
+
+        EXPECT_EQ(LineString({ { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 2.0 } }), lineString.simplify(0.0)) ;
+        EXPECT_EQ(LineString({ { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 2.0 } }), lineString.simplify(0.0, LineString::SimplificationMethod::Visvalingam)) ;
+        EXPECT_EQ(LineString({ { 0.0, 0.0 }, { 2.0, 2.0 } }), lineString.simplify(1.5)) ;
+
+    }
+
+    {
+
+        // Closed line strings are simplified as rings
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        for (int index = 0; index < 10; ++index) { points.add(Point(0.1 * index, 0.0)) ; }
+        for (int index = 0; index < 10; ++index) { points.add(Point(1.0, 0.1 * index)) ; }
+        for (int index = 0; index < 10; ++index) { points.add(Point(1.0 - 0.1 * index, 1.0)) ; }
+        for (int index = 0; index < 10; ++index) { points.add(Point(0.0, 1.0 - 0.1 * index)) ; }
+
+        points.add(points.accessFirst()) ;
+
+        const LineString lineString = { points } ;
+
+        const LineString square = { { { 0.0, 0.0 }, { 1.0, 0.0 }, { 1.0, 1.0 }, { 0.0, 1.0 }, { 0.0, 0.0 } } } ;
+
+        EXPECT_EQ(square, lineString.simplify(1e-9)) ;
+        EXPECT_EQ(square, lineString.simplify(1e-9, LineString::SimplificationMethod::Visvalingam)) ;
+
+        // Rings keep 3 distinct vertices
+
+        EXPECT_EQ(4, lineString.simplify(10.0).getPointCount()) ;
+        EXPECT_EQ(4, lineString.simplify(10.0, LineString::SimplificationMethod::Visvalingam).getPointCount()) ;
+
+    }
+
+    {
+
+        // Topology preservation keeps vertices whose removal would sweep over another line string
+
+        const LineString firstLineString = { { { 0.0, 0.0 }, { 5.0, 1.0 }, { 10.0, 0.0 } } } ;
+        const LineString secondLineString = { { { 5.0, 0.5 }, { 5.0, 0.6 } } } ;
+
+        for (const auto& method : { LineString::SimplificationMethod::DouglasPeucker, LineString::SimplificationMethod::Visvalingam })
+        {
+
+            const Array<LineString> lineStrings = LineString::Simplify({ firstLineString, secondLineString }, 4.0, method, false) ;
+            const Array<LineString> topologicalLineStrings = LineString::Simplify({ firstLineString, secondLineString }, 4.0, method, true) ;
+
+            EXPECT_EQ(2, lineStrings[0].getPointCount()) ;
+            EXPECT_EQ(firstLineString, topologicalLineStrings[0]) ;
+            EXPECT_EQ(secondLineString, topologicalLineStrings[1]) ;
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().simplify(1.0)) ;
+        EXPECT_ANY_THROW(LineString({ { 0.0, 0.0 }, { 1.0, 0.0 } }).simplify(Real::Undefined())) ;
+        EXPECT_ANY_THROW(LineString({ { 0.0, 0.0 }, { 1.0, 0.0 } }).simplify(-1.0)) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_LineString, ToString)
 {
 
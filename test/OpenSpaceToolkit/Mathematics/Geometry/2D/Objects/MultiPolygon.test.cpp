@@ -14,6 +14,8 @@
 
 #include <Global.test.hpp>
 
+#include <cmath>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, Constructor)
@@ -461,6 +463,124 @@
 
 // // }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, ContainsPoints)
+{
+
+    using ostk::math::obj::VectorXb ;
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 2.0, 0.0 }, { 2.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } } ;
+
+        const MultiPolygon multiPolygon = { { firstPolygon, secondPolygon } } ;
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 5) ;
+
+        points.col(0) << 0.5, 0.5 ;
+        points.col(1) << 1.5, 0.5 ;
+        points.col(2) << 2.5, 0.5 ;
+        points.col(3) << 3.0, 1.0 ;
+        points.col(4) << 2.5, 1.5 ;
+
+        VectorXb expectedMask = VectorXb::Zero(5) ;
+
+        expectedMask << true, false, true, true, false ;
+
+        EXPECT_EQ(expectedMask, multiPolygon.containsPoints(points)) ;
+
+        EXPECT_EQ(0, multiPolygon.containsPoints(Matrix2Xd::Zero(2, 0)).size()) ;
+
+        // Polygons are reused across calls, and shared with copies
+
+        EXPECT_EQ(expectedMask, multiPolygon.containsPoints(points)) ;
+
+        const MultiPolygon multiPolygonCopy = multiPolygon ;
+
+        EXPECT_EQ(expectedMask, multiPolygonCopy.containsPoints(points)) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().containsPoints(Matrix2Xd::Zero(2, 1))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, BuildIndex)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXb ;
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        // Checkerboard of 50 unit squares, above the indexing threshold
+
+        Array<Polygon> squares = Array<Polygon>::Empty() ;
+
+        for (int rowIndex = 0; rowIndex < 10; ++rowIndex)
+        {
+
+            for (int columnIndex = (rowIndex % 2); columnIndex < 10; columnIndex += 2)
+            {
+                squares.add(Polygon { { { columnIndex + 0.0, rowIndex + 0.0 }, { columnIndex + 0.0, rowIndex + 1.0 }, { columnIndex + 1.0, rowIndex + 1.0 }, { columnIndex + 1.0, rowIndex + 0.0 } } }) ;
+            }
+
+        }
+
+        const MultiPolygon multiPolygon = { squares } ;
+
+        EXPECT_NO_THROW(multiPolygon.buildIndex()) ;
+
+        const MultiPolygon multiPolygonCopy = multiPolygon ;
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 400) ;
+
+        for (int pointIndex = 0; pointIndex < 400; ++pointIndex)
+        {
+            points.col(pointIndex) << (pointIndex % 20) * 0.5 + 0.25, (pointIndex / 20) * 0.5 + 0.25 ;
+        }
+
+        const VectorXb mask = multiPolygonCopy.containsPoints(points) ;
+
+        for (int pointIndex = 0; pointIndex < 400; ++pointIndex)
+        {
+
+            const int columnIndex = static_cast<int>(points(0, pointIndex)) ;
+            const int rowIndex = static_cast<int>(points(1, pointIndex)) ;
+
+            const bool isContained = ((columnIndex + rowIndex) % 2) == 0 ;
+
+            EXPECT_EQ(isContained, mask(pointIndex)) ;
+            EXPECT_EQ(isContained, multiPolygonCopy.contains(Point(points(0, pointIndex), points(1, pointIndex)))) ;
+
+        }
+
+        EXPECT_TRUE(multiPolygon.contains({ 1.0, 1.0 })) ;
+        EXPECT_TRUE(multiPolygon.contains({ 10.0, 10.0 })) ;
+        EXPECT_FALSE(multiPolygon.contains({ 10.5, 10.0 })) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().buildIndex()) ;
+
+    }
+
+}
+
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, GetInnerRingCount)
 // {
 
@@ -1164,6 +1284,182 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, GetConvexHu
 
 // // }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, IntersectionWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const MultiPolygon firstMultiPolygon = { { Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } }, Polygon { { { 2.0, 0.0 }, { 2.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } } } } ;
+        const MultiPolygon secondMultiPolygon = MultiPolygon::Polygon(Polygon { { { 0.5, 0.0 }, { 0.5, 1.0 }, { 2.5, 1.0 }, { 2.5, 0.0 } } }) ;
+
+        const MultiPolygon intersectionMultiPolygon = firstMultiPolygon.intersectionWith(secondMultiPolygon) ;
+
+        EXPECT_EQ(2, intersectionMultiPolygon.getPolygonCount()) ;
+
+        EXPECT_TRUE(intersectionMultiPolygon.contains({ 0.75, 0.5 })) ;
+        EXPECT_TRUE(intersectionMultiPolygon.contains({ 2.25, 0.5 })) ;
+        EXPECT_FALSE(intersectionMultiPolygon.contains({ 0.25, 0.5 })) ;
+        EXPECT_FALSE(intersectionMultiPolygon.contains({ 1.5, 0.5 })) ;
+
+        EXPECT_FALSE(firstMultiPolygon.intersectionWith(MultiPolygon::Polygon(Polygon { { { 5.0, 5.0 }, { 5.0, 6.0 }, { 6.0, 6.0 } } })).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().intersectionWith(MultiPolygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, DifferenceWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const MultiPolygon firstMultiPolygon = { { Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } }, Polygon { { { 2.0, 0.0 }, { 2.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } } } } ;
+        const MultiPolygon secondMultiPolygon = MultiPolygon::Polygon(Polygon { { { 0.5, 0.0 }, { 0.5, 1.0 }, { 2.5, 1.0 }, { 2.5, 0.0 } } }) ;
+
+        const MultiPolygon differenceMultiPolygon = firstMultiPolygon.differenceWith(secondMultiPolygon) ;
+
+        EXPECT_EQ(2, differenceMultiPolygon.getPolygonCount()) ;
+
+        EXPECT_TRUE(differenceMultiPolygon.contains({ 0.25, 0.5 })) ;
+        EXPECT_TRUE(differenceMultiPolygon.contains({ 2.75, 0.5 })) ;
+        EXPECT_FALSE(differenceMultiPolygon.contains({ 0.75, 0.5 })) ;
+
+        EXPECT_FALSE(firstMultiPolygon.differenceWith(firstMultiPolygon).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().differenceWith(MultiPolygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, SymmetricDifferenceWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const MultiPolygon firstMultiPolygon = MultiPolygon::Polygon(Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 2.0, 1.0 }, { 2.0, 0.0 } } }) ;
+        const MultiPolygon secondMultiPolygon = MultiPolygon::Polygon(Polygon { { { 1.0, 0.0 }, { 1.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } }) ;
+
+        const MultiPolygon symmetricDifferenceMultiPolygon = firstMultiPolygon.symmetricDifferenceWith(secondMultiPolygon) ;
+
+        EXPECT_EQ(2, symmetricDifferenceMultiPolygon.getPolygonCount()) ;
+        EXPECT_EQ(symmetricDifferenceMultiPolygon, secondMultiPolygon.symmetricDifferenceWith(firstMultiPolygon)) ;
+
+        EXPECT_TRUE(symmetricDifferenceMultiPolygon.contains({ 0.5, 0.5 })) ;
+        EXPECT_TRUE(symmetricDifferenceMultiPolygon.contains({ 2.5, 0.5 })) ;
+        EXPECT_FALSE(symmetricDifferenceMultiPolygon.contains({ 1.5, 0.5 })) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().symmetricDifferenceWith(MultiPolygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, Clip)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        // Area of interest made of two squares, with a hole in the first one
+
+        const Polygon firstSquare = { { { 0.0, 0.0 }, { 0.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 0.0 } }, { { { 1.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 3.0 }, { 1.0, 3.0 } } } } ;
+        const Polygon secondSquare = { { { 10.0, 0.0 }, { 10.0, 4.0 }, { 14.0, 4.0 }, { 14.0, 0.0 } } } ;
+
+        const MultiPolygon areaOfInterest = { { firstSquare, secondSquare } } ;
+
+        Array<Polygon> footprints = Array<Polygon>::Empty() ;
+
+        for (int index = 0; index < 40; ++index)
+        {
+
+            const double x = -2.0 + 0.5 * index ;
+
+            footprints.add(Polygon { { { x, -1.0 }, { x, 5.0 }, { x + 1.5, 5.0 }, { x + 1.5, -1.0 } } }) ;
+
+        }
+
+        const Array<MultiPolygon> clippedFootprints = areaOfInterest.clip(footprints) ;
+
+        ASSERT_EQ(footprints.getSize(), clippedFootprints.getSize()) ;
+
+        // Boolean operations round intersection vertices relative to the extent of their inputs: compare coverage over a grid
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 170 * 65) ;
+
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            points.col(pointIndex) << -2.0 + 0.1 * (pointIndex % 170) + 0.0123, -1.0 + 0.1 * (pointIndex / 170) + 0.0271 ;
+        }
+
+        for (Index index = 0; index < footprints.getSize(); ++index)
+        {
+
+            const MultiPolygon referenceMultiPolygon = MultiPolygon::Polygon(footprints[index]).intersectionWith(areaOfInterest) ;
+
+            ASSERT_EQ(referenceMultiPolygon.isDefined(), clippedFootprints[index].isDefined()) ;
+
+            if (referenceMultiPolygon.isDefined())
+            {
+
+                EXPECT_EQ(referenceMultiPolygon.getPolygonCount(), clippedFootprints[index].getPolygonCount()) ;
+                EXPECT_EQ(referenceMultiPolygon.containsPoints(points), clippedFootprints[index].containsPoints(points)) ;
+
+            }
+
+        }
+
+        // Footprints between the squares fall outside of the area of interest
+
+        EXPECT_FALSE(clippedFootprints[20].isDefined()) ;
+
+        // Footprints across the hole are split in two
+
+        EXPECT_EQ(2, clippedFootprints[6].getPolygonCount()) ;
+
+    }
+
+    {
+
+        const MultiPolygon areaOfInterest = MultiPolygon::Polygon(Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } }) ;
+
+        EXPECT_TRUE(areaOfInterest.clip(Array<Polygon>::Empty()).isEmpty()) ;
+
+        EXPECT_ANY_THROW(areaOfInterest.clip({ Polygon::Undefined() })) ;
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().clip(Array<Polygon>::Empty())) ;
+
+    }
+
+}
+
 // // TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, UnionWith)
 // // {
 
@@ -1177,6 +1473,55 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, GetConvexHu
 
 // // }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, Simplify)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::LineString ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        // Two densely sampled squares, next to each other
+
+        const auto square = [] (const double anOffset) -> Polygon
+        {
+
+            Array<Point> vertices = Array<Point>::Empty() ;
+
+            for (int index = 0; index < 50; ++index) { vertices.add(Point(anOffset + 0.02 * index, 0.0)) ; }
+            for (int index = 0; index < 50; ++index) { vertices.add(Point(anOffset + 1.0, 0.02 * index)) ; }
+            for (int index = 0; index < 50; ++index) { vertices.add(Point(anOffset + 1.0 - 0.02 * index, 1.0)) ; }
+            for (int index = 0; index < 50; ++index) { vertices.add(Point(anOffset, 1.0 - 0.02 * index)) ; }
+
+            return { vertices } ;
+
+        } ;
+
+        const MultiPolygon multiPolygon = { { square(0.0), square(2.0) } } ;
+
+        const MultiPolygon simplifiedMultiPolygon = multiPolygon.simplify(1e-6, LineString::SimplificationMethod::Visvalingam, true) ;
+
+        ASSERT_EQ(2, simplifiedMultiPolygon.getPolygonCount()) ;
+
+        EXPECT_EQ(4, simplifiedMultiPolygon.getPolygons()[0].getVertexCount()) ;
+        EXPECT_EQ(4, simplifiedMultiPolygon.getPolygons()[1].getVertexCount()) ;
+
+        EXPECT_EQ(multiPolygon, simplifiedMultiPolygon) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(MultiPolygon::Undefined().simplify(1.0)) ;
+
+    }
+
+}
+
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, ToString)
 // {
 
@@ -1343,4 +1688,110 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, Polygon)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_MultiPolygon, Union)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        // Overlapping squares of side 1.5, on a unit grid, merge into a single square
+
+        Array<Polygon> squares = Array<Polygon>::Empty() ;
+
+        for (int rowIndex = 0; rowIndex < 8; ++rowIndex)
+        {
+
+            for (int columnIndex = 0; columnIndex < 8; ++columnIndex)
+            {
+                squares.add(Polygon { { { columnIndex + 0.0, rowIndex + 0.0 }, { columnIndex + 0.0, rowIndex + 1.5 }, { columnIndex + 1.5, rowIndex + 1.5 }, { columnIndex + 1.5, rowIndex + 0.0 } } }) ;
+            }
+
+        }
+
+        const MultiPolygon multiPolygon = MultiPolygon::Union(squares) ;
+
+        EXPECT_TRUE(multiPolygon.isDefined()) ;
+        EXPECT_EQ(1, multiPolygon.getPolygonCount()) ;
+
+        EXPECT_EQ(MultiPolygon::Polygon(Polygon { { { 0.0, 0.0 }, { 0.0, 8.5 }, { 8.5, 8.5 }, { 8.5, 0.0 } } }), multiPolygon) ;
+
+    }
+
+    {
+
+        // Disjoint squares stay apart
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 2.0, 0.0 }, { 2.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } } ;
+
+        const MultiPolygon multiPolygon = MultiPolygon::Union({ firstPolygon, secondPolygon }) ;
+
+        EXPECT_EQ(2, multiPolygon.getPolygonCount()) ;
+        EXPECT_TRUE(multiPolygon.contains({ 0.5, 0.5 })) ;
+        EXPECT_TRUE(multiPolygon.contains({ 2.5, 0.5 })) ;
+        EXPECT_FALSE(multiPolygon.contains({ 1.5, 0.5 })) ;
+
+        EXPECT_EQ(MultiPolygon::Polygon(firstPolygon), MultiPolygon::Union({ firstPolygon })) ;
+
+    }
+
+    {
+
+        // Ring of overlapping diamonds, merged through the cascaded union, matches successive pairwise unions
+
+        Array<Polygon> diamonds = Array<Polygon>::Empty() ;
+
+        for (int index = 0; index < 300; ++index)
+        {
+
+            const double angle = 2.0 * M_PI * index / 300.0 ;
+            const double x = 20.0 * std::cos(angle) ;
+            const double y = 20.0 * std::sin(angle) ;
+
+            diamonds.add(Polygon { { { x - 0.5, y }, { x, y + 0.5 }, { x + 0.5, y }, { x, y - 0.5 } } }) ;
+
+        }
+
+        MultiPolygon referenceMultiPolygon = MultiPolygon::Polygon(diamonds.accessFirst()) ;
+
+        for (const auto& diamond : diamonds)
+        {
+            referenceMultiPolygon = referenceMultiPolygon.unionWith(MultiPolygon::Polygon(diamond)) ;
+        }
+
+        const MultiPolygon multiPolygon = MultiPolygon::Union(diamonds) ;
+
+        EXPECT_EQ(1, multiPolygon.getPolygonCount()) ;
+
+        // Intersection vertices depend on the merge order, down to rounding: compare coverage over a grid instead
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 200 * 200) ;
+
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            points.col(pointIndex) << -21.0 + 0.21 * (pointIndex % 200) + 0.0123, -21.0 + 0.21 * (pointIndex / 200) + 0.0271 ;
+        }
+
+        EXPECT_EQ(referenceMultiPolygon.containsPoints(points), multiPolygon.containsPoints(points)) ;
+
+        EXPECT_TRUE(multiPolygon.contains({ 20.0, 0.0 })) ;
+        EXPECT_FALSE(multiPolygon.contains({ 0.0, 0.0 })) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(MultiPolygon::Union(Array<Polygon>::Empty()).isDefined()) ;
+
+        EXPECT_ANY_THROW(MultiPolygon::Union({ Polygon::Undefined() })) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -509,31 +509,281 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, IntersectsPolygo
 
 }
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ContainsPoint)
-// {
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ContainsPoint)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    {
+
+        const Array<Point> outerRing =
+        {
+            { 0.0, 0.0 },
+            { 0.0, 4.0 },
+            { 4.0, 4.0 },
+            { 4.0, 0.0 }
+        } ;
+
+        const Array<Array<Point>> innerRings =
+        {
+            {
+                { 1.0, 1.0 },
+                { 1.0, 2.0 },
+                { 2.0, 2.0 },
+                { 2.0, 1.0 }
+            }
+        } ;
+
+        const Polygon polygon = { outerRing, innerRings } ;
+
+        EXPECT_TRUE(polygon.contains(Point(3.0, 3.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(0.5, 1.5))) ;
+
+        EXPECT_TRUE(polygon.contains(Point(0.0, 0.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(4.0, 2.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(1.0, 1.5))) ;
+
+        EXPECT_FALSE(polygon.contains(Point(1.5, 1.5))) ;
+        EXPECT_FALSE(polygon.contains(Point(5.0, 2.0))) ;
+        EXPECT_FALSE(polygon.contains(Point(-1.0, 0.0))) ;
+
+    }
+
+    {
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+
+        EXPECT_ANY_THROW(polygon.contains(Point::Undefined())) ;
+        EXPECT_ANY_THROW(Polygon::Undefined().contains(Point(0.5, 0.5))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ContainsPointSet)
+{
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::PointSet ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    {
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+
+        EXPECT_TRUE(polygon.contains(PointSet({ { 0.5, 0.5 }, { 0.0, 1.0 }, { 1.0, 0.5 } }))) ;
+        EXPECT_FALSE(polygon.contains(PointSet({ { 0.5, 0.5 }, { 1.5, 0.5 } }))) ;
+
+    }
+
+    {
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+
+        EXPECT_ANY_THROW(polygon.contains(PointSet::Empty())) ;
+        EXPECT_ANY_THROW(Polygon::Undefined().contains(PointSet({ { 0.5, 0.5 } }))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ContainsPoints)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXb ;
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    {
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 0.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 0.0 } }, { { { 1.0, 1.0 }, { 1.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 1.0 } } } } ;
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 6) ;
+
+        points.col(0) << 3.0, 3.0 ;
+        points.col(1) << 1.5, 1.5 ;
+        points.col(2) << 0.0, 0.0 ;
+        points.col(3) << 1.0, 1.5 ;
+        points.col(4) << 4.5, 1.0 ;
+        points.col(5) << 2.0, 4.0 ;
+
+        VectorXb expectedMask = VectorXb::Zero(6) ;
+
+        expectedMask << true, false, true, true, false, true ;
+
+        EXPECT_EQ(expectedMask, polygon.containsPoints(points)) ;
+
+        EXPECT_EQ(VectorXb::Zero(1), polygon.containsPoints(Matrix2Xd::Constant(2, 1, 10.0))) ;
+        EXPECT_EQ(0, polygon.containsPoints(Matrix2Xd::Zero(2, 0)).size()) ;
+
+    }
 
-//     using ostk::math::geom::d2::objects::Polygon ;
+    {
+
+        // Grid of points over a star-shaped polygon with a hole, checked against single point tests on a polygon small enough
+        // to be tested linearly
+
+        Array<Point> outerRing = Array<Point>::Empty() ;
+        Array<Point> innerRing = Array<Point>::Empty() ;
+
+        for (int vertexIndex = 0; vertexIndex < 50; ++vertexIndex)
+        {
+
+            const double angle = 2.0 * M_PI * vertexIndex / 50.0 ;
+            const double radius = (vertexIndex % 2 == 0) ? 10.0 : 6.0 ;
+
+            outerRing.add(Point(radius * std::cos(angle), radius * std::sin(angle))) ;
+
+        }
+
+        for (int vertexIndex = 0; vertexIndex < 10; ++vertexIndex)
+        {
+
+            const double angle = 2.0 * M_PI * vertexIndex / 10.0 ;
+
+            innerRing.add(Point(2.0 * std::cos(angle), 2.0 * std::sin(angle))) ;
+
+        }
+
+        const Polygon polygon = { outerRing, { innerRing } } ;
+        const Polygon referencePolygon = { outerRing, { innerRing } } ;
+
+        Matrix2Xd points = Matrix2Xd::Zero(2, 41 * 41) ;
 
-//     {
+        for (int xIndex = 0; xIndex < 41; ++xIndex)
+        {
 
-//         FAIL() ;
+            for (int yIndex = 0; yIndex < 41; ++yIndex)
+            {
+                points.col(xIndex * 41 + yIndex) << (xIndex - 20) * 0.6 + 1e-3, (yIndex - 20) * 0.6 + 1e-3 ;
+            }
 
-//     }
+        }
 
-// }
+        const VectorXb mask = polygon.containsPoints(points) ;
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ContainsPointSet)
-// {
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            EXPECT_EQ(referencePolygon.contains(Point(points(0, pointIndex), points(1, pointIndex))), mask(pointIndex)) << pointIndex ;
+        }
 
-//     using ostk::math::geom::d2::objects::Polygon ;
+        EXPECT_GT(mask.count(), 0) ;
+        EXPECT_LT(mask.count(), points.cols()) ;
 
-//     {
+    }
 
-//         FAIL() ;
+    {
 
-//     }
+        EXPECT_ANY_THROW(Polygon::Undefined().containsPoints(Matrix2Xd::Zero(2, 1))) ;
 
-// }
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, BuildIndex)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::PointSet ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::Transformation ;
+
+    {
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 0.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 0.0 } }, { { { 1.0, 1.0 }, { 1.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 1.0 } } } } ;
+
+        EXPECT_NO_THROW(polygon.buildIndex()) ;
+
+        EXPECT_TRUE(polygon.contains(Point(3.0, 3.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(0.0, 0.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(2.0, 4.0))) ;
+        EXPECT_TRUE(polygon.contains(Point(1.5, 2.0))) ;
+        EXPECT_FALSE(polygon.contains(Point(1.5, 1.5))) ;
+        EXPECT_FALSE(polygon.contains(Point(4.5, 1.0))) ;
+
+        EXPECT_TRUE(polygon.contains(PointSet({ { 0.5, 0.5 }, { 3.0, 1.5 } }))) ;
+        EXPECT_FALSE(polygon.contains(PointSet({ { 0.5, 0.5 }, { 1.5, 1.5 } }))) ;
+
+        const Polygon polygonCopy = polygon ;
+
+        EXPECT_FALSE(polygonCopy.contains(Point(1.5, 1.5))) ;
+
+        Polygon transformedPolygon = polygon ;
+
+        transformedPolygon.applyTransformation(Transformation::Translation({ 10.0, 0.0 })) ;
+
+        EXPECT_FALSE(transformedPolygon.contains(Point(3.0, 3.0))) ;
+        EXPECT_TRUE(transformedPolygon.contains(Point(13.0, 3.0))) ;
+
+    }
+
+    {
+
+        // Star-shaped polygon with a hole, small enough to be tested linearly unless indexed explicitly
+
+        Array<Point> outerRing = Array<Point>::Empty() ;
+        Array<Point> innerRing = Array<Point>::Empty() ;
+
+        for (int vertexIndex = 0; vertexIndex < 50; ++vertexIndex)
+        {
+
+            const double angle = 2.0 * M_PI * vertexIndex / 50.0 ;
+            const double radius = (vertexIndex % 2 == 0) ? 10.0 : 6.0 ;
+
+            outerRing.add(Point(radius * std::cos(angle), radius * std::sin(angle))) ;
+
+        }
+
+        for (int vertexIndex = 0; vertexIndex < 10; ++vertexIndex)
+        {
+
+            const double angle = 2.0 * M_PI * vertexIndex / 10.0 ;
+
+            innerRing.add(Point(2.0 * std::cos(angle), 2.0 * std::sin(angle))) ;
+
+        }
+
+        const Polygon polygon = { outerRing, { innerRing } } ;
+        const Polygon indexedPolygon = { outerRing, { innerRing } } ;
+
+        indexedPolygon.buildIndex() ;
+
+        for (int xIndex = -120; xIndex <= 120; xIndex += 3)
+        {
+
+            for (int yIndex = -120; yIndex <= 120; yIndex += 7)
+            {
+
+                const Point point = { xIndex / 10.0 + 1e-3, yIndex / 10.0 + 1e-3 } ;
+
+                EXPECT_EQ(polygon.contains(point), indexedPolygon.contains(point)) << point.toString() ;
+
+            }
+
+        }
+
+        for (const auto& vertex : outerRing)
+        {
+            EXPECT_TRUE(indexedPolygon.contains(vertex)) << vertex.toString() ;
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().buildIndex()) ;
+
+    }
+
+}
 
 TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, GetInnerRingCount)
 {
@@ -1126,18 +1376,59 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, GetConvexHull)
 
 }
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, IntersectionWith)
-// {
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, IntersectionWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 1.0, 1.0 }, { 1.0, 3.0 }, { 3.0, 3.0 }, { 3.0, 1.0 } } } ;
+
+        const MultiPolygon intersectionMultiPolygon = firstPolygon.intersectionWith(secondPolygon) ;
+
+        EXPECT_EQ(MultiPolygon::Polygon(Polygon { { { 1.0, 1.0 }, { 1.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 1.0 } } }), intersectionMultiPolygon) ;
+
+        EXPECT_EQ(MultiPolygon::Polygon(firstPolygon), firstPolygon.intersectionWith(firstPolygon)) ;
+
+    }
+
+    {
 
-//     using ostk::math::geom::d2::objects::Polygon ;
+        // Concave polygon clipped into two parts
 
-//     {
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 3.0 }, { 1.0, 3.0 }, { 1.0, 1.0 }, { 2.0, 1.0 }, { 2.0, 3.0 }, { 3.0, 3.0 }, { 3.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { -1.0, 2.0 }, { -1.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 2.0 } } } ;
 
-//         FAIL() ;
+        const MultiPolygon intersectionMultiPolygon = firstPolygon.intersectionWith(secondPolygon) ;
 
-//     }
+        EXPECT_EQ(2, intersectionMultiPolygon.getPolygonCount()) ;
 
-// }
+        EXPECT_TRUE(intersectionMultiPolygon.contains({ 0.5, 2.5 })) ;
+        EXPECT_TRUE(intersectionMultiPolygon.contains({ 2.5, 2.5 })) ;
+        EXPECT_FALSE(intersectionMultiPolygon.contains({ 1.5, 2.5 })) ;
+        EXPECT_FALSE(intersectionMultiPolygon.contains({ 0.5, 0.5 })) ;
+
+    }
+
+    {
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 1.0 }, { 1.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 2.0, 0.0 }, { 2.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 0.0 } } } ;
+
+        EXPECT_FALSE(firstPolygon.intersectionWith(secondPolygon).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().intersectionWith(Polygon::Undefined())) ;
+
+    }
+
+}
 
 TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, UnionWith)
 {
@@ -1389,6 +1680,140 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, UnionWith)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, DifferenceWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 1.0, 0.0 }, { 1.0, 2.0 }, { 3.0, 2.0 }, { 3.0, 0.0 } } } ;
+
+        const MultiPolygon differenceMultiPolygon = firstPolygon.differenceWith(secondPolygon) ;
+
+        EXPECT_EQ(MultiPolygon::Polygon(Polygon { { { 0.0, 0.0 }, { 0.0, 2.0 }, { 1.0, 2.0 }, { 1.0, 0.0 } } }), differenceMultiPolygon) ;
+
+    }
+
+    {
+
+        // Hole punched through polygon
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 3.0 }, { 3.0, 3.0 }, { 3.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 1.0, 1.0 }, { 1.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 1.0 } } } ;
+
+        const MultiPolygon differenceMultiPolygon = firstPolygon.differenceWith(secondPolygon) ;
+
+        ASSERT_EQ(1, differenceMultiPolygon.getPolygonCount()) ;
+        EXPECT_EQ(1, differenceMultiPolygon.getPolygons().accessFirst().getInnerRingCount()) ;
+
+        EXPECT_TRUE(differenceMultiPolygon.contains({ 0.5, 0.5 })) ;
+        EXPECT_FALSE(differenceMultiPolygon.contains({ 1.5, 1.5 })) ;
+
+        EXPECT_FALSE(secondPolygon.differenceWith(firstPolygon).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().differenceWith(Polygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, SymmetricDifferenceWith)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+
+    {
+
+        const Polygon firstPolygon = { { { 0.0, 0.0 }, { 0.0, 2.0 }, { 2.0, 2.0 }, { 2.0, 0.0 } } } ;
+        const Polygon secondPolygon = { { { 1.0, 0.0 }, { 1.0, 2.0 }, { 3.0, 2.0 }, { 3.0, 0.0 } } } ;
+
+        const MultiPolygon symmetricDifferenceMultiPolygon = firstPolygon.symmetricDifferenceWith(secondPolygon) ;
+
+        EXPECT_EQ(2, symmetricDifferenceMultiPolygon.getPolygonCount()) ;
+
+        EXPECT_TRUE(symmetricDifferenceMultiPolygon.contains({ 0.5, 1.0 })) ;
+        EXPECT_TRUE(symmetricDifferenceMultiPolygon.contains({ 2.5, 1.0 })) ;
+        EXPECT_FALSE(symmetricDifferenceMultiPolygon.contains({ 1.5, 1.0 })) ;
+
+        EXPECT_FALSE(firstPolygon.symmetricDifferenceWith(firstPolygon).isDefined()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().symmetricDifferenceWith(Polygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, Simplify)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::LineString ;
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    {
+
+        // Densely sampled square, with a square hole
+
+        Array<Point> vertices = Array<Point>::Empty() ;
+
+        for (int index = 0; index < 100; ++index) { vertices.add(Point(0.04 * index, 0.0)) ; }
+        for (int index = 0; index < 100; ++index) { vertices.add(Point(4.0, 0.04 * index)) ; }
+        for (int index = 0; index < 100; ++index) { vertices.add(Point(4.0 - 0.04 * index, 4.0)) ; }
+        for (int index = 0; index < 100; ++index) { vertices.add(Point(0.0, 4.0 - 0.04 * index)) ; }
+
+        const Polygon polygon = { vertices, { { { 1.0, 1.0 }, { 2.0, 1.0 }, { 2.0, 1.5 }, { 2.0, 2.0 }, { 1.0, 2.0 } } } } ;
+
+        for (const auto& method : { LineString::SimplificationMethod::DouglasPeucker, LineString::SimplificationMethod::Visvalingam })
+        {
+
+            const Polygon simplifiedPolygon = polygon.simplify(1e-6, method) ;
+
+            EXPECT_EQ(8, simplifiedPolygon.getVertexCount()) ;
+            EXPECT_EQ(1, simplifiedPolygon.getInnerRingCount()) ;
+
+            EXPECT_TRUE(simplifiedPolygon.contains(Point(0.5, 0.5))) ;
+            EXPECT_FALSE(simplifiedPolygon.contains(Point(1.5, 1.5))) ;
+
+        }
+
+    }
+
+    {
+
+        // Outer ring bump holding the hole: removing its tip would leave the hole out of the polygon
+
+        const Polygon polygon = { { { 0.0, 0.0 }, { 10.0, 0.0 }, { 10.0, 10.0 }, { 5.0, 11.0 }, { 0.0, 10.0 } }, { { { 4.8, 10.3 }, { 5.0, 10.6 }, { 5.2, 10.3 } } } } ;
+
+        EXPECT_EQ(4, polygon.simplify(2.0).getOuterRing().getPointCount() - 1) ;
+        EXPECT_EQ(5, polygon.simplify(2.0, LineString::SimplificationMethod::DouglasPeucker, true).getOuterRing().getPointCount() - 1) ;
+        EXPECT_EQ(5, polygon.simplify(2.0, LineString::SimplificationMethod::Visvalingam, true).getOuterRing().getPointCount() - 1) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().simplify(1.0)) ;
+        EXPECT_ANY_THROW(Polygon({ { 0.0, 0.0 }, { 1.0, 0.0 }, { 0.0, 1.0 } }).simplify(Real::Undefined())) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_Objects_Polygon, ToString)
 {
 
@@ -0,0 +1,462 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/PolygonIndex.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/MultiPolygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+// Unit square cells of a grid, row by row: cell (i, j) has index i + j * aColumnCount
+
+ostk::core::ctnr::Array<ostk::math::geom::d2::objects::Polygon> Grid   (   const   std::size_t                 aColumnCount,
+                                                                                const   std::size_t                 aRowCount                                   )
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+
+    Array<Polygon> cells = Array<Polygon>::Empty() ;
+
+    for (std::size_t rowIndex = 0; rowIndex < aRowCount; ++rowIndex)
+    {
+
+        for (std::size_t columnIndex = 0; columnIndex < aColumnCount; ++columnIndex)
+        {
+
+            const double x = static_cast<double>(columnIndex) ;
+            const double y = static_cast<double>(rowIndex) ;
+
+            cells.add(Polygon { { { x, y }, { x, y + 1.0 }, { x + 1.0, y + 1.0 }, { x + 1.0, y } } }) ;
+
+        }
+
+    }
+
+    return cells ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, Constructor)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::objects::MultiPolygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        EXPECT_NO_THROW(PolygonIndex polygonIndex(Grid(3, 2)) ;) ;
+
+        EXPECT_EQ(6, PolygonIndex(Grid(3, 2)).getPolygonCount()) ;
+
+    }
+
+    {
+
+        const MultiPolygon multiPolygon = { Grid(2, 1) } ;
+
+        EXPECT_EQ(2, PolygonIndex(multiPolygon).getPolygonCount()) ;
+
+        EXPECT_EQ(0, PolygonIndex(MultiPolygon::Undefined()).getPolygonCount()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PolygonIndex polygonIndex(Array<Polygon> { Polygon::Undefined() }) ;) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, CopyConstructor)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        PolygonIndex polygonIndex = PolygonIndex(Grid(2, 2)) ;
+
+        const PolygonIndex polygonIndexCopy = polygonIndex ;
+
+        polygonIndex.addPolygon(Polygon { { { 10.0, 10.0 }, { 10.0, 11.0 }, { 11.0, 11.0 }, { 11.0, 10.0 } } }) ;
+
+        EXPECT_EQ(4, polygonIndexCopy.getPolygonCount()) ;
+        EXPECT_TRUE(polygonIndexCopy.contains({ 1.5, 1.5 })) ;
+        EXPECT_FALSE(polygonIndexCopy.contains({ 10.5, 10.5 })) ;
+
+        EXPECT_TRUE(polygonIndex.contains({ 10.5, 10.5 })) ;
+
+    }
+
+    {
+
+        PolygonIndex polygonIndex = PolygonIndex(Grid(2, 2)) ;
+
+        const PolygonIndex movedPolygonIndex = std::move(polygonIndex) ;
+
+        EXPECT_EQ(4, movedPolygonIndex.getPolygonCount()) ;
+        EXPECT_TRUE(movedPolygonIndex.contains({ 1.5, 1.5 })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, IsEmpty)
+{
+
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        EXPECT_FALSE(PolygonIndex(Grid(1, 1)).isEmpty()) ;
+
+        EXPECT_TRUE(PolygonIndex::Empty().isEmpty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, Contains)
+{
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(4, 3)) ;
+
+        EXPECT_TRUE(polygonIndex.contains({ 0.5, 0.5 })) ;
+        EXPECT_TRUE(polygonIndex.contains({ 3.5, 2.5 })) ;
+        EXPECT_TRUE(polygonIndex.contains({ 4.0, 3.0 })) ;
+
+        EXPECT_FALSE(polygonIndex.contains({ -0.5, 0.5 })) ;
+        EXPECT_FALSE(polygonIndex.contains({ 4.5, 2.5 })) ;
+
+    }
+
+    {
+
+        // Triangle, whose bounding box holds points outside of it
+
+        const PolygonIndex polygonIndex = PolygonIndex({ Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 0.0 } } } }) ;
+
+        EXPECT_TRUE(polygonIndex.contains({ 0.25, 0.25 })) ;
+        EXPECT_FALSE(polygonIndex.contains({ 0.75, 0.75 })) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(PolygonIndex::Empty().contains({ 0.0, 0.0 })) ;
+
+        EXPECT_ANY_THROW(PolygonIndex(Grid(1, 1)).contains(Point::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, ContainsPoints)
+{
+
+    using ostk::math::obj::VectorXb ;
+    using ostk::math::obj::Matrix2Xd ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(4, 3)) ;
+
+        Matrix2Xd points(2, 6) ;
+
+        points.col(0) << 0.5, 0.5 ;
+        points.col(1) << 3.5, 2.5 ;
+        points.col(2) << 4.0, 3.0 ;
+        points.col(3) << 1.0, 1.0 ;
+        points.col(4) << -0.5, 0.5 ;
+        points.col(5) << 4.5, 2.5 ;
+
+        const VectorXb mask = polygonIndex.containsPoints(points) ;
+
+        ASSERT_EQ(6, mask.size()) ;
+
+        for (Eigen::Index pointIndex = 0; pointIndex < points.cols(); ++pointIndex)
+        {
+            EXPECT_EQ(polygonIndex.contains({ points(0, pointIndex), points(1, pointIndex) }), mask(pointIndex)) ;
+        }
+
+        EXPECT_TRUE(mask(0)) ;
+        EXPECT_TRUE(mask(3)) ;
+        EXPECT_FALSE(mask(4)) ;
+
+    }
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex({ Polygon { { { 0.0, 0.0 }, { 0.0, 1.0 }, { 1.0, 0.0 } } } }) ;
+
+        Matrix2Xd points(2, 2) ;
+
+        points.col(0) << 0.25, 0.25 ;
+        points.col(1) << 0.75, 0.75 ;
+
+        const VectorXb mask = polygonIndex.containsPoints(points) ;
+
+        EXPECT_TRUE(mask(0)) ;
+        EXPECT_FALSE(mask(1)) ;
+
+    }
+
+    {
+
+        EXPECT_EQ(0, PolygonIndex::Empty().containsPoints(Matrix2Xd(2, 0)).size()) ;
+        EXPECT_FALSE(PolygonIndex::Empty().containsPoints(Matrix2Xd::Zero(2, 1))(0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, AccessPolygonAt)
+{
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(2, 1)) ;
+
+        EXPECT_EQ(Grid(2, 1).at(1), polygonIndex.accessPolygonAt(1)) ;
+
+        EXPECT_ANY_THROW(polygonIndex.accessPolygonAt(2)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, GetPolygonCount)
+{
+
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        EXPECT_EQ(12, PolygonIndex(Grid(4, 3)).getPolygonCount()) ;
+
+        EXPECT_EQ(0, PolygonIndex::Empty().getPolygonCount()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, GetPolygonIndicesContaining)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(4, 3)) ;
+
+        EXPECT_EQ(Array<Index>({ 5 }), polygonIndex.getPolygonIndicesContaining({ 1.5, 1.5 })) ;
+        EXPECT_EQ(Array<Index>({ 4, 5 }), polygonIndex.getPolygonIndicesContaining({ 1.0, 1.5 })) ;
+        EXPECT_EQ(Array<Index>({ 0, 1, 4, 5 }), polygonIndex.getPolygonIndicesContaining({ 1.0, 1.0 })) ;
+
+        EXPECT_TRUE(polygonIndex.getPolygonIndicesContaining({ 10.0, 10.0 }).isEmpty()) ;
+
+    }
+
+    {
+
+        // Nested polygons, and a polygon with a hole
+
+        const Polygon square = { { { 0.0, 0.0 }, { 0.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 0.0 } } } ;
+        const Polygon innerSquare = { { { 1.0, 1.0 }, { 1.0, 3.0 }, { 3.0, 3.0 }, { 3.0, 1.0 } } } ;
+        const Polygon frame = { { { 0.0, 0.0 }, { 0.0, 4.0 }, { 4.0, 4.0 }, { 4.0, 0.0 } }, { { { 1.0, 1.0 }, { 3.0, 1.0 }, { 3.0, 3.0 }, { 1.0, 3.0 } } } } ;
+
+        const PolygonIndex polygonIndex = PolygonIndex({ square, innerSquare, frame }) ;
+
+        EXPECT_EQ(Array<Index>({ 0, 1 }), polygonIndex.getPolygonIndicesContaining({ 2.0, 2.0 })) ;
+        EXPECT_EQ(Array<Index>({ 0, 2 }), polygonIndex.getPolygonIndicesContaining({ 0.5, 0.5 })) ;
+        EXPECT_EQ(Array<Index>({ 0, 1, 2 }), polygonIndex.getPolygonIndicesContaining({ 1.0, 2.0 })) ;
+
+    }
+
+    {
+
+        // Every cell of a large grid is found from its center
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(40, 25)) ;
+
+        for (Index cellIndex = 0; cellIndex < polygonIndex.getPolygonCount(); ++cellIndex)
+        {
+
+            const Point center = { (cellIndex % 40) + 0.5, (cellIndex / 40) + 0.5 } ;
+
+            EXPECT_EQ(Array<Index>({ cellIndex }), polygonIndex.getPolygonIndicesContaining(center)) ;
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PolygonIndex(Grid(1, 1)).getPolygonIndicesContaining(Point::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, GetPolygonIndicesOverlappingBox)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Point ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(4, 3)) ;
+
+        EXPECT_EQ(Array<Index>({ 5, 6, 9, 10 }), polygonIndex.getPolygonIndicesOverlappingBox({ 1.5, 1.5 }, { 2.5, 2.5 })) ;
+        EXPECT_EQ(Array<Index>({ 0 }), polygonIndex.getPolygonIndicesOverlappingBox({ 0.25, 0.25 }, { 0.75, 0.75 })) ;
+        EXPECT_EQ(Array<Index>({ 0, 1 }), polygonIndex.getPolygonIndicesOverlappingBox({ 0.5, 0.25 }, { 1.0, 0.75 })) ;
+
+        EXPECT_TRUE(polygonIndex.getPolygonIndicesOverlappingBox({ 5.0, 5.0 }, { 6.0, 6.0 }).isEmpty()) ;
+
+    }
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(1, 1)) ;
+
+        EXPECT_ANY_THROW(polygonIndex.getPolygonIndicesOverlappingBox(Point::Undefined(), { 1.0, 1.0 })) ;
+        EXPECT_ANY_THROW(polygonIndex.getPolygonIndicesOverlappingBox({ 0.0, 0.0 }, Point::Undefined())) ;
+        EXPECT_ANY_THROW(polygonIndex.getPolygonIndicesOverlappingBox({ 1.0, 0.0 }, { 0.0, 1.0 })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, GetPolygonIndicesOverlapping)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        const PolygonIndex polygonIndex = PolygonIndex(Grid(4, 3)) ;
+
+        const Polygon triangle = { { { 0.5, 0.5 }, { 1.5, 1.5 }, { 1.5, 0.5 } } } ;
+
+        EXPECT_EQ(Array<Index>({ 0, 1, 4, 5 }), polygonIndex.getPolygonIndicesOverlapping(triangle)) ;
+
+        EXPECT_ANY_THROW(polygonIndex.getPolygonIndicesOverlapping(Polygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, AddPolygon)
+{
+
+    using ostk::core::types::Index ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        PolygonIndex polygonIndex = PolygonIndex::Empty() ;
+
+        const Array<Polygon> cells = Grid(10, 10) ;
+
+        for (Index cellIndex = 0; cellIndex < cells.getSize(); ++cellIndex)
+        {
+            EXPECT_EQ(cellIndex, polygonIndex.addPolygon(cells[cellIndex])) ;
+        }
+
+        EXPECT_EQ(100, polygonIndex.getPolygonCount()) ;
+
+        EXPECT_EQ(Array<Index>({ 55 }), polygonIndex.getPolygonIndicesContaining({ 5.5, 5.5 })) ;
+        EXPECT_EQ(Array<Index>({ 0, 1, 10, 11 }), polygonIndex.getPolygonIndicesContaining({ 1.0, 1.0 })) ;
+
+        EXPECT_ANY_THROW(polygonIndex.addPolygon(Polygon::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, Print)
+{
+
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        testing::internal::CaptureStdout() ;
+
+        EXPECT_NO_THROW(PolygonIndex(Grid(2, 1)).print(std::cout, true)) ;
+        EXPECT_NO_THROW(PolygonIndex::Empty().print(std::cout, false)) ;
+        EXPECT_NO_THROW(std::cout << PolygonIndex(Grid(1, 1)) << std::endl) ;
+
+        EXPECT_FALSE(testing::internal::GetCapturedStdout().empty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_2D_PolygonIndex, Empty)
+{
+
+    using ostk::math::geom::d2::PolygonIndex ;
+
+    {
+
+        EXPECT_NO_THROW(PolygonIndex::Empty()) ;
+
+        EXPECT_TRUE(PolygonIndex::Empty().isEmpty()) ;
+        EXPECT_TRUE(PolygonIndex::Empty().getPolygonIndicesContaining({ 0.0, 0.0 }).isEmpty()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,207 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Line.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, EqualToOperator)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        EXPECT_TRUE(Intersection::Empty() == Intersection::Empty()) ;
+        EXPECT_TRUE(Intersection::Point({ 1.0, 2.0, 3.0 }) == Intersection::Point({ 1.0, 2.0, 3.0 })) ;
+
+        EXPECT_TRUE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) == Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 })) ;
+        EXPECT_TRUE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) == Intersection::PointSet({ 4.0, 5.0, 6.0 }, { 1.0, 2.0, 3.0 })) ;
+        EXPECT_TRUE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) == Intersection::PointSet(PointSet({ Point(4.0, 5.0, 6.0), Point(1.0, 2.0, 3.0) }))) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(Intersection::Empty() == Intersection::Point({ 1.0, 2.0, 3.0 })) ;
+        EXPECT_FALSE(Intersection::Point({ 1.0, 2.0, 3.0 }) == Intersection::Point({ 1.0, 2.0, 4.0 })) ;
+        EXPECT_FALSE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) == Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 7.0 })) ;
+
+        EXPECT_FALSE(Intersection::Undefined() == Intersection::Undefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, CopyConstructor)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        const Intersection intersection = Intersection::Segment(Segment({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })) ;
+
+        const Intersection intersectionCopy = intersection ;
+
+        EXPECT_TRUE(intersectionCopy.is<Segment>()) ;
+        EXPECT_EQ(Segment({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }), intersectionCopy.as<Segment>()) ;
+
+    }
+
+    {
+
+        Intersection intersection = Intersection::Point({ 1.0, 2.0, 3.0 }) ;
+
+        EXPECT_EQ(1, intersection.accessComposite().getObjectCount()) ;
+
+        intersection = Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) ;
+
+        EXPECT_EQ(Intersection::Type::PointSet, intersection.getType()) ;
+        EXPECT_EQ(2, intersection.as<ostk::math::geom::d3::objects::PointSet>().getSize()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, AdditionOperator)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        const Intersection intersection = Intersection::Point({ 1.0, 2.0, 3.0 }) + Intersection::Segment(Segment({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })) ;
+
+        EXPECT_TRUE(intersection.isComplex()) ;
+        EXPECT_EQ(2, intersection.accessComposite().getObjectCount()) ;
+
+    }
+
+    {
+
+        Intersection intersection = Intersection::Empty() ;
+
+        intersection += Intersection::Point({ 1.0, 2.0, 3.0 }) ;
+
+        EXPECT_TRUE(intersection.is<Point>()) ;
+        EXPECT_EQ(Point(1.0, 2.0, 3.0), intersection.as<Point>()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, Is)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Line ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        EXPECT_TRUE(Intersection::Point({ 1.0, 2.0, 3.0 }).is<Point>()) ;
+        EXPECT_TRUE(Intersection::Point({ 1.0, 2.0, 3.0 }).is<Object>()) ;
+        EXPECT_FALSE(Intersection::Point({ 1.0, 2.0, 3.0 }).is<PointSet>()) ;
+
+        EXPECT_TRUE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }).is<PointSet>()) ;
+        EXPECT_FALSE(Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }).is<Point>()) ;
+
+        EXPECT_TRUE(Intersection::Line(Line({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })).is<Line>()) ;
+        EXPECT_TRUE(Intersection::Ray(Ray({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })).is<Ray>()) ;
+        EXPECT_FALSE(Intersection::Ray(Ray({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })).is<Segment>()) ;
+
+        EXPECT_FALSE(Intersection::Empty().is<Point>()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, As)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        EXPECT_EQ(Point(1.0, 2.0, 3.0), Intersection::Point({ 1.0, 2.0, 3.0 }).as<Point>()) ;
+        EXPECT_EQ(Ray({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }), Intersection::Ray(Ray({ 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 })).as<Ray>()) ;
+
+        EXPECT_EQ(PointSet({ Point(1.0, 2.0, 3.0), Point(4.0, 5.0, 6.0) }), Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }).as<PointSet>()) ;
+
+    }
+
+    {
+
+        const Intersection intersection = Intersection::PointSet({ 1.0, 2.0, 3.0 }, { 4.0, 5.0, 6.0 }) ;
+
+        const Composite& composite = intersection.accessComposite() ;
+
+        EXPECT_TRUE(composite.is<PointSet>()) ;
+        EXPECT_EQ(&composite, &intersection.accessComposite()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Intersection::Point({ 1.0, 2.0, 3.0 }).as<PointSet>()) ;
+        EXPECT_ANY_THROW(Intersection::Undefined().accessComposite()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Intersection, AccessPoints)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        const Intersection intersection = Intersection::PointSet({ 4.0, 5.0, 6.0 }, { 1.0, 2.0, 3.0 }) ;
+
+        EXPECT_EQ(Point(4.0, 5.0, 6.0), intersection.accessPoints().first) ;
+        EXPECT_EQ(Point(1.0, 2.0, 3.0), intersection.accessPoints().second) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Intersection::Undefined().accessPoints()) ;
+        EXPECT_ANY_THROW(Intersection::Empty().accessPoints()) ;
+        EXPECT_ANY_THROW(Intersection::Point({ 1.0, 2.0, 3.0 }).accessPoints()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
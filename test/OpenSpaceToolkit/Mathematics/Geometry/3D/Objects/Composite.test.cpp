@@ -14,6 +14,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
@@ -25,6 +26,10 @@
 
 #include <Global.test.hpp>
 
+#include <memory_resource>
+#include <array>
+#include <cstddef>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, Constructor)
@@ -536,6 +541,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Composite, Composite::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, IsEmpty)
 {
 
@@ -1017,6 +1036,32 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, ConstIterator)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Composite ;
+
+    {
+
+        const Composite composite = Composite(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) + Composite(Point(4.0, 2.0, 0.0)) ;
+
+        EXPECT_EQ(Cuboid({ 1.5, 0.5, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 2.5, 1.5, 1.0 }), composite.getBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Composite::Empty().getBoundingBox()) ;
+        EXPECT_ANY_THROW(Composite::Undefined().getBoundingBox()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, ApplyTransformation)
 {
 
@@ -1064,6 +1109,144 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, ApplyTransform
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, MemoryResource)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::LineString ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::Intersection ;
+
+    std::array<std::byte, 4096> buffer ;
+
+    const auto isInBuffer = [&buffer] (const Object& anObject) -> bool
+    {
+        const std::byte* objectPtr = reinterpret_cast<const std::byte*>(&anObject) ;
+        return (objectPtr >= buffer.data()) && (objectPtr < (buffer.data() + buffer.size())) ;
+    } ;
+
+    {
+
+        std::pmr::monotonic_buffer_resource arena { buffer.data(), buffer.size(), std::pmr::null_memory_resource() } ;
+
+        const Composite composite = Composite { Point(1.0, 2.0, 3.0), &arena } ;
+
+        EXPECT_TRUE(isInBuffer(composite.accessObjectAt(0))) ;
+
+        const Composite concatenatedComposite = composite + Composite { Point(4.0, 5.0, 6.0) } ;
+
+        EXPECT_EQ(2, concatenatedComposite.getObjectCount()) ;
+        EXPECT_TRUE(isInBuffer(concatenatedComposite.accessObjectAt(0))) ;
+        EXPECT_TRUE(isInBuffer(concatenatedComposite.accessObjectAt(1))) ;
+
+        const Composite compositeCopy = composite ;
+
+        EXPECT_EQ(composite, compositeCopy) ;
+        EXPECT_FALSE(isInBuffer(compositeCopy.accessObjectAt(0))) ;
+
+    }
+
+    {
+
+        std::pmr::monotonic_buffer_resource arena { buffer.data(), buffer.size(), std::pmr::null_memory_resource() } ;
+
+        const Intersection intersection = Intersection::LineString(LineString({ Point(0.0, 0.0, 0.0), Point(1.0, 0.0, 0.0) }), &arena) ;
+
+        EXPECT_TRUE(isInBuffer(intersection.accessComposite().accessObjectAt(0))) ;
+
+    }
+
+    {
+
+        // Counts allocations and deallocations, forwarding them to the global heap
+
+        class CountingMemoryResource : public std::pmr::memory_resource
+        {
+
+            public:
+
+                std::size_t allocationCount = 0 ;
+                std::size_t deallocationCount = 0 ;
+
+            private:
+
+                void* do_allocate (std::size_t aSize, std::size_t anAlignment) override
+                {
+                    ++allocationCount ;
+                    return std::pmr::new_delete_resource()->allocate(aSize, anAlignment) ;
+                }
+
+                void do_deallocate (void* aPointer, std::size_t aSize, std::size_t anAlignment) override
+                {
+                    ++deallocationCount ;
+                    std::pmr::new_delete_resource()->deallocate(aPointer, aSize, anAlignment) ;
+                }
+
+                bool do_is_equal (const std::pmr::memory_resource& aMemoryResource) const noexcept override
+                {
+                    return this == &aMemoryResource ;
+                }
+
+        } ;
+
+        CountingMemoryResource memoryResource ;
+
+        {
+
+            const Object::Pointer pointPtr = Object::Clone(Point(1.0, 2.0, 3.0), &memoryResource) ;
+
+            EXPECT_EQ(Point(1.0, 2.0, 3.0), static_cast<const Point&>(*pointPtr)) ;
+            EXPECT_EQ(&memoryResource, pointPtr.get_deleter().getMemoryResource()) ;
+
+            Composite composite = Composite { LineString({ Point(0.0, 0.0, 0.0), Point(1.0, 0.0, 0.0) }), &memoryResource } ;
+
+            composite += Composite { Point(4.0, 5.0, 6.0) } ;
+
+            EXPECT_EQ(2, composite.getObjectCount()) ;
+            EXPECT_EQ(&memoryResource, composite.accessObjects().at(1).get_deleter().getMemoryResource()) ;
+
+            EXPECT_EQ(3, memoryResource.allocationCount) ;
+            EXPECT_EQ(0, memoryResource.deallocationCount) ;
+
+        }
+
+        EXPECT_EQ(3, memoryResource.deallocationCount) ;
+
+        EXPECT_EQ(nullptr, Object::Clone(Point(1.0, 2.0, 3.0), nullptr).get_deleter().getMemoryResource()) ;
+        EXPECT_EQ(nullptr, Composite(Point(1.0, 2.0, 3.0)).accessObjects().at(0).get_deleter().getMemoryResource()) ;
+
+    }
+
+    {
+
+        using ostk::math::geom::d3::objects::Segment ;
+        using ostk::math::geom::d3::objects::Sphere ;
+        using ostk::math::geom::d3::objects::Cuboid ;
+
+        std::pmr::monotonic_buffer_resource arena { buffer.data(), buffer.size(), std::pmr::null_memory_resource() } ;
+
+        const Segment segment = { { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 } } ;
+        const Sphere sphere = { { 1.0, 2.0, 3.0 }, 4.0 } ;
+        const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { Vector3d::UnitX(), Vector3d::UnitY(), Vector3d::UnitZ() }, { 1.0, 2.0, 3.0 } } ;
+        const Composite composite = Composite { Point(1.0, 2.0, 3.0) } ;
+
+        for (const Object* objectPtr : { static_cast<const Object*>(&segment), static_cast<const Object*>(&sphere), static_cast<const Object*>(&cuboid), static_cast<const Object*>(&composite) })
+        {
+
+            const Object::Pointer clonePtr = Object::Clone(*objectPtr, &arena) ;
+
+            EXPECT_EQ(objectPtr->getType(), clonePtr->getType()) ;
+            EXPECT_EQ(*objectPtr, *clonePtr) ;
+            EXPECT_TRUE(isInBuffer(*clonePtr)) ;
+
+        }
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Composite, Undefined)
 {
 
@@ -12,6 +12,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cone.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 
 #include <Global.test.hpp>
 
@@ -207,6 +208,54 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Cone, Cone::Undefined().getType()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, Intersects_Sphere)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    {
+
+        const Cone cone = { { 0.0, 0.0, 0.0 }, Vector3d::Z(), Angle::Degrees(45.0) } ;
+
+        EXPECT_TRUE(cone.intersects(Sphere { { 10.0, 0.0, 10.0 }, 1.0 })) ;
+        EXPECT_TRUE(cone.intersects(Sphere { { 0.0, 0.0, 0.5 }, 1.0 })) ;
+        EXPECT_TRUE(cone.intersects(Sphere { { 0.0, 0.0, -1.0 }, 1.5 })) ;
+        EXPECT_TRUE(cone.intersects(Sphere { { 0.0, 10.0, 10.0 + (2.0 * std::sqrt(2.0)) }, 2.0 + 1e-9 })) ;
+
+        EXPECT_FALSE(cone.intersects(Sphere { { 0.0, 0.0, 10.0 }, 1.0 })) ;
+        EXPECT_FALSE(cone.intersects(Sphere { { 0.0, 10.0, 10.0 + (2.0 * std::sqrt(2.0)) }, 2.0 - 1e-9 })) ;
+        EXPECT_FALSE(cone.intersects(Sphere { { 10.0, 0.0, -10.0 }, 1.0 })) ;
+        EXPECT_FALSE(cone.intersects(Sphere { { 0.0, 0.0, -2.0 }, 1.5 })) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cone::Undefined().intersects(Sphere::Undefined())) ;
+        EXPECT_ANY_THROW(Cone::Undefined().intersects(Sphere { { 0.0, 0.0, 0.0 }, 1.0 })) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, Intersects_Ellipsoid)
 {
 
@@ -230,6 +279,18 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, Intersects_Ellipsoi
 
     }
 
+    {
+
+        const Cone cone = { { 0.0, 0.0, 0.0 }, Vector3d::Z(), Angle::Degrees(10.0) } ;
+
+        EXPECT_TRUE(cone.intersects(Ellipsoid { { 0.0, 0.0, 10.0 }, 5.0, 0.5, 0.5 })) ;
+
+        EXPECT_FALSE(cone.intersects(Ellipsoid { { 0.0, 0.0, 10.0 }, 1.0, 0.5, 0.5 })) ;
+        EXPECT_FALSE(cone.intersects(Ellipsoid { { 100.0, 0.0, 0.0 }, 5.0, 4.0, 3.0 })) ;
+        EXPECT_FALSE(cone.intersects(Ellipsoid { { 0.0, 0.0, -100.0 }, 5.0, 4.0, 3.0 })) ;
+
+    }
+
     {
 
         EXPECT_ANY_THROW(Cone::Undefined().intersects(Ellipsoid::Undefined())) ;
@@ -369,6 +430,61 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, GetRaysOfLateralSur
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, GenerateRaysOfLateralSurface)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Cone ;
+
+    {
+
+        const Cone cone = { { 1.0, 2.0, 3.0 }, Vector3d { 1.0, -1.0, 0.5 }.normalized(), Angle::Degrees(25.0) } ;
+
+        for (const Size rayCount : { 1, 4, 37, 1000 })
+        {
+
+            const Array<Ray> referenceRays = cone.getRaysOfLateralSurface(rayCount) ;
+
+            const Cone::LateralRays rays = cone.generateRaysOfLateralSurface(rayCount) ;
+
+            EXPECT_EQ(rayCount, rays.getSize()) ;
+
+            Size rayIndex = 0 ;
+
+            for (const auto& ray : rays)
+            {
+
+                EXPECT_TRUE(ray.getOrigin().isNear(referenceRays.at(rayIndex).getOrigin(), 1e-12)) ;
+                EXPECT_TRUE(ray.getDirection().isNear(referenceRays.at(rayIndex).getDirection(), 1e-12)) ;
+
+                ++rayIndex ;
+
+            }
+
+            EXPECT_EQ(rayCount, rayIndex) ;
+
+        }
+
+    }
+
+    {
+
+        const Cone cone = { { 0.0, 0.0, 0.0 }, Vector3d::Z(), Angle::Degrees(45.0) } ;
+
+        EXPECT_ANY_THROW(cone.generateRaysOfLateralSurface(0)) ;
+        EXPECT_ANY_THROW(Cone::Undefined().generateRaysOfLateralSurface(4)) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, IntersectionWith_Ellipsoid)
 {
 
@@ -416,6 +532,93 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cone, IntersectionWith_El
 
     }
 
+    {
+
+        const Point apex = { 10.0, 0.0, 10.0 } ;
+        const Vector3d axis = { -1.0, 0.0, 0.0 } ;
+        const Angle angle = Angle::Degrees(10.0) ;
+
+        const Cone cone = { apex, axis, angle } ;
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 10.0 }, 5.0, 4.0, 3.0 } ;
+
+        const Intersection intersection = cone.intersectionWith(ellipsoid, false, 100) ;
+
+        EXPECT_TRUE(intersection.isDefined()) ;
+        EXPECT_FALSE(intersection.isEmpty()) ;
+        EXPECT_EQ(2, intersection.accessComposite().getObjectCount()) ;
+
+        const LineString nearLineString = intersection.accessComposite().accessObjectAt(0).as<LineString>() ;
+        const LineString farLineString = intersection.accessComposite().accessObjectAt(1).as<LineString>() ;
+
+        EXPECT_EQ(100, nearLineString.getPointCount()) ;
+        EXPECT_EQ(100, farLineString.getPointCount()) ;
+
+        for (const auto& point : nearLineString)
+        {
+
+            const Vector3d normalizedPoint = { point.x() / 5.0, point.y() / 4.0, (point.z() - 10.0) / 3.0 } ;
+
+            EXPECT_NEAR(1.0, normalizedPoint.norm(), 1e-12) ;
+            EXPECT_GT(point.x(), 0.0) ;
+
+        }
+
+        for (const auto& point : farLineString)
+        {
+
+            const Vector3d normalizedPoint = { point.x() / 5.0, point.y() / 4.0, (point.z() - 10.0) / 3.0 } ;
+
+            EXPECT_NEAR(1.0, normalizedPoint.norm(), 1e-12) ;
+            EXPECT_LT(point.x(), 0.0) ;
+
+        }
+
+    }
+
+    {
+
+        const Point apex = { 10.0, 0.0, 10.0 } ;
+        const Vector3d axis = Vector3d { -1.0, 0.3, 0.0 }.normalized() ;
+        const Angle angle = Angle::Degrees(20.0) ;
+
+        const Cone cone = { apex, axis, angle } ;
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 10.0 }, 5.0, 4.0, 3.0 } ;
+
+        const Intersection coarseIntersection = cone.intersectionWith(ellipsoid, true, Angle::Degrees(10.0)) ;
+        const Intersection fineIntersection = cone.intersectionWith(ellipsoid, true, Angle::Degrees(1.0)) ;
+
+        EXPECT_TRUE(coarseIntersection.accessComposite().is<LineString>()) ;
+        EXPECT_TRUE(fineIntersection.accessComposite().is<LineString>()) ;
+
+        const LineString coarseLineString = coarseIntersection.accessComposite().as<LineString>() ;
+        const LineString fineLineString = fineIntersection.accessComposite().as<LineString>() ;
+
+        EXPECT_LT(coarseLineString.getPointCount(), fineLineString.getPointCount()) ;
+
+        for (const auto& point : fineLineString)
+        {
+
+            const Vector3d normalizedPoint = { point.x() / 5.0, point.y() / 4.0, (point.z() - 10.0) / 3.0 } ;
+
+            EXPECT_NEAR(1.0, normalizedPoint.norm(), 1e-12) ;
+
+        }
+
+    }
+
+    {
+
+        const Cone cone = { { 10.0, 0.0, 10.0 }, { -1.0, 0.0, 0.0 }, Angle::Degrees(10.0) } ;
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 10.0 }, 5.0, 5.0, 5.0 } ;
+
+        EXPECT_ANY_THROW(cone.intersectionWith(ellipsoid, true, Angle::Degrees(0.0))) ;
+        EXPECT_ANY_THROW(cone.intersectionWith(ellipsoid, true, Angle::Undefined())) ;
+        EXPECT_ANY_THROW(Cone::Undefined().intersectionWith(ellipsoid, true, Angle::Degrees(1.0))) ;
+
+    }
+
     {
 
         EXPECT_ANY_THROW(Cone::Undefined().intersectionWith(Ellipsoid::Undefined())) ;
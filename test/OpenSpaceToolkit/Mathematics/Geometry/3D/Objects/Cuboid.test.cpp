@@ -12,6 +12,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
@@ -227,6 +228,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Cuboid, Cuboid::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, IsNear)
 {
 
@@ -1128,6 +1143,97 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, GetVertices)
 
 // }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, GetBoundingBox)
+{
+
+    using ostk::core::types::Real ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        const Cuboid cuboid = { { 1.0, 2.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 } } ;
+
+        EXPECT_EQ(cuboid, cuboid.getBoundingBox()) ;
+
+    }
+
+    {
+
+        const Vector3d firstAxis = Vector3d(1.0, 1.0, 0.0).normalized() ;
+        const Vector3d secondAxis = Vector3d(-1.0, 1.0, 0.0).normalized() ;
+
+        const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { firstAxis, secondAxis, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 2.0 } } ;
+
+        const Cuboid boundingBox = cuboid.getBoundingBox() ;
+
+        EXPECT_TRUE(boundingBox.getCenter().isNear(Point(0.0, 0.0, 0.0), 1e-12)) ;
+        EXPECT_TRUE(boundingBox.getFirstAxis().isApprox(Vector3d::X(), 1e-12)) ;
+        EXPECT_NEAR(std::sqrt(2.0), boundingBox.getFirstExtent(), 1e-12) ;
+        EXPECT_NEAR(std::sqrt(2.0), boundingBox.getSecondExtent(), 1e-12) ;
+        EXPECT_NEAR(2.0, boundingBox.getThirdExtent(), 1e-12) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cuboid::Undefined().getBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, GetOrientedBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        const Vector3d firstAxis = Vector3d(1.0, 1.0, 0.0).normalized() ;
+        const Vector3d secondAxis = Vector3d(-1.0, 1.0, 0.0).normalized() ;
+
+        const Cuboid cuboid = { { 0.0, 0.0, 0.0 }, { firstAxis, secondAxis, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 2.0 } } ;
+
+        EXPECT_EQ(cuboid, cuboid.getOrientedBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cuboid::Undefined().getOrientedBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, GetBoundingSphere)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        const Cuboid cuboid = { { 1.0, 2.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 2.0 } } ;
+
+        EXPECT_EQ(Sphere(Point(1.0, 2.0, 3.0), 3.0), cuboid.getBoundingSphere()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cuboid::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, ApplyTransformation)
 {
 
@@ -1226,4 +1332,98 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, Cube)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, BoundingBox)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        const Array<Point> points = { { 0.0, 0.0, 0.0 }, { 2.0, 4.0, 6.0 }, { 1.0, -2.0, 3.0 } } ;
+
+        const Cuboid boundingBox = Cuboid::BoundingBox(points) ;
+
+        EXPECT_EQ(Cuboid({ 1.0, 1.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 3.0, 3.0 }), boundingBox) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cuboid::BoundingBox(Array<Point>::Empty())) ;
+        EXPECT_ANY_THROW(Cuboid::BoundingBox({ Point(0.0, 0.0, 0.0), Point::Undefined() })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Cuboid, OrientedBoundingBox)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        // Points along a diagonal: the oriented box is a needle, much smaller than the axis-aligned box
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        for (int index = 0 ; index <= 100 ; ++index)
+        {
+
+            const double parameter = index / 100.0 ;
+
+            points.add(Point(parameter, parameter, parameter) + Vector3d(1e-3, -1e-3, 0.0) * ((index % 2 == 0) ? +1.0 : -1.0)) ;
+
+        }
+
+        const Cuboid orientedBoundingBox = Cuboid::OrientedBoundingBox(points) ;
+
+        EXPECT_NEAR(1.0, std::abs(orientedBoundingBox.getFirstAxis().dot(Vector3d(1.0, 1.0, 1.0).normalized())), 1e-9) ;
+        EXPECT_NEAR(std::sqrt(3.0) / 2.0, orientedBoundingBox.getFirstExtent(), 1e-9) ;
+        EXPECT_GT(1e-2, orientedBoundingBox.getSecondExtent()) ;
+        EXPECT_GT(1e-2, orientedBoundingBox.getThirdExtent()) ;
+
+        EXPECT_TRUE(orientedBoundingBox.getCenter().isNear(Point(0.5, 0.5, 0.5), 1e-9)) ;
+
+        for (const auto& point : points)
+        {
+
+            const Vector3d offset = point - orientedBoundingBox.getCenter() ;
+
+            EXPECT_GE(orientedBoundingBox.getFirstExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getFirstAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getSecondExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getSecondAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getThirdExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getThirdAxis()))) ;
+
+        }
+
+    }
+
+    {
+
+        // Corners of an axis-aligned box: the oriented box is never larger than the axis-aligned one
+
+        const Array<Point> points = { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 }, { 2.0, 1.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 2.0, 0.0, 1.0 }, { 0.0, 1.0, 1.0 }, { 2.0, 1.0, 1.0 } } ;
+
+        const Cuboid orientedBoundingBox = Cuboid::OrientedBoundingBox(points) ;
+
+        EXPECT_NEAR(0.25, orientedBoundingBox.getFirstExtent() * orientedBoundingBox.getSecondExtent() * orientedBoundingBox.getThirdExtent(), 1e-12) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Cuboid::OrientedBoundingBox(Array<Point>::Empty())) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -13,6 +13,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Intersection.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
@@ -169,6 +171,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Ellipsoid, Ellipsoid::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, Intersects_Point)
 {
 
@@ -736,6 +752,7 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, Contains_Point
 
     using ostk::math::geom::d3::objects::Point ;
     using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
 
     {
 
@@ -756,6 +773,18 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, Contains_Point
 
     }
 
+    {
+
+        const Ellipsoid ellipsoid = { { 1.0, 2.0, 3.0 }, 4.0, 5.0, 6.0, Quaternion::XYZS(0.1, 0.2, 0.3, 0.4).toNormalized() } ;
+
+        ASSERT_TRUE(ellipsoid.contains(Point::Vector(ellipsoid.getCenter().asVector() + 4.0 * ellipsoid.getFirstAxis()))) ;
+        ASSERT_TRUE(ellipsoid.contains(Point::Vector(ellipsoid.getCenter().asVector() - 5.0 * ellipsoid.getSecondAxis()))) ;
+        ASSERT_TRUE(ellipsoid.contains(Point::Vector(ellipsoid.getCenter().asVector() + 6.0 * ellipsoid.getThirdAxis()))) ;
+
+        ASSERT_FALSE(ellipsoid.contains(Point::Vector(ellipsoid.getCenter().asVector() + 4.0 * ellipsoid.getSecondAxis()))) ;
+
+    }
+
     {
 
         ASSERT_ANY_THROW(Ellipsoid::Undefined().contains(Point::Undefined())) ;
@@ -1648,6 +1677,228 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, IntersectionWi
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, IntersectRays)
+{
+
+    using ostk::core::types::Real ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::Intersection ;
+
+    {
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+        Matrix3Xd origins(3, 5) ;
+        Matrix3Xd directions(3, 5) ;
+
+        origins.col(0) = Vector3d(0.0, 0.0, -10.0) ; directions.col(0) = Vector3d(0.0, 0.0, 1.0) ; // Crossing
+        origins.col(1) = Vector3d(0.0, 0.0, 0.0) ; directions.col(1) = Vector3d(1.0, 0.0, 0.0) ; // From inside
+        origins.col(2) = Vector3d(0.0, 0.0, -10.0) ; directions.col(2) = Vector3d(0.0, 0.0, -1.0) ; // Pointing away
+        origins.col(3) = Vector3d(5.0, 0.0, -10.0) ; directions.col(3) = Vector3d(0.0, 0.0, 1.0) ; // Missing
+        origins.col(4) = Vector3d(0.0, -10.0, 0.0) ; directions.col(4) = Vector3d(0.0, 2.0, 0.0) ; // Crossing, non-normalized direction
+
+        const Ellipsoid::RayIntersections intersections = ellipsoid.intersectRays(origins, directions) ;
+
+        ASSERT_EQ(5, intersections.hits.size()) ;
+        ASSERT_EQ(5, intersections.nearRanges.size()) ;
+        ASSERT_EQ(5, intersections.farRanges.size()) ;
+
+        EXPECT_TRUE(intersections.hits(0)) ;
+        EXPECT_NEAR(7.0, intersections.nearRanges(0), 1e-12) ;
+        EXPECT_NEAR(13.0, intersections.farRanges(0), 1e-12) ;
+
+        EXPECT_TRUE(intersections.hits(1)) ;
+        EXPECT_NEAR(1.0, intersections.nearRanges(1), 1e-12) ;
+        EXPECT_NEAR(1.0, intersections.farRanges(1), 1e-12) ;
+
+        EXPECT_FALSE(intersections.hits(2)) ;
+        EXPECT_TRUE(std::isnan(intersections.nearRanges(2))) ;
+        EXPECT_TRUE(std::isnan(intersections.farRanges(2))) ;
+
+        EXPECT_FALSE(intersections.hits(3)) ;
+        EXPECT_TRUE(std::isnan(intersections.nearRanges(3))) ;
+        EXPECT_TRUE(std::isnan(intersections.farRanges(3))) ;
+
+        EXPECT_TRUE(intersections.hits(4)) ;
+        EXPECT_NEAR(4.0, intersections.nearRanges(4), 1e-12) ;
+        EXPECT_NEAR(6.0, intersections.farRanges(4), 1e-12) ;
+
+        const Ellipsoid::RayIntersections intersectionsInSight = ellipsoid.intersectRays(origins, directions, true) ;
+
+        EXPECT_EQ(intersections.hits, intersectionsInSight.hits) ;
+        EXPECT_NEAR(7.0, intersectionsInSight.nearRanges(0), 1e-12) ;
+        EXPECT_NEAR(7.0, intersectionsInSight.farRanges(0), 1e-12) ;
+
+    }
+
+    {
+
+        // Zero directions are misses, whether their origin is inside or outside of the ellipsoid
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 1.0, 2.0, 3.0 } ;
+
+        Matrix3Xd origins(3, 3) ;
+        Matrix3Xd directions(3, 3) ;
+
+        origins.col(0) = Vector3d(0.0, 0.0, -10.0) ; directions.col(0) = Vector3d(0.0, 0.0, 0.0) ; // Outside
+        origins.col(1) = Vector3d(0.0, 0.0, 0.0) ; directions.col(1) = Vector3d(0.0, 0.0, 0.0) ; // Inside
+        origins.col(2) = Vector3d(0.0, 0.0, -10.0) ; directions.col(2) = Vector3d(0.0, 0.0, 1.0) ; // Crossing
+
+        const Ellipsoid::RayIntersections intersections = ellipsoid.intersectRays(origins, directions) ;
+
+        EXPECT_FALSE(intersections.hits(0)) ;
+        EXPECT_TRUE(std::isnan(intersections.nearRanges(0))) ;
+        EXPECT_TRUE(std::isnan(intersections.farRanges(0))) ;
+
+        EXPECT_FALSE(intersections.hits(1)) ;
+        EXPECT_TRUE(std::isnan(intersections.nearRanges(1))) ;
+        EXPECT_TRUE(std::isnan(intersections.farRanges(1))) ;
+
+        EXPECT_TRUE(intersections.hits(2)) ;
+        EXPECT_NEAR(7.0, intersections.nearRanges(2), 1e-12) ;
+
+    }
+
+    {
+
+        const Ellipsoid ellipsoid = { { 1.0, 2.0, 3.0 }, 1.0, 2.0, 3.0, Quaternion::XYZS(0.1, 0.2, 0.3, 0.4).toNormalized() } ;
+
+        Matrix3Xd origins(3, 4) ;
+        Matrix3Xd directions(3, 4) ;
+
+        origins.col(0) = Vector3d(0.0, 0.0, -10.0) ; directions.col(0) = Vector3d(0.1, 0.2, 1.0).normalized() ;
+        origins.col(1) = Vector3d(10.0, 10.0, 10.0) ; directions.col(1) = Vector3d(-1.0, -1.0, -1.0).normalized() ;
+        origins.col(2) = Vector3d(1.0, 2.0, 3.0) ; directions.col(2) = Vector3d(0.0, 1.0, 0.0) ;
+        origins.col(3) = Vector3d(10.0, 10.0, 10.0) ; directions.col(3) = Vector3d(1.0, 0.0, 0.0) ;
+
+        const Ellipsoid::RayIntersections intersections = ellipsoid.intersectRays(origins, directions, true) ;
+
+        for (Eigen::Index rayIndex = 0; rayIndex < origins.cols(); ++rayIndex)
+        {
+
+            const Ray ray = { Point::Vector(origins.col(rayIndex)), directions.col(rayIndex) } ;
+
+            const Intersection intersection = ellipsoid.intersectionWith(ray, true) ;
+
+            ASSERT_EQ(!intersection.isEmpty(), intersections.hits(rayIndex)) ;
+
+            if (intersections.hits(rayIndex))
+            {
+
+                const Point expectedPoint = intersection.accessComposite().as<Point>() ;
+                const Point point = Point::Vector(origins.col(rayIndex) + intersections.nearRanges(rayIndex) * directions.col(rayIndex)) ;
+
+                EXPECT_TRUE(point.isNear(expectedPoint, 1e-10)) ;
+
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().intersectRays(Matrix3Xd::Zero(3, 1), Matrix3Xd::Zero(3, 1))) ;
+        EXPECT_ANY_THROW(Ellipsoid(Point::Origin(), 1.0, 2.0, 3.0).intersectRays(Matrix3Xd::Zero(3, 2), Matrix3Xd::Zero(3, 1))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    {
+
+        const Ellipsoid ellipsoid = { { 1.0, 2.0, 3.0 }, 4.0, 5.0, 6.0 } ;
+
+        EXPECT_EQ(Cuboid({ 1.0, 2.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 4.0, 5.0, 6.0 }), ellipsoid.getBoundingBox()) ;
+
+    }
+
+    {
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 0.0 }, 4.0, 2.0, 1.0, Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(45.0))) } ;
+
+        const Cuboid boundingBox = ellipsoid.getBoundingBox() ;
+
+        EXPECT_TRUE(boundingBox.getCenter().isNear(Point::Origin(), 1e-12)) ;
+        EXPECT_NEAR(std::sqrt(10.0), boundingBox.getFirstExtent(), 1e-12) ;
+        EXPECT_NEAR(std::sqrt(10.0), boundingBox.getSecondExtent(), 1e-12) ;
+        EXPECT_NEAR(1.0, boundingBox.getThirdExtent(), 1e-12) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().getBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, GetOrientedBoundingBox)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    {
+
+        const Ellipsoid ellipsoid = { { 1.0, 2.0, 3.0 }, 4.0, 2.0, 1.0, Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(45.0))) } ;
+
+        const Cuboid orientedBoundingBox = ellipsoid.getOrientedBoundingBox() ;
+
+        EXPECT_EQ(Cuboid(ellipsoid.getCenter(), { ellipsoid.getFirstAxis(), ellipsoid.getSecondAxis(), ellipsoid.getThirdAxis() }, { 4.0, 2.0, 1.0 }), orientedBoundingBox) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().getOrientedBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, GetBoundingSphere)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+
+    {
+
+        EXPECT_EQ(Sphere({ 1.0, 2.0, 3.0 }, 6.0), Ellipsoid({ 1.0, 2.0, 3.0 }, 4.0, 6.0, 5.0).getBoundingSphere()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Ellipsoid::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ellipsoid, ApplyTransformation)
 {
 
@@ -148,6 +148,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Line ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Line, Line::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Line, Intersects_Point)
 {
 
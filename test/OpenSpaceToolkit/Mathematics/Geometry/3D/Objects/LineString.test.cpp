@@ -9,10 +9,14 @@
 
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/LineString.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 
 #include <Global.test.hpp>
 
+#include <cmath>
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, Constructor)
@@ -149,6 +153,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::LineString ;
+
+    {
+
+        EXPECT_EQ(Object::Type::LineString, LineString::Empty().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, IsEmpty)
 {
 
@@ -245,6 +263,73 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, GetPointCount
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, GetProjectionOf)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::LineString ;
+
+    {
+
+        const LineString lineString = { { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 }, { 2.0, 2.0, 0.0 } } } ;
+
+        const LineString::Projection projection = lineString.getProjectionOf({ 1.0, 1.0, 0.0 }) ;
+
+        EXPECT_EQ(Point(1.0, 0.0, 0.0), projection.point) ;
+        EXPECT_EQ(0, projection.segmentIndex) ;
+        EXPECT_NEAR(1.0, projection.arcLength, 1e-15) ;
+        EXPECT_NEAR(1.0, projection.distance, 1e-15) ;
+
+        EXPECT_EQ(Point(2.0, 1.5, 0.0), lineString.getProjectionOf({ 3.0, 1.5, 0.0 }).point) ;
+        EXPECT_EQ(1, lineString.getProjectionOf({ 3.0, 1.5, 0.0 }).segmentIndex) ;
+        EXPECT_NEAR(3.5, lineString.getProjectionOf({ 3.0, 1.5, 0.0 }).arcLength, 1e-15) ;
+
+        EXPECT_EQ(Point(0.0, 0.0, 0.0), lineString.getProjectionOf({ -1.0, -1.0, 0.0 }).point) ;
+        EXPECT_EQ(Point(2.0, 2.0, 0.0), lineString.getProjectionOf({ 3.0, 3.0, 1.0 }).point) ;
+        EXPECT_NEAR(4.0, lineString.getProjectionOf({ 3.0, 3.0, 1.0 }).arcLength, 1e-15) ;
+
+        EXPECT_EQ(Point(1.0, 1.0, 1.0), LineString({ { 1.0, 1.0, 1.0 } }).getProjectionOf({ 1.0, 2.0, 1.0 }).point) ;
+        EXPECT_NEAR(1.0, LineString({ { 1.0, 1.0, 1.0 } }).getProjectionOf({ 1.0, 2.0, 1.0 }).distance, 1e-15) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().getProjectionOf({ 0.0, 0.0, 0.0 })) ;
+        EXPECT_ANY_THROW(LineString({ { 0.0, 0.0, 0.0 } }).getProjectionOf(Point::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, BuildIndex)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::LineString ;
+
+    {
+
+        const LineString lineString = { { { 0.0, 0.0, 0.0 }, { 2.0, 0.0, 0.0 } } } ;
+
+        EXPECT_NO_THROW(lineString.buildIndex()) ;
+
+        EXPECT_EQ(Point(1.0, 0.0, 0.0), lineString.getProjectionOf({ 1.0, 1.0, 0.0 }).point) ;
+
+        const LineString lineStringCopy = lineString ;
+
+        EXPECT_EQ(Point(1.5, 0.0, 0.0), lineStringCopy.getProjectionOf({ 1.5, -1.0, 0.0 }).point) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().buildIndex()) ;
+
+    }
+
+}
+
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, ToString) // [TBI]
 // {
 
@@ -302,6 +387,67 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, ConstIterator
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::Transformation ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::LineString ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        LineString lineString = LineString({ Point(0.0, 0.0, 0.0), Point(2.0, 0.0, 0.0), Point(0.0, 4.0, 0.0), Point(2.0, 4.0, 6.0) }) ;
+
+        const Cuboid boundingBox = lineString.getBoundingBox() ;
+
+        EXPECT_EQ(Cuboid({ 1.0, 2.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 }), boundingBox) ;
+        EXPECT_EQ(boundingBox, lineString.getBoundingBox()) ;
+
+        const Cuboid orientedBoundingBox = lineString.getOrientedBoundingBox() ;
+
+        EXPECT_GE(6.0 + 1e-12, orientedBoundingBox.getFirstExtent() * orientedBoundingBox.getSecondExtent() * orientedBoundingBox.getThirdExtent()) ;
+
+        const Sphere boundingSphere = lineString.getBoundingSphere() ;
+
+        for (const auto& point : lineString)
+        {
+
+            const Vector3d offset = point - orientedBoundingBox.getCenter() ;
+
+            EXPECT_GE(orientedBoundingBox.getFirstExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getFirstAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getSecondExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getSecondAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getThirdExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getThirdAxis()))) ;
+
+            EXPECT_GE(boundingSphere.getRadius() + 1e-12, (point - boundingSphere.getCenter()).norm()) ;
+
+        }
+
+        // Bounds are cached, and refreshed when the line string is transformed
+
+        lineString.applyTransformation(Transformation::Translation({ 1.0, 0.0, 0.0 })) ;
+
+        EXPECT_TRUE(lineString.getBoundingBox().getCenter().isNear(Point(2.0, 2.0, 3.0), 1e-12)) ;
+
+        for (const auto& point : lineString)
+        {
+            EXPECT_GE(lineString.getBoundingSphere().getRadius() + 1e-12, (point - lineString.getBoundingSphere().getCenter()).norm()) ;
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(LineString::Empty().getBoundingBox()) ;
+        EXPECT_ANY_THROW(LineString::Empty().getOrientedBoundingBox()) ;
+        EXPECT_ANY_THROW(LineString::Empty().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_LineString, ApplyTransformation)
 {
 
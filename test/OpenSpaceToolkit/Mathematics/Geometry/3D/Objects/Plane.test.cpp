@@ -141,6 +141,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Plane ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Plane, Plane::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Plane, Intersects_Point)
 {
 
@@ -10,6 +10,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 
 #include <Global.test.hpp>
 
@@ -191,6 +193,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Point ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Point, Point::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, IsNear)
 {
 
@@ -296,6 +312,30 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, DistanceTo)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, GetBoundingBox)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        EXPECT_EQ(Cuboid::Cube({ 1.0, 2.0, 3.0 }, 0.0), Point(1.0, 2.0, 3.0).getBoundingBox()) ;
+        EXPECT_EQ(Cuboid::Cube({ 1.0, 2.0, 3.0 }, 0.0), Point(1.0, 2.0, 3.0).getOrientedBoundingBox()) ;
+        EXPECT_EQ(Sphere({ 1.0, 2.0, 3.0 }, 0.0), Point(1.0, 2.0, 3.0).getBoundingSphere()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Point::Undefined().getBoundingBox()) ;
+        EXPECT_ANY_THROW(Point::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Point, ApplyTransformation)
 {
 
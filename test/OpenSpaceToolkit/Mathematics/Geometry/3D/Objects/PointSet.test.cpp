@@ -10,6 +10,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/PointSet.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 
 #include <Global.test.hpp>
 
@@ -155,6 +157,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    {
+
+        EXPECT_EQ(Object::Type::PointSet, PointSet::Empty().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, IsEmpty)
 {
 
@@ -229,6 +245,9 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetSize)
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetPointClosestTo)
 {
 
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
     using ostk::math::geom::d3::objects::Point ;
     using ostk::math::geom::d3::objects::PointSet ;
 
@@ -248,6 +267,121 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetPointClosest
 
     }
 
+    {
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        for (int i = 0; i < 20; ++i)
+        {
+            for (int j = 0; j < 20; ++j)
+            {
+                for (int k = 0; k < 20; ++k)
+                {
+                    points.add(Point(i * 1.0, j * 2.0, k * 3.0)) ;
+                }
+            }
+        }
+
+        const PointSet pointSet = { points } ;
+
+        EXPECT_EQ(Point(0.0, 0.0, 0.0), pointSet.getPointClosestTo({ -1.0, -1.0, -1.0 })) ;
+        EXPECT_EQ(Point(5.0, 8.0, 12.0), pointSet.getPointClosestTo({ 5.1, 7.8, 12.4 })) ;
+        EXPECT_EQ(Point(19.0, 38.0, 57.0), pointSet.getPointClosestTo({ 100.0, 100.0, 100.0 })) ;
+
+        for (const auto& point : points)
+        {
+            ASSERT_EQ(point, pointSet.getPointClosestTo(point + Vector3d { 0.1, -0.2, 0.3 })) ;
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetPointsClosestTo)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    {
+
+        const PointSet pointSet = { { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 }, { 0.0, 0.0, 3.0 } } } ;
+
+        EXPECT_EQ(Array<Point>({ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } }), pointSet.getPointsClosestTo({ 0.0, 0.0, -1.0 }, 2)) ;
+        EXPECT_EQ(Array<Point>({ { 0.0, 0.0, 3.0 }, { 0.0, 0.0, 2.0 }, { 0.0, 0.0, 1.0 } }), pointSet.getPointsClosestTo({ 0.0, 0.0, 2.9 }, 3)) ;
+        EXPECT_EQ(4, pointSet.getPointsClosestTo({ 0.0, 0.0, 0.0 }, 10).getSize()) ;
+        EXPECT_TRUE(pointSet.getPointsClosestTo({ 0.0, 0.0, 0.0 }, 0).isEmpty()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PointSet::Empty().getPointsClosestTo(Point::Origin(), 1)) ;
+        EXPECT_ANY_THROW(PointSet({ { 0.0, 0.0, 0.0 } }).getPointsClosestTo(Point::Undefined(), 1)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetPointsWithinDistance)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    {
+
+        const PointSet pointSet = { { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 }, { 0.0, 0.0, 3.0 } } } ;
+
+        EXPECT_EQ(Array<Point>({ { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 } }), pointSet.getPointsWithinDistance({ 0.0, 0.0, 1.4 }, 0.7)) ;
+        EXPECT_EQ(Array<Point>({ { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } }), pointSet.getPointsWithinDistance({ 0.0, 0.0, 0.0 }, 1.0)) ;
+        EXPECT_TRUE(pointSet.getPointsWithinDistance({ 1.0, 0.0, 0.0 }, 0.5).isEmpty()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PointSet::Empty().getPointsWithinDistance(Point::Origin(), 1.0)) ;
+        EXPECT_ANY_THROW(PointSet({ { 0.0, 0.0, 0.0 } }).getPointsWithinDistance(Point::Undefined(), 1.0)) ;
+        EXPECT_ANY_THROW(PointSet({ { 0.0, 0.0, 0.0 } }).getPointsWithinDistance(Point::Origin(), Real::Undefined())) ;
+        EXPECT_ANY_THROW(PointSet({ { 0.0, 0.0, 0.0 } }).getPointsWithinDistance(Point::Origin(), -1.0)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, BuildIndex)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+
+    {
+
+        const PointSet pointSet = { { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 } } } ;
+
+        EXPECT_NO_THROW(pointSet.buildIndex()) ;
+        EXPECT_NO_THROW(pointSet.buildIndex()) ;
+
+        EXPECT_EQ(Point(0.0, 0.0, 1.0), pointSet.getPointClosestTo({ 0.0, 0.0, 1.2 })) ;
+
+        const PointSet pointSetCopy = pointSet ;
+
+        EXPECT_EQ(Point(0.0, 0.0, 2.0), pointSetCopy.getPointClosestTo({ 0.0, 0.0, 1.8 })) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PointSet::Empty().buildIndex()) ;
+
+    }
+
 }
 
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, ConstIterator)
@@ -278,6 +412,67 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, ConstIterator)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::Transformation ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::PointSet ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        PointSet pointSet = PointSet({ Point(0.0, 0.0, 0.0), Point(2.0, 0.0, 0.0), Point(0.0, 4.0, 0.0), Point(2.0, 4.0, 6.0) }) ;
+
+        const Cuboid boundingBox = pointSet.getBoundingBox() ;
+
+        EXPECT_EQ(Cuboid({ 1.0, 2.0, 3.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 2.0, 3.0 }), boundingBox) ;
+        EXPECT_EQ(boundingBox, pointSet.getBoundingBox()) ;
+
+        const Cuboid orientedBoundingBox = pointSet.getOrientedBoundingBox() ;
+
+        EXPECT_GE(6.0 + 1e-12, orientedBoundingBox.getFirstExtent() * orientedBoundingBox.getSecondExtent() * orientedBoundingBox.getThirdExtent()) ;
+
+        const Sphere boundingSphere = pointSet.getBoundingSphere() ;
+
+        for (const auto& point : pointSet)
+        {
+
+            const Vector3d offset = point - orientedBoundingBox.getCenter() ;
+
+            EXPECT_GE(orientedBoundingBox.getFirstExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getFirstAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getSecondExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getSecondAxis()))) ;
+            EXPECT_GE(orientedBoundingBox.getThirdExtent() + 1e-12, std::abs(offset.dot(orientedBoundingBox.getThirdAxis()))) ;
+
+            EXPECT_GE(boundingSphere.getRadius() + 1e-12, (point - boundingSphere.getCenter()).norm()) ;
+
+        }
+
+        // Bounds are cached, and refreshed when the point set is transformed
+
+        pointSet.applyTransformation(Transformation::Translation({ 1.0, 0.0, 0.0 })) ;
+
+        EXPECT_TRUE(pointSet.getBoundingBox().getCenter().isNear(Point(2.0, 2.0, 3.0), 1e-12)) ;
+
+        for (const auto& point : pointSet)
+        {
+            EXPECT_GE(pointSet.getBoundingSphere().getRadius() + 1e-12, (point - pointSet.getBoundingSphere().getCenter()).norm()) ;
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(PointSet::Empty().getBoundingBox()) ;
+        EXPECT_ANY_THROW(PointSet::Empty().getOrientedBoundingBox()) ;
+        EXPECT_ANY_THROW(PointSet::Empty().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, ApplyTransformation)
 {
 
@@ -302,6 +497,18 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_PointSet, ApplyTransforma
 
     }
 
+    {
+
+        PointSet pointSet = { { { 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }, { 0.0, 0.0, 2.0 } } } ;
+
+        pointSet.buildIndex() ;
+
+        pointSet.applyTransformation(Transformation::Translation({ 4.0, 5.0, 6.0 })) ;
+
+        EXPECT_EQ(Point(4.0, 5.0, 7.0), pointSet.getPointClosestTo({ 4.0, 5.0, 7.1 })) ;
+
+    }
+
     // Rotation
 
     {
@@ -10,6 +10,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationVector.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
 
 #include <Global.test.hpp>
 
@@ -189,6 +191,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Polygon ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Polygon, Polygon::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, IsNear)
 {
 
@@ -394,6 +410,103 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, GetNormalVector)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using Polygon2d = ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        const Polygon2d polygon2d = { { { 0.0, 0.0 }, { 2.0, 0.0 }, { 2.0, 1.0 }, { 0.0, 1.0 } } } ;
+
+        const Polygon polygon = { polygon2d, { 1.0, 2.0, 3.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 } } ;
+
+        EXPECT_EQ(Cuboid({ 2.0, 2.0, 3.5 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 0.0, 0.5 }), polygon.getBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().getBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, GetOrientedBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using Polygon2d = ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+
+    {
+
+        // Rectangle of 2.0 by 1.0, rotated by 30 degrees in its plane
+
+        const double angle = M_PI / 6.0 ;
+
+        const Vector3d u = { std::cos(angle), std::sin(angle), 0.0 } ;
+        const Vector3d v = { -std::sin(angle), std::cos(angle), 0.0 } ;
+
+        const Polygon2d polygon2d = { { { 0.0, 0.0 }, { 2.0 * u.x(), 2.0 * u.y() }, { 2.0 * u.x() + v.x(), 2.0 * u.y() + v.y() }, { v.x(), v.y() } } } ;
+
+        const Polygon polygon = { polygon2d, { 0.0, 0.0, 5.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+
+        const Cuboid orientedBoundingBox = polygon.getOrientedBoundingBox() ;
+
+        EXPECT_TRUE(orientedBoundingBox.getCenter().isNear(Point::Vector(Vector3d(0.0, 0.0, 5.0) + u + v / 2.0), 1e-12)) ;
+        EXPECT_NEAR(2.0, orientedBoundingBox.getFirstExtent() * orientedBoundingBox.getSecondExtent() * 4.0, 1e-12) ;
+        EXPECT_NEAR(1.5, orientedBoundingBox.getFirstExtent() + orientedBoundingBox.getSecondExtent(), 1e-12) ;
+        EXPECT_EQ(0.0, orientedBoundingBox.getThirdExtent()) ;
+        EXPECT_NEAR(1.0, std::abs(orientedBoundingBox.getThirdAxis().z()), 1e-12) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().getOrientedBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, GetBoundingSphere)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using Polygon2d = ostk::math::geom::d2::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        const Polygon2d polygon2d = { { { -1.0, -1.0 }, { +1.0, -1.0 }, { +1.0, +1.0 }, { -1.0, +1.0 } } } ;
+
+        const Polygon polygon = { polygon2d, { 1.0, 2.0, 3.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+
+        const Sphere boundingSphere = polygon.getBoundingSphere() ;
+
+        EXPECT_TRUE(boundingSphere.getCenter().isNear(Point(1.0, 2.0, 3.0), 1e-12)) ;
+        EXPECT_NEAR(std::sqrt(2.0), boundingSphere.getRadius(), 1e-12) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Polygon::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Polygon, ApplyTransformation)
 {
 
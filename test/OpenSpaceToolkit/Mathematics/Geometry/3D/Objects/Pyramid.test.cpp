@@ -12,6 +12,8 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 
 #include <Global.test.hpp>
 
@@ -175,6 +177,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Pyramid, Pyramid::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, Intersects_Ellipsoid)
 {
 
@@ -197,6 +213,21 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, Intersects_Ellip
 
     }
 
+    {
+
+        const Polygon base = { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, 0.0 } ;
+
+        const Pyramid pyramid = { base, apex } ;
+
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid { { 0.0, 0.0, 10.0 }, 0.5, 0.5, 0.5 })) ;
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid { { 100.0, 0.0, 10.0 }, 5.0, 4.0, 3.0 })) ;
+        EXPECT_FALSE(pyramid.intersects(Ellipsoid { { 0.0, 0.0, -100.0 }, 5.0, 4.0, 3.0 })) ;
+
+        EXPECT_TRUE(pyramid.intersects(Ellipsoid { { 1.5, 1.5, 10.0 }, 1.0, 1.0, 1.0 })) ;
+
+    }
+
     {
 
         EXPECT_ANY_THROW(Pyramid::Undefined().intersects(Ellipsoid::Undefined())) ;
@@ -367,12 +398,106 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, GetApex)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, GenerateRaysOfLateralFaces)
+{
+
+    using ostk::core::types::Size ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+
+    {
+
+        const Polygon base = { { { { -0.1, -0.2 }, { +0.1, -0.2 }, { +0.3, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, 0.0 } ;
+
+        const Pyramid pyramid = { base, apex } ;
+
+        const Pyramid::LateralRays rays = pyramid.generateRaysOfLateralFaces(12) ;
+
+        EXPECT_EQ(12, rays.getSize()) ;
+
+        Array<Ray> generatedRays = Array<Ray>::Empty() ;
+
+        for (const auto& ray : rays)
+        {
+            generatedRays.add(ray) ;
+        }
+
+        ASSERT_EQ(12, generatedRays.getSize()) ;
+
+        for (Size lateralFaceIndex = 0; lateralFaceIndex < 4; ++lateralFaceIndex)
+        {
+
+            const Array<Ray> referenceRays = pyramid.getRaysOfLateralFaceAt(lateralFaceIndex, 4) ;
+
+            for (Size rayIndex = 0; rayIndex < 3; ++rayIndex)
+            {
+
+                const Ray& ray = generatedRays.at((3 * lateralFaceIndex) + rayIndex) ;
+
+                EXPECT_TRUE(ray.getOrigin().isNear(apex, 1e-12)) ;
+                EXPECT_TRUE(ray.getDirection().isNear(referenceRays.at(rayIndex).getDirection(), 1e-12)) ;
+
+            }
+
+        }
+
+    }
+
+    {
+
+        const Polygon base = { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, -1.0 } ;
+
+        const Pyramid::LateralRays rays = Pyramid(base, apex).generateRaysOfLateralFaces(8) ;
+
+        const Array<Ray> referenceRays = Pyramid(base, apex).getRaysOfLateralFaceAt(0, 3) ;
+
+        Size rayCount = 0 ;
+
+        for (const auto& ray : rays)
+        {
+
+            EXPECT_TRUE(ray.getOrigin().isNear(apex, 1e-12)) ;
+
+            if (rayCount < 2)
+            {
+                EXPECT_TRUE(ray.getDirection().isNear(referenceRays.at(rayCount).getDirection(), 1e-12)) ;
+            }
+
+            ++rayCount ;
+
+        }
+
+        EXPECT_EQ(8, rayCount) ;
+
+    }
+
+    {
+
+        const Polygon base = { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+
+        const Pyramid pyramid = { base, { 0.0, 0.0, 0.0 } } ;
+
+        EXPECT_ANY_THROW(pyramid.generateRaysOfLateralFaces(3)) ;
+        EXPECT_ANY_THROW(Pyramid::Undefined().generateRaysOfLateralFaces(4)) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, IntersectionWith_Ellipsoid)
 {
 
     using ostk::core::types::Real ;
 
     using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
     using ostk::math::geom::d3::objects::Point ;
     using ostk::math::geom::d3::objects::LineString ;
     using ostk::math::geom::d3::objects::Polygon ;
@@ -403,13 +528,13 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, IntersectionWith
         {
             {
                 { -0.505129425743498, -0.505129425743498, 5.05129425743498 },
-                { -0.505129425743498,  0.505129425743499, 5.05129425743498 },
+                { -0.502531791990292,  0.0,               5.02531791990292 },
                 { -0.505129425743498,  0.505129425743498, 5.05129425743498 },
-                {  0.505129425743499,  0.505129425743498, 5.05129425743498 },
+                {  0.0,                0.502531791990292, 5.02531791990292 },
                 {  0.505129425743498,  0.505129425743498, 5.05129425743498 },
-                {  0.505129425743498, -0.505129425743499, 5.05129425743498 },
+                {  0.502531791990292,  0.0,               5.02531791990292 },
                 {  0.505129425743498, -0.505129425743498, 5.05129425743498 },
-                { -0.505129425743499, -0.505129425743498, 5.05129425743498 }
+                {  0.0,               -0.502531791990292, 5.02531791990292 }
             }
         } ;
 
@@ -417,6 +542,34 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, IntersectionWith
 
     }
 
+    {
+
+        const Polygon base = { { { { -0.1, -0.1 }, { +0.1, -0.1 }, { +0.1, +0.1 }, { -0.1, +0.1 } } }, { 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, 0.0 } ;
+
+        const Pyramid pyramid = { base, apex } ;
+
+        const Ellipsoid ellipsoid = { { 0.0, 0.0, 10.0 }, 5.0, 5.0, 5.0 } ;
+
+        const Intersection intersection = pyramid.intersectionWith(ellipsoid, true, Angle::Degrees(1.0)) ;
+
+        EXPECT_TRUE(intersection.accessComposite().is<LineString>()) ;
+
+        const LineString intersectionLineString = intersection.accessComposite().as<LineString>() ;
+
+        EXPECT_LT(8, intersectionLineString.getPointCount()) ;
+
+        EXPECT_TRUE(intersectionLineString.accessPointAt(0).isNear({ -0.505129425743498, -0.505129425743498, 5.05129425743498 }, 1e-10)) ;
+
+        for (const auto& point : intersectionLineString)
+        {
+            EXPECT_NEAR(5.0, (point - Point(0.0, 0.0, 10.0)).norm(), 1e-12) ;
+        }
+
+        EXPECT_ANY_THROW(pyramid.intersectionWith(ellipsoid, true, Angle::Degrees(0.0))) ;
+
+    }
+
     {
 
         EXPECT_ANY_THROW(Pyramid::Undefined().intersectionWith(Ellipsoid::Undefined())) ;
@@ -425,6 +578,50 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, IntersectionWith
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        const Polygon base = { { { { -1.0, -1.0 }, { +1.0, -1.0 }, { +1.0, +1.0 }, { -1.0, +1.0 } } }, { 0.0, 0.0, 2.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, 0.0 } ;
+
+        const Pyramid pyramid = { base, apex } ;
+
+        EXPECT_EQ(Cuboid::Cube({ 0.0, 0.0, 1.0 }, 1.0), pyramid.getBoundingBox()) ;
+
+        const Cuboid orientedBoundingBox = pyramid.getOrientedBoundingBox() ;
+
+        EXPECT_NEAR(8.0, orientedBoundingBox.getFirstExtent() * orientedBoundingBox.getSecondExtent() * orientedBoundingBox.getThirdExtent() * 8.0, 1e-12) ;
+
+        const Sphere boundingSphere = pyramid.getBoundingSphere() ;
+
+        for (const auto& vertex : base.getVertices())
+        {
+            EXPECT_GE(boundingSphere.getRadius() + 1e-12, (vertex - boundingSphere.getCenter()).norm()) ;
+        }
+
+        EXPECT_GE(boundingSphere.getRadius() + 1e-12, (apex - boundingSphere.getCenter()).norm()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Pyramid::Undefined().getBoundingBox()) ;
+        EXPECT_ANY_THROW(Pyramid::Undefined().getOrientedBoundingBox()) ;
+        EXPECT_ANY_THROW(Pyramid::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Pyramid, ApplyTransformation)
 {
 
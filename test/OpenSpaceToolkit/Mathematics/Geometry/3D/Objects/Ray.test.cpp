@@ -151,6 +151,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Ray ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Ray, Ray::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Ray, Intersects_Point)
 {
 
@@ -12,6 +12,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 
 #include <Global.test.hpp>
@@ -137,6 +138,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Segment ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Segment, Segment::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, IsDegenerate)
 {
 
@@ -451,6 +466,82 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, IntersectionWith
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, GetBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Segment ;
+
+    {
+
+        EXPECT_EQ(Cuboid({ 1.0, 0.0, 2.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 0.0 }), Segment({ 0.0, 1.0, 2.0 }, { 2.0, -1.0, 2.0 }).getBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Segment::Undefined().getBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, GetOrientedBoundingBox)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Segment ;
+
+    {
+
+        const Cuboid orientedBoundingBox = Segment({ 0.0, 1.0, 2.0 }, { 2.0, -1.0, 2.0 }).getOrientedBoundingBox() ;
+
+        EXPECT_TRUE(orientedBoundingBox.getCenter().isNear(Point(1.0, 0.0, 2.0), 1e-12)) ;
+        EXPECT_TRUE(orientedBoundingBox.getFirstAxis().isApprox(Vector3d(1.0, -1.0, 0.0).normalized(), 1e-12)) ;
+        EXPECT_NEAR(0.0, orientedBoundingBox.getFirstAxis().dot(orientedBoundingBox.getSecondAxis()), 1e-12) ;
+        EXPECT_NEAR(std::sqrt(2.0), orientedBoundingBox.getFirstExtent(), 1e-12) ;
+        EXPECT_EQ(0.0, orientedBoundingBox.getSecondExtent()) ;
+        EXPECT_EQ(0.0, orientedBoundingBox.getThirdExtent()) ;
+
+    }
+
+    {
+
+        EXPECT_EQ(Segment({ 1.0, 2.0, 3.0 }, { 1.0, 2.0, 3.0 }).getBoundingBox(), Segment({ 1.0, 2.0, 3.0 }, { 1.0, 2.0, 3.0 }).getOrientedBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Segment::Undefined().getOrientedBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, GetBoundingSphere)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Segment ;
+
+    {
+
+        EXPECT_EQ(Sphere({ 1.0, 2.0, 3.0 }, 2.0), Segment({ 1.0, 2.0, 1.0 }, { 1.0, 2.0, 5.0 }).getBoundingSphere()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Segment::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Segment, ApplyTransformation)
 {
 
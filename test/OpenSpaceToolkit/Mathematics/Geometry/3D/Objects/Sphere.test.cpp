@@ -13,6 +13,7 @@
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
 #include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
@@ -143,6 +144,20 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, IsDefined)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, GetType)
+{
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        EXPECT_EQ(Object::Type::Sphere, Sphere::Undefined().getType()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, IsUnitary)
 {
 
@@ -911,6 +926,48 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, GetRadius)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, GetBoundingBox)
+{
+
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        EXPECT_EQ(Cuboid::Cube({ 1.0, 2.0, 3.0 }, 4.0), Sphere({ 1.0, 2.0, 3.0 }, 4.0).getBoundingBox()) ;
+        EXPECT_EQ(Cuboid::Cube({ 1.0, 2.0, 3.0 }, 4.0), Sphere({ 1.0, 2.0, 3.0 }, 4.0).getOrientedBoundingBox()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Sphere::Undefined().getBoundingBox()) ;
+        EXPECT_ANY_THROW(Sphere::Undefined().getOrientedBoundingBox()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, GetBoundingSphere)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        EXPECT_EQ(Sphere({ 1.0, 2.0, 3.0 }, 4.0), Sphere({ 1.0, 2.0, 3.0 }, 4.0).getBoundingSphere()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Sphere::Undefined().getBoundingSphere()) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, ApplyTransformation)
 {
 
@@ -987,4 +1044,58 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, Unit)
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Objects_Sphere, BoundingSphere)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Sphere ;
+
+    {
+
+        const Array<Point> points = { { -1.0, 0.0, 0.0 }, { +1.0, 0.0, 0.0 }, { 0.0, 0.5, 0.0 }, { 0.0, 0.0, -0.5 } } ;
+
+        EXPECT_EQ(Sphere({ 0.0, 0.0, 0.0 }, 1.0), Sphere::BoundingSphere(points)) ;
+
+    }
+
+    {
+
+        // Points spread over a sphere of radius 2.0: the bounding sphere is close to it, and encloses every point
+
+        Array<Point> points = Array<Point>::Empty() ;
+
+        for (int index = 0 ; index < 1000 ; ++index)
+        {
+
+            const double z = -1.0 + (2.0 * index + 1.0) / 1000.0 ;
+            const double azimuth = index * 2.399963229728653 ;
+            const double radius = std::sqrt(1.0 - z * z) ;
+
+            points.add(Point(1.0, 2.0, 3.0) + 2.0 * Vector3d(radius * std::cos(azimuth), radius * std::sin(azimuth), z)) ;
+
+        }
+
+        const Sphere boundingSphere = Sphere::BoundingSphere(points) ;
+
+        EXPECT_GT(2.0 * 1.05, boundingSphere.getRadius()) ;
+
+        for (const auto& point : points)
+        {
+            EXPECT_GE(boundingSphere.getRadius() + 1e-12, (point - boundingSphere.getCenter()).norm()) ;
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Sphere::BoundingSphere(Array<Point>::Empty())) ;
+        EXPECT_ANY_THROW(Sphere::BoundingSphere({ Point(0.0, 0.0, 0.0), Point::Undefined() })) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
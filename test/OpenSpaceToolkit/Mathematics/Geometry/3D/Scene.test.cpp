@@ -0,0 +1,614 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Scene.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Composite.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Pyramid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ellipsoid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Sphere.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Cuboid.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Polygon.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Plane.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Segment.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Ray.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <OpenSpaceToolkit/Core/Types/Real.hpp>
+
+#include <Global.test.hpp>
+
+#include <array>
+#include <cmath>
+#include <future>
+#include <limits>
+#include <vector>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, Constructor)
+{
+
+    using ostk::core::types::Unique ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+        objects.add(std::make_unique<Sphere>(Sphere({ 0.0, 0.0, 0.0 }, 1.0))) ;
+        objects.add(std::make_unique<Sphere>(Sphere({ 5.0, 0.0, 0.0 }, 1.0))) ;
+
+        EXPECT_NO_THROW(Scene scene(objects) ;) ;
+
+        const Scene scene = Scene(std::move(objects)) ;
+
+        EXPECT_EQ(2, scene.getObjectCount()) ;
+
+    }
+
+    {
+
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+        objects.add(std::make_unique<Plane>(Plane({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }))) ;
+
+        EXPECT_ANY_THROW(Scene scene(objects) ;) ;
+
+    }
+
+    {
+
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+        objects.add(std::make_unique<Composite>(Composite(Plane({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 })))) ;
+
+        EXPECT_ANY_THROW(Scene scene(objects) ;) ;
+
+    }
+
+    {
+
+        Array<Unique<Object>> objects = Array<Unique<Object>>::Empty() ;
+
+        objects.add(std::make_unique<Sphere>(Sphere::Undefined())) ;
+
+        EXPECT_ANY_THROW(Scene scene(objects) ;) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, CopyConstructor)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+
+        EXPECT_TRUE(scene.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        const Scene sceneCopy = scene ;
+
+        EXPECT_EQ(1, sceneCopy.getObjectCount()) ;
+        EXPECT_TRUE(sceneCopy.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        Scene anotherScene = Scene::Empty() ;
+
+        anotherScene = sceneCopy ;
+
+        EXPECT_EQ(1, anotherScene.getObjectCount()) ;
+        EXPECT_TRUE(anotherScene.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, IsEmpty)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        EXPECT_TRUE(Scene::Empty().isEmpty()) ;
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+
+        EXPECT_FALSE(scene.isEmpty()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, Intersects)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+        scene.addObject(Cuboid({ 10.0, 0.0, 0.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 1.0 })) ;
+        scene.addObject(Polygon({ { { -1.0, -1.0 }, { 1.0, -1.0 }, { 1.0, 1.0 }, { -1.0, 1.0 } } }, { 20.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 })) ;
+
+        EXPECT_TRUE(scene.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+        EXPECT_TRUE(scene.intersects(Ray({ 10.0, 0.5, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+        EXPECT_TRUE(scene.intersects(Ray({ 20.0, 0.5, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        EXPECT_FALSE(scene.intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, 1.0 }))) ;
+        EXPECT_FALSE(scene.intersects(Ray({ 5.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+        EXPECT_FALSE(scene.intersects(Ray({ 20.0, 1.5, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        EXPECT_TRUE(scene.intersects(Segment({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, 0.5 }))) ;
+        EXPECT_TRUE(scene.intersects(Segment({ 0.0, 0.0, 0.1 }, { 0.0, 0.0, 0.2 }))) ;
+        EXPECT_TRUE(scene.intersects(Segment({ 20.0, 0.0, 1.0 }, { 20.0, 0.0, -1.0 }))) ;
+        EXPECT_TRUE(scene.intersects(Segment({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 0.0 }))) ;
+
+        EXPECT_FALSE(scene.intersects(Segment({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, 2.0 }))) ;
+        EXPECT_FALSE(scene.intersects(Segment({ 20.0, 0.0, 1.0 }, { 20.0, 0.0, 0.5 }))) ;
+        EXPECT_FALSE(scene.intersects(Segment({ 5.0, 0.0, 0.0 }, { 5.0, 0.0, 0.0 }))) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(Scene::Empty().intersects(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+        EXPECT_FALSE(Scene::Empty().intersects(Segment({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -10.0 }))) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Scene::Empty().intersects(Ray::Undefined())) ;
+        EXPECT_ANY_THROW(Scene::Empty().intersects(Segment::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, AccessObjectAt)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+        scene.addObject(Sphere({ 5.0, 0.0, 0.0 }, 2.0)) ;
+
+        EXPECT_EQ(Sphere({ 5.0, 0.0, 0.0 }, 2.0), scene.accessObjectAt(1).as<Sphere>()) ;
+
+        EXPECT_ANY_THROW(scene.accessObjectAt(2)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, GetFirstHitOf)
+{
+
+    using ostk::core::types::Real ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Point ;
+    using ostk::math::geom::d3::objects::Polygon ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Ellipsoid ;
+    using ostk::math::geom::d3::objects::Cuboid ;
+    using ostk::math::geom::d3::objects::Pyramid ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0)) ;
+        scene.addObject(Ellipsoid({ 0.0, 0.0, -10.0 }, 1.0, 2.0, 3.0)) ;
+        scene.addObject(Cuboid({ 0.0, 0.0, 10.0 }, { Vector3d { 1.0, 0.0, 0.0 }, Vector3d { 0.0, 1.0, 0.0 }, Vector3d { 0.0, 0.0, 1.0 } }, { 1.0, 1.0, 0.5 })) ;
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 20.0 }, { 0.0, 0.0, -1.0 })) ;
+
+            EXPECT_TRUE(hit.isDefined()) ;
+            EXPECT_EQ(2, hit.objectIndex) ;
+            EXPECT_NEAR(9.5, hit.distance, 1e-12) ;
+            EXPECT_TRUE(hit.point.isNear(Point(0.0, 0.0, 10.5), 1e-12)) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 5.0 }, { 0.0, 0.0, -1.0 })) ;
+
+            EXPECT_EQ(0, hit.objectIndex) ;
+            EXPECT_NEAR(4.0, hit.distance, 1e-12) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, -2.0 }, { 0.0, 0.0, -1.0 })) ;
+
+            EXPECT_EQ(1, hit.objectIndex) ;
+            EXPECT_NEAR(5.0, hit.distance, 1e-12) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 0.5 }, { 1.0, 0.0, 0.0 })) ;
+
+            EXPECT_EQ(0, hit.objectIndex) ;
+            EXPECT_EQ(0.0, hit.distance) ;
+            EXPECT_EQ(Point(0.0, 0.0, 0.5), hit.point) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 5.0, 0.0 }, { 0.0, 1.0, 0.0 })) ;
+
+            EXPECT_FALSE(hit.isDefined()) ;
+            EXPECT_FALSE(hit.point.isDefined()) ;
+
+        }
+
+    }
+
+    {
+
+        const Polygon base = { { { { -1.0, -1.0 }, { 1.0, -1.0 }, { 1.0, 1.0 }, { -1.0, 1.0 } } }, { 0.0, 0.0, 0.0 }, { 1.0, 0.0, 0.0 }, { 0.0, 1.0, 0.0 } } ;
+        const Point apex = { 0.0, 0.0, 2.0 } ;
+
+        Scene scene = Scene::Empty() ;
+
+        scene.addObject(Pyramid(base, apex)) ;
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })) ;
+
+            EXPECT_NEAR(8.0, hit.distance, 1e-12) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, -10.0 }, { 0.0, 0.0, 1.0 })) ;
+
+            EXPECT_NEAR(10.0, hit.distance, 1e-12) ;
+
+        }
+
+        {
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray({ 0.0, 0.0, 1.0 }, { 1.0, 0.0, 0.0 })) ;
+
+            EXPECT_EQ(0.0, hit.distance) ;
+
+        }
+
+        {
+
+            EXPECT_FALSE(scene.getFirstHitOf(Ray({ 0.0, 0.0, -1.0 }, { 1.0, 0.0, 0.0 })).isDefined()) ;
+            EXPECT_FALSE(scene.getFirstHitOf(Ray({ 0.0, 0.0, 3.0 }, { 0.0, 0.0, 1.0 })).isDefined()) ;
+
+        }
+
+    }
+
+    {
+
+        // Large scene (built in parallel), checked against a linear scan
+
+        Scene scene = Scene::Empty() ;
+
+        const auto centerAt = [] (const std::size_t anIndex) -> Vector3d
+        {
+            return { 100.0 * std::sin(anIndex * 1.1), 100.0 * std::sin(anIndex * 2.3), 100.0 * std::sin(anIndex * 3.7) } ;
+        } ;
+
+        const std::size_t sphereCount = 5000 ;
+
+        for (std::size_t index = 0; index < sphereCount; ++index)
+        {
+            scene.addObject(Sphere(Point::Vector(centerAt(index)), 0.5 + 0.5 * std::abs(std::sin(index * 0.3)))) ;
+        }
+
+        for (std::size_t rayIndex = 0; rayIndex < 100; ++rayIndex)
+        {
+
+            const Vector3d origin = { 150.0 * std::cos(rayIndex * 0.7), 150.0 * std::sin(rayIndex * 0.7), 50.0 * std::sin(rayIndex * 1.3) } ;
+            const Vector3d direction = (centerAt(rayIndex * 37) - origin).normalized() ;
+
+            double expectedDistance = std::numeric_limits<double>::infinity() ;
+
+            for (std::size_t index = 0; index < sphereCount; ++index)
+            {
+
+                const Sphere& sphere = scene.accessObjectAt(index).as<Sphere>() ;
+
+                const Vector3d offset = origin - sphere.getCenter().asVector() ;
+
+                const double b = offset.dot(direction) ;
+                const double discriminant = b * b - (offset.squaredNorm() - sphere.getRadius() * sphere.getRadius()) ;
+
+                if ((discriminant >= 0.0) && ((-b - std::sqrt(discriminant)) >= 0.0))
+                {
+                    expectedDistance = std::min(expectedDistance, -b - std::sqrt(discriminant)) ;
+                }
+
+            }
+
+            const Scene::Hit hit = scene.getFirstHitOf(Ray(Point::Vector(origin), direction)) ;
+
+            ASSERT_TRUE(hit.isDefined()) ;
+            EXPECT_NEAR(expectedDistance, hit.distance, 1e-9) ;
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Scene::Empty().getFirstHitOf(Ray::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, GetObjectIndicesOverlapping)
+{
+
+    using ostk::core::ctnr::Array ;
+    using ostk::core::types::Index ;
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Segment ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            scene.addObject(Sphere({ 3.0 * index, 0.0, 0.0 }, 1.0)) ;
+        }
+
+        EXPECT_EQ(Array<Index>({ 0 }), scene.getObjectIndicesOverlapping(Sphere({ 0.0, 0.0, 0.0 }, 0.5))) ;
+        EXPECT_EQ(Array<Index>({ 3, 4, 5 }), scene.getObjectIndicesOverlapping(Segment({ 9.5, 0.0, 0.0 }, { 14.0, 0.0, 0.0 }))) ;
+        EXPECT_EQ(Array<Index>({ 10, 11 }), scene.getObjectIndicesOverlapping(Sphere({ 31.5, 0.0, 0.0 }, 1.0))) ;
+
+        EXPECT_TRUE(scene.getObjectIndicesOverlapping(Sphere({ 0.0, 5.0, 0.0 }, 1.0)).isEmpty()) ;
+
+        EXPECT_ANY_THROW(scene.getObjectIndicesOverlapping(Plane({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }))) ;
+        EXPECT_ANY_THROW(scene.getObjectIndicesOverlapping(Sphere::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, AddObject)
+{
+
+    using ostk::core::types::Unique ;
+
+    using ostk::math::geom::d3::Object ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Plane ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        EXPECT_EQ(0, scene.addObject(Sphere({ 0.0, 0.0, 0.0 }, 1.0))) ;
+
+        EXPECT_FALSE(scene.intersects(Ray({ 10.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        EXPECT_EQ(1, scene.addObject(std::make_unique<Sphere>(Sphere({ 10.0, 0.0, 0.0 }, 1.0)))) ;
+
+        EXPECT_TRUE(scene.intersects(Ray({ 10.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        EXPECT_ANY_THROW(scene.addObject(Plane({ 0.0, 0.0, 0.0 }, { 0.0, 0.0, 1.0 }))) ;
+        EXPECT_ANY_THROW(scene.addObject(Unique<Object>(nullptr))) ;
+
+        EXPECT_EQ(2, scene.getObjectCount()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, Build)
+{
+
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Composite ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            scene.addObject(Sphere({ 3.0 * index, 0.0, 0.0 }, 1.0)) ;
+        }
+
+        EXPECT_NO_THROW(scene.build()) ;
+
+        EXPECT_EQ(50, scene.getFirstHitOf(Ray({ 150.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex) ;
+
+    }
+
+    {
+
+        // Empty composites bound nothing, and do not disturb the split of their neighbours
+
+        Scene scene = Scene::Empty() ;
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+
+            scene.addObject(Sphere({ 3.0 * index, 0.0, 0.0 }, 1.0)) ;
+            scene.addObject(Composite::Empty()) ;
+
+        }
+
+        EXPECT_NO_THROW(scene.build()) ;
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            EXPECT_EQ(2 * index, scene.getFirstHitOf(Ray({ 3.0 * index, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex) ;
+        }
+
+    }
+
+    {
+
+        // Queries keep walking the hierarchy they started with, while it is rebuilt
+
+        Scene scene = Scene::Empty() ;
+
+        for (std::size_t index = 0; index < 1000; ++index)
+        {
+            scene.addObject(Sphere({ 3.0 * index, 0.0, 0.0 }, 1.0)) ;
+        }
+
+        const Scene& constScene = scene ;
+
+        std::vector<std::future<std::size_t>> futures ;
+
+        for (std::size_t threadIndex = 0; threadIndex < 4; ++threadIndex)
+        {
+
+            futures.push_back
+            (
+                std::async
+                (
+                    std::launch::async,
+                    [&constScene] () -> std::size_t
+                    {
+
+                        std::size_t hitCount = 0 ;
+
+                        for (std::size_t index = 0; index < 1000; ++index)
+                        {
+                            hitCount += (constScene.getFirstHitOf(Ray({ 3.0 * index, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex == index) ? 1 : 0 ;
+                        }
+
+                        return hitCount ;
+
+                    }
+                )
+            ) ;
+
+        }
+
+        for (std::size_t buildIndex = 0; buildIndex < 20; ++buildIndex)
+        {
+            constScene.build() ;
+        }
+
+        for (auto& future : futures)
+        {
+            EXPECT_EQ(1000, future.get()) ;
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, ApplyTransformation)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::d3::objects::Sphere ;
+    using ostk::math::geom::d3::objects::Ray ;
+    using ostk::math::geom::d3::Transformation ;
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        Scene scene = Scene::Empty() ;
+
+        for (std::size_t index = 0; index < 100; ++index)
+        {
+            scene.addObject(Sphere({ 3.0 * index, 0.0, 0.0 }, 1.0)) ;
+        }
+
+        EXPECT_EQ(50, scene.getFirstHitOf(Ray({ 150.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex) ;
+
+        scene.applyTransformation(7, Transformation::Translation({ 129.0, 0.0, 5.0 })) ;
+
+        EXPECT_EQ(7, scene.getFirstHitOf(Ray({ 150.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex) ;
+        EXPECT_NEAR(4.0, scene.getFirstHitOf(Ray({ 150.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 })).distance, 1e-12) ;
+
+        EXPECT_FALSE(scene.intersects(Ray({ 21.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+
+        scene.applyTransformation(Transformation::Translation({ 0.0, 10.0, 0.0 })) ;
+
+        EXPECT_FALSE(scene.intersects(Ray({ 150.0, 0.0, 10.0 }, { 0.0, 0.0, -1.0 }))) ;
+        EXPECT_EQ(7, scene.getFirstHitOf(Ray({ 150.0, 10.0, 10.0 }, { 0.0, 0.0, -1.0 })).objectIndex) ;
+
+        EXPECT_ANY_THROW(scene.applyTransformation(100, Transformation::Identity())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Scene, Empty)
+{
+
+    using ostk::math::geom::d3::Scene ;
+
+    {
+
+        EXPECT_NO_THROW(Scene::Empty()) ;
+        EXPECT_EQ(0, Scene::Empty().getObjectCount()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,214 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/AttitudeInterpolator.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationVector.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator, Constructor)
+{
+
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::AttitudeInterpolator ;
+
+    {
+
+        const VectorXd times = VectorXd::LinSpaced(3, 0.0, 2.0) ;
+        const Array<Quaternion> quaternions = { Quaternion::Unit(), Quaternion::XYZS(0.0, 0.0, 1.0, 0.0), Quaternion::Unit() } ;
+
+        EXPECT_NO_THROW(AttitudeInterpolator(times, quaternions)) ;
+        EXPECT_NO_THROW(AttitudeInterpolator(times, quaternions, AttitudeInterpolator::Type::NLERP)) ;
+        EXPECT_NO_THROW(AttitudeInterpolator(times, quaternions, AttitudeInterpolator::Type::SQUAD)) ;
+
+        const AttitudeInterpolator interpolator = { times, quaternions, AttitudeInterpolator::Type::SQUAD } ;
+
+        EXPECT_EQ(3, interpolator.getSampleCount()) ;
+        EXPECT_EQ(AttitudeInterpolator::Type::SQUAD, interpolator.getType()) ;
+        EXPECT_EQ(0.0, interpolator.getFirstTime()) ;
+        EXPECT_EQ(2.0, interpolator.getLastTime()) ;
+
+    }
+
+    {
+
+        const Array<Quaternion> quaternions = { Quaternion::Unit(), Quaternion::Unit() } ;
+
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(2, 0.0, 1.0), quaternions, AttitudeInterpolator::Type::Undefined)) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(3, 0.0, 1.0), quaternions)) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(1, 0.0, 0.0), { Quaternion::Unit() })) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::Zero(2), quaternions)) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(2, 1.0, 0.0), quaternions)) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(2, 0.0, 1.0), { Quaternion::Unit(), Quaternion::Undefined() })) ;
+        EXPECT_ANY_THROW(AttitudeInterpolator(VectorXd::LinSpaced(2, 0.0, 1.0), { Quaternion::Unit(), Quaternion::XYZS(0.0, 0.0, 1.0, 1.0) })) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator, Evaluate)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::core::ctnr::Array ;
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::VectorXd ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+    using ostk::math::geom::d3::trf::rot::AttitudeInterpolator ;
+
+    // Tumbling attitude, sampled every 10 s, with sign flips between samples
+
+    const auto attitude = [] (const double aTime) -> Quaternion
+    {
+
+        const Quaternion spin = Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(3.0 * aTime))) ;
+        const Quaternion nutation = Quaternion::RotationVector(RotationVector({ 1.0, 0.0, 0.0 }, Angle::Degrees(5.0 * std::sin(0.05 * aTime)))) ;
+
+        return spin.crossMultiply(nutation).normalize() ;
+
+    } ;
+
+    const VectorXd times = VectorXd::LinSpaced(31, 0.0, 300.0) ;
+
+    Array<Quaternion> quaternions = Array<Quaternion>::Empty() ;
+
+    for (Eigen::Index index = 0; index < times.size(); ++index)
+    {
+
+        const Quaternion quaternion = attitude(times(index)) ;
+
+        quaternions.add(((index % 2) == 0) ? quaternion : Quaternion::XYZS(-quaternion.x(), -quaternion.y(), -quaternion.z(), -quaternion.s())) ;
+
+    }
+
+    {
+
+        // Consistent with the quaternion interpolation functions
+
+        const AttitudeInterpolator slerpInterpolator = { times, quaternions, AttitudeInterpolator::Type::SLERP } ;
+        const AttitudeInterpolator nlerpInterpolator = { times, quaternions, AttitudeInterpolator::Type::NLERP } ;
+        const AttitudeInterpolator squadInterpolator = { times, quaternions, AttitudeInterpolator::Type::SQUAD } ;
+
+        for (const double time : { 0.0, 3.0, 10.0, 47.5, 123.4, 299.9, 300.0 })
+        {
+
+            const Eigen::Index index = std::min<Eigen::Index>(static_cast<Eigen::Index>(time / 10.0), times.size() - 2) ;
+            const Real ratio = (time - times(index)) / 10.0 ;
+
+            EXPECT_TRUE(slerpInterpolator.evaluate(time).isNear(Quaternion::SLERP(quaternions[index], quaternions[index + 1], ratio), Angle::Radians(1e-12))) << time ;
+            EXPECT_TRUE(nlerpInterpolator.evaluate(time).isNear(Quaternion::NLERP(quaternions[index], quaternions[index + 1], ratio), Angle::Radians(1e-12))) << time ;
+
+            if ((index > 0) && ((index + 2) < times.size()))
+            {
+                EXPECT_TRUE(squadInterpolator.evaluate(time).isNear(Quaternion::SQUAD(quaternions[index - 1], quaternions[index], quaternions[index + 1], quaternions[index + 2], ratio), Angle::Radians(1e-12))) << time ;
+            }
+
+        }
+
+        // Samples are interpolated exactly
+
+        for (Eigen::Index index = 0; index < times.size(); ++index)
+        {
+
+            EXPECT_TRUE(slerpInterpolator.evaluate(times(index)).isNear(quaternions[index], Angle::Radians(1e-12))) ;
+            EXPECT_TRUE(squadInterpolator.evaluate(times(index)).isNear(quaternions[index], Angle::Radians(1e-12))) ;
+
+        }
+
+        // SQUAD is closer to the smooth attitude than SLERP
+
+        double slerpError = 0.0 ;
+        double squadError = 0.0 ;
+
+        for (double time = 10.0; time < 290.0; time += 0.7)
+        {
+
+            slerpError = std::max<double>(slerpError, slerpInterpolator.evaluate(time).angularDifferenceWith(attitude(time)).inRadians()) ;
+            squadError = std::max<double>(squadError, squadInterpolator.evaluate(time).angularDifferenceWith(attitude(time)).inRadians()) ;
+
+        }
+
+        EXPECT_LT(squadError, slerpError) ;
+
+    }
+
+    {
+
+        // Batch evaluation, sorted or not, matches single evaluations
+
+        const AttitudeInterpolator interpolator = { times, quaternions, AttitudeInterpolator::Type::SQUAD } ;
+
+        const VectorXd sortedTimes = VectorXd::LinSpaced(1001, 0.0, 300.0) ;
+
+        VectorXd unsortedTimes = sortedTimes ;
+
+        for (Eigen::Index index = 0; index < unsortedTimes.size(); ++index)
+        {
+            unsortedTimes(index) = sortedTimes((index * 617) % sortedTimes.size()) ;
+        }
+
+        const Array<Quaternion> sortedQuaternions = interpolator.evaluate(sortedTimes) ;
+        const Array<Quaternion> unsortedQuaternions = interpolator.evaluate(unsortedTimes) ;
+
+        ASSERT_EQ(static_cast<std::size_t>(sortedTimes.size()), sortedQuaternions.getSize()) ;
+        ASSERT_EQ(static_cast<std::size_t>(unsortedTimes.size()), unsortedQuaternions.getSize()) ;
+
+        for (Eigen::Index index = 0; index < sortedTimes.size(); ++index)
+        {
+
+            EXPECT_TRUE(sortedQuaternions[index].isUnitary()) ;
+            EXPECT_EQ(interpolator.evaluate(sortedTimes(index)), sortedQuaternions[index]) ;
+            EXPECT_EQ(interpolator.evaluate(unsortedTimes(index)), unsortedQuaternions[index]) ;
+
+        }
+
+        EXPECT_TRUE(interpolator.evaluate(VectorXd::Zero(0)).isEmpty()) ;
+
+    }
+
+    {
+
+        const AttitudeInterpolator interpolator = { times, quaternions } ;
+
+        EXPECT_ANY_THROW(interpolator.evaluate(Real::Undefined())) ;
+        EXPECT_ANY_THROW(interpolator.evaluate(-1.0)) ;
+        EXPECT_ANY_THROW(interpolator.evaluate(300.1)) ;
+        EXPECT_ANY_THROW(interpolator.evaluate(VectorXd::LinSpaced(3, 290.0, 310.0))) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_AttitudeInterpolator, StringFromType)
+{
+
+    using ostk::math::geom::d3::trf::rot::AttitudeInterpolator ;
+
+    {
+
+        EXPECT_EQ("Undefined", AttitudeInterpolator::StringFromType(AttitudeInterpolator::Type::Undefined)) ;
+        EXPECT_EQ("NLERP", AttitudeInterpolator::StringFromType(AttitudeInterpolator::Type::NLERP)) ;
+        EXPECT_EQ("SLERP", AttitudeInterpolator::StringFromType(AttitudeInterpolator::Type::SLERP)) ;
+        EXPECT_EQ("SQUAD", AttitudeInterpolator::StringFromType(AttitudeInterpolator::Type::SQUAD)) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,224 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/ElementaryRotation.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, Constructor)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+
+    {
+
+        EXPECT_NO_THROW(ElementaryRotation<Axis::X>(Angle::Degrees(30.0))) ;
+        EXPECT_NO_THROW(ElementaryRotation<Axis::Y>(Angle::Degrees(30.0))) ;
+        EXPECT_NO_THROW(ElementaryRotation<Axis::Z>(Angle::Degrees(30.0))) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::X>(Angle::Undefined())) ;
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::Y>(Angle::Undefined())) ;
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::Z>(Angle::Undefined())) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, MultiplicationOperator)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    const Angle psi = Angle::Degrees(-123.4) ;
+    const Angle theta = Angle::Degrees(56.7) ;
+    const Angle phi = Angle::Degrees(170.0) ;
+
+    {
+
+        // Same axis
+
+        EXPECT_TRUE((ElementaryRotation<Axis::X>(psi) * ElementaryRotation<Axis::X>(theta)).toRotationMatrix().getMatrix().isApprox(RotationMatrix::RX(psi + theta).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE((ElementaryRotation<Axis::Y>(psi) * ElementaryRotation<Axis::Y>(theta)).toRotationMatrix().getMatrix().isApprox(RotationMatrix::RY(psi + theta).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE((ElementaryRotation<Axis::Z>(psi) * ElementaryRotation<Axis::Z>(theta)).toRotationMatrix().getMatrix().isApprox(RotationMatrix::RZ(psi + theta).getMatrix(), 1e-12)) ;
+
+    }
+
+    {
+
+        // Euler sequences
+
+        const RotationMatrix zxz = ElementaryRotation<Axis::Z>(psi) * ElementaryRotation<Axis::X>(theta) * ElementaryRotation<Axis::Z>(phi) ;
+        const RotationMatrix zyx = ElementaryRotation<Axis::Z>(psi) * (ElementaryRotation<Axis::Y>(theta) * ElementaryRotation<Axis::X>(phi)) ;
+        const RotationMatrix yxy = ElementaryRotation<Axis::Y>(psi) * ElementaryRotation<Axis::X>(theta) * ElementaryRotation<Axis::Y>(phi) ;
+
+        EXPECT_TRUE(zxz.getMatrix().isApprox((RotationMatrix::RZ(psi) * RotationMatrix::RX(theta) * RotationMatrix::RZ(phi)).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE(zyx.getMatrix().isApprox((RotationMatrix::RZ(psi) * RotationMatrix::RY(theta) * RotationMatrix::RX(phi)).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE(yxy.getMatrix().isApprox((RotationMatrix::RY(psi) * RotationMatrix::RX(theta) * RotationMatrix::RY(phi)).getMatrix(), 1e-12)) ;
+
+        EXPECT_TRUE((zxz.getMatrix() * zxz.getMatrix().transpose()).isApprox(Matrix3d::Identity(), 1e-12)) ;
+
+    }
+
+    {
+
+        // Mixed with rotation matrices
+
+        const RotationMatrix rotationMatrix = RotationMatrix::RY(theta) * RotationMatrix::RX(phi) ;
+
+        EXPECT_TRUE((ElementaryRotation<Axis::Z>(psi) * rotationMatrix).getMatrix().isApprox((RotationMatrix::RZ(psi) * rotationMatrix).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE((rotationMatrix * ElementaryRotation<Axis::Z>(psi)).getMatrix().isApprox((rotationMatrix * RotationMatrix::RZ(psi)).getMatrix(), 1e-12)) ;
+        EXPECT_TRUE((rotationMatrix * ElementaryRotation<Axis::X>(psi)).getMatrix().isApprox((rotationMatrix * RotationMatrix::RX(psi)).getMatrix(), 1e-12)) ;
+
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::Z>(psi) * RotationMatrix::Undefined()) ;
+        EXPECT_ANY_THROW(RotationMatrix::Undefined() * ElementaryRotation<Axis::Z>(psi)) ;
+
+    }
+
+    {
+
+        // Mixed with quaternions
+
+        const Quaternion quaternion = Quaternion::RotationMatrix(RotationMatrix::RY(theta) * RotationMatrix::RX(phi)) ;
+
+        EXPECT_TRUE((ElementaryRotation<Axis::Z>(psi) * quaternion).isNear(Quaternion::RotationMatrix(RotationMatrix::RZ(psi)) * quaternion, Angle::Radians(1e-12))) ;
+        EXPECT_TRUE((quaternion * ElementaryRotation<Axis::Z>(psi)).isNear(quaternion * Quaternion::RotationMatrix(RotationMatrix::RZ(psi)), Angle::Radians(1e-12))) ;
+
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::Z>(psi) * Quaternion::Undefined()) ;
+        EXPECT_ANY_THROW(Quaternion::Undefined() * ElementaryRotation<Axis::Z>(psi)) ;
+
+    }
+
+    {
+
+        // Vectors
+
+        const Vector3d vector = { 1.0, -2.0, 3.0 } ;
+
+        EXPECT_TRUE((ElementaryRotation<Axis::X>(psi) * vector).isApprox(RotationMatrix::RX(psi) * vector, 1e-12)) ;
+        EXPECT_TRUE((ElementaryRotation<Axis::Y>(psi) * vector).isApprox(RotationMatrix::RY(psi) * vector, 1e-12)) ;
+        EXPECT_TRUE((ElementaryRotation<Axis::Z>(psi) * vector).isApprox(RotationMatrix::RZ(psi) * vector, 1e-12)) ;
+
+        EXPECT_ANY_THROW(ElementaryRotation<Axis::Z>(psi) * Vector3d::Undefined()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, GetAngle)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+
+    {
+
+        EXPECT_NEAR(0.0, ElementaryRotation<Axis::X>::Unit().getAngle().inDegrees(), 1e-12) ;
+        EXPECT_NEAR(30.0, ElementaryRotation<Axis::X>(Angle::Degrees(30.0)).getAngle().inDegrees(), 1e-12) ;
+        EXPECT_NEAR(-170.0, ElementaryRotation<Axis::Y>(Angle::Degrees(190.0)).getAngle().inDegrees(), 1e-12) ;
+        EXPECT_NEAR(-20.0, (ElementaryRotation<Axis::Z>(Angle::Degrees(170.0)) * ElementaryRotation<Axis::Z>(Angle::Degrees(170.0))).getAngle().inDegrees(), 1e-12) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, ToInverse)
+{
+
+    using ostk::math::obj::Matrix3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+
+    {
+
+        const ElementaryRotation<Axis::Y> rotation = ElementaryRotation<Axis::Y>(Angle::Degrees(42.0)) ;
+
+        EXPECT_TRUE(rotation.toInverse().toRotationMatrix().getMatrix().isApprox(rotation.toRotationMatrix().getMatrix().transpose(), 1e-15)) ;
+        EXPECT_NEAR(0.0, (rotation * rotation.toInverse()).getAngle().inDegrees(), 1e-12) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, ToRotationMatrix)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    {
+
+        for (const double angle_deg : { -180.0, -90.0, -12.3, 0.0, 45.0, 90.0, 179.0, 180.0 })
+        {
+
+            const Angle angle = Angle::Degrees(angle_deg) ;
+
+            EXPECT_EQ(RotationMatrix::RX(angle), ElementaryRotation<Axis::X>(angle).toRotationMatrix()) << angle_deg ;
+            EXPECT_EQ(RotationMatrix::RY(angle), ElementaryRotation<Axis::Y>(angle).toRotationMatrix()) << angle_deg ;
+            EXPECT_EQ(RotationMatrix::RZ(angle), ElementaryRotation<Axis::Z>(angle).toRotationMatrix()) << angle_deg ;
+
+        }
+
+        EXPECT_EQ(RotationMatrix::Unit(), ElementaryRotation<Axis::Z>::Unit().toRotationMatrix()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_ElementaryRotation, ToQuaternion)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Axis ;
+    using ostk::math::geom::d3::trf::rot::ElementaryRotation ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    {
+
+        for (const double angle_deg : { -180.0, -179.0, -90.0, -12.3, 0.0, 45.0, 90.0, 179.0, 180.0 })
+        {
+
+            const Angle angle = Angle::Degrees(angle_deg) ;
+
+            EXPECT_TRUE(ElementaryRotation<Axis::X>(angle).toQuaternion().isUnitary()) << angle_deg ;
+
+            EXPECT_TRUE(ElementaryRotation<Axis::X>(angle).toQuaternion().isNear(Quaternion::RotationMatrix(RotationMatrix::RX(angle)), Angle::Radians(1e-12))) << angle_deg ;
+            EXPECT_TRUE(ElementaryRotation<Axis::Y>(angle).toQuaternion().isNear(Quaternion::RotationMatrix(RotationMatrix::RY(angle)), Angle::Radians(1e-12))) << angle_deg ;
+            EXPECT_TRUE(ElementaryRotation<Axis::Z>(angle).toQuaternion().isNear(Quaternion::RotationMatrix(RotationMatrix::RZ(angle)), Angle::Radians(1e-12))) << angle_deg ;
+
+        }
+
+        EXPECT_EQ(Quaternion::Unit(), ElementaryRotation<Axis::Z>::Unit().toQuaternion()) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
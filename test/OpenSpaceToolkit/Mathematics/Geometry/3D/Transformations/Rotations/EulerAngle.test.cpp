@@ -0,0 +1,377 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/EulerAngle.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/RotationMatrix.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/Angle.hpp>
+
+#include <Global.test.hpp>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+const std::vector<EulerAngle::AxisSequence> AxisSequences =
+{
+    EulerAngle::AxisSequence::XYX,
+    EulerAngle::AxisSequence::XYZ,
+    EulerAngle::AxisSequence::XZX,
+    EulerAngle::AxisSequence::XZY,
+    EulerAngle::AxisSequence::YXY,
+    EulerAngle::AxisSequence::YXZ,
+    EulerAngle::AxisSequence::YZX,
+    EulerAngle::AxisSequence::YZY,
+    EulerAngle::AxisSequence::ZXY,
+    EulerAngle::AxisSequence::ZXZ,
+    EulerAngle::AxisSequence::ZYX,
+    EulerAngle::AxisSequence::ZYZ
+} ;
+
+// Reference rotation matrix, stacking the three elementary rotations: R = RC(psi) * RB(theta) * RA(phi)
+
+ostk::math::geom::d3::trf::rot::RotationMatrix ReferenceRotationMatrix (const EulerAngle& anEulerAngle)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    const auto elementaryRotation = [] (const char anAxis, const Angle& anAngle) -> RotationMatrix
+    {
+        return (anAxis == 'X') ? RotationMatrix::RX(anAngle) : ((anAxis == 'Y') ? RotationMatrix::RY(anAngle) : RotationMatrix::RZ(anAngle)) ;
+    } ;
+
+    const std::string axes = EulerAngle::StringFromAxisSequence(anEulerAngle.getAxisSequence()) ;
+
+    return elementaryRotation(axes[2], anEulerAngle.getPsi()) * elementaryRotation(axes[1], anEulerAngle.getTheta()) * elementaryRotation(axes[0], anEulerAngle.getPhi()) ;
+
+}
+
+bool IsProper (const EulerAngle::AxisSequence& anAxisSequence)
+{
+
+    const std::string axes = EulerAngle::StringFromAxisSequence(anAxisSequence) ;
+
+    return axes[0] == axes[2] ;
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, Constructor)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    {
+
+        const EulerAngle eulerAngle = { Angle::Degrees(10.0), Angle::Degrees(20.0), Angle::Degrees(30.0), EulerAngle::AxisSequence::ZYX } ;
+
+        EXPECT_TRUE(eulerAngle.isDefined()) ;
+
+        EXPECT_EQ(Angle::Degrees(10.0), eulerAngle.getPhi()) ;
+        EXPECT_EQ(Angle::Degrees(20.0), eulerAngle.getTheta()) ;
+        EXPECT_EQ(Angle::Degrees(30.0), eulerAngle.getPsi()) ;
+        EXPECT_EQ(EulerAngle::AxisSequence::ZYX, eulerAngle.getAxisSequence()) ;
+
+        EXPECT_TRUE(eulerAngle.toVector(Angle::Unit::Degree).isApprox(Vector3d(10.0, 20.0, 30.0), 1e-15)) ;
+
+        EXPECT_EQ(eulerAngle, EulerAngle::Vector({ 10.0, 20.0, 30.0 }, Angle::Unit::Degree, EulerAngle::AxisSequence::ZYX)) ;
+        EXPECT_NE(eulerAngle, EulerAngle::Vector({ 10.0, 20.0, 30.0 }, Angle::Unit::Degree, EulerAngle::AxisSequence::XYZ)) ;
+
+    }
+
+    {
+
+        EXPECT_FALSE(EulerAngle::Undefined().isDefined()) ;
+        EXPECT_FALSE(EulerAngle(Angle::Degrees(10.0), Angle::Undefined(), Angle::Degrees(30.0), EulerAngle::AxisSequence::ZYX).isDefined()) ;
+        EXPECT_FALSE(EulerAngle(Angle::Degrees(10.0), Angle::Degrees(20.0), Angle::Degrees(30.0), EulerAngle::AxisSequence::Undefined).isDefined()) ;
+
+        EXPECT_ANY_THROW(EulerAngle::Undefined().getPhi()) ;
+        EXPECT_ANY_THROW(EulerAngle::Undefined().toQuaternion()) ;
+        EXPECT_ANY_THROW(EulerAngle::Undefined().toRotationMatrix()) ;
+        EXPECT_ANY_THROW(EulerAngle::Vector(Vector3d::Undefined(), Angle::Unit::Degree, EulerAngle::AxisSequence::ZYX)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, ToString)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    {
+
+        EXPECT_EQ("[10.0 [deg], 20.0 [deg], 30.0 [deg]] (ZYX)", EulerAngle::Vector({ 10.0, 20.0, 30.0 }, Angle::Unit::Degree, EulerAngle::AxisSequence::ZYX).toString()) ;
+
+        EXPECT_ANY_THROW(EulerAngle::Undefined().toString()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, ToQuaternion)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    {
+
+        for (const auto& axisSequence : AxisSequences)
+        {
+
+            for (const auto& angles : std::vector<std::array<double, 3>> { { 0.0, 0.0, 0.0 }, { 10.0, 20.0, 30.0 }, { -170.0, 85.0, 120.0 }, { 45.0, -60.0, -179.0 }, { 300.0, 200.0, -400.0 } })
+            {
+
+                const EulerAngle eulerAngle = EulerAngle::Vector({ angles[0], angles[1], angles[2] }, Angle::Unit::Degree, axisSequence) ;
+
+                const RotationMatrix referenceRotationMatrix = ReferenceRotationMatrix(eulerAngle) ;
+
+                const Quaternion quaternion = eulerAngle.toQuaternion() ;
+                const RotationMatrix rotationMatrix = eulerAngle.toRotationMatrix() ;
+
+                EXPECT_TRUE(quaternion.isUnitary()) << eulerAngle.toString() ;
+                EXPECT_TRUE(quaternion.isNear(Quaternion::RotationMatrix(referenceRotationMatrix), Angle::Radians(1e-12))) << eulerAngle.toString() ;
+                EXPECT_TRUE(rotationMatrix.getMatrix().isApprox(referenceRotationMatrix.getMatrix(), 1e-12)) << eulerAngle.toString() ;
+
+            }
+
+        }
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, Quaternion)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    {
+
+        for (const auto& axisSequence : AxisSequences)
+        {
+
+            const double thetaOffset = IsProper(axisSequence) ? 90.0 : 0.0 ;
+
+            for (const auto& angles : std::vector<std::array<double, 3>> { { 10.0, 20.0, 30.0 }, { -170.0, 85.0, 120.0 }, { 45.0, -60.0, -179.0 }, { 175.0, 0.0, -90.0 } })
+            {
+
+                const Vector3d angles_deg = { angles[0], angles[1] + thetaOffset, angles[2] } ;
+
+                const EulerAngle eulerAngle = EulerAngle::Vector(angles_deg, Angle::Unit::Degree, axisSequence) ;
+
+                const Quaternion quaternion = eulerAngle.toQuaternion() ;
+
+                // Both q and -q give the same angles
+
+                EXPECT_TRUE(EulerAngle::Quaternion(quaternion, axisSequence).toVector(Angle::Unit::Degree).isApprox(angles_deg, 1e-12)) << eulerAngle.toString() ;
+                EXPECT_TRUE(EulerAngle::Quaternion(Quaternion(-quaternion.toVector(Quaternion::Format::XYZS), Quaternion::Format::XYZS), axisSequence).toVector(Angle::Unit::Degree).isApprox(angles_deg, 1e-12)) << eulerAngle.toString() ;
+
+            }
+
+            // Gimbal lock: third angle set to zero, rotation preserved
+
+            for (const double theta_deg : { (IsProper(axisSequence) ? 0.0 : -90.0), (IsProper(axisSequence) ? 180.0 : 90.0) })
+            {
+
+                const Quaternion quaternion = EulerAngle::Vector({ 30.0, theta_deg, 40.0 }, Angle::Unit::Degree, axisSequence).toQuaternion() ;
+
+                const EulerAngle eulerAngle = EulerAngle::Quaternion(quaternion, axisSequence) ;
+
+                EXPECT_NEAR(theta_deg, eulerAngle.getTheta().inDegrees(), 1e-6) << eulerAngle.toString() ;
+                EXPECT_EQ(0.0, eulerAngle.getPsi().inDegrees()) << eulerAngle.toString() ;
+                EXPECT_TRUE(eulerAngle.toQuaternion().isNear(quaternion, Angle::Radians(1e-12))) << eulerAngle.toString() ;
+
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(EulerAngle::Quaternion(Quaternion::Undefined(), EulerAngle::AxisSequence::ZYX)) ;
+        EXPECT_ANY_THROW(EulerAngle::Quaternion(Quaternion::XYZS(0.0, 0.0, 1.0, 1.0), EulerAngle::AxisSequence::ZYX)) ;
+        EXPECT_ANY_THROW(EulerAngle::Quaternion(Quaternion::Unit(), EulerAngle::AxisSequence::Undefined)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, RotationMatrix)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+    using ostk::math::geom::d3::trf::rot::RotationMatrix ;
+
+    {
+
+        for (const auto& axisSequence : AxisSequences)
+        {
+
+            const double thetaOffset = IsProper(axisSequence) ? 90.0 : 0.0 ;
+
+            for (const auto& angles : std::vector<std::array<double, 3>> { { 10.0, 20.0, 30.0 }, { -170.0, 85.0, 120.0 }, { 45.0, -60.0, -179.0 }, { 175.0, 0.0, -90.0 } })
+            {
+
+                const Vector3d angles_deg = { angles[0], angles[1] + thetaOffset, angles[2] } ;
+
+                const EulerAngle eulerAngle = EulerAngle::Vector(angles_deg, Angle::Unit::Degree, axisSequence) ;
+
+                EXPECT_TRUE(EulerAngle::RotationMatrix(ReferenceRotationMatrix(eulerAngle), axisSequence).toVector(Angle::Unit::Degree).isApprox(angles_deg, 1e-12)) << eulerAngle.toString() ;
+
+            }
+
+            // Gimbal lock: third angle set to zero, rotation preserved
+
+            for (const double theta_deg : { (IsProper(axisSequence) ? 0.0 : -90.0), (IsProper(axisSequence) ? 180.0 : 90.0) })
+            {
+
+                const RotationMatrix rotationMatrix = ReferenceRotationMatrix(EulerAngle::Vector({ 30.0, theta_deg, 40.0 }, Angle::Unit::Degree, axisSequence)) ;
+
+                const EulerAngle eulerAngle = EulerAngle::RotationMatrix(rotationMatrix, axisSequence) ;
+
+                EXPECT_NEAR(theta_deg, eulerAngle.getTheta().inDegrees(), 1e-6) << eulerAngle.toString() ;
+                EXPECT_EQ(0.0, eulerAngle.getPsi().inDegrees()) << eulerAngle.toString() ;
+                EXPECT_TRUE(eulerAngle.toRotationMatrix().getMatrix().isApprox(rotationMatrix.getMatrix(), 1e-12)) << eulerAngle.toString() ;
+
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(EulerAngle::RotationMatrix(RotationMatrix::Undefined(), EulerAngle::AxisSequence::ZYX)) ;
+        EXPECT_ANY_THROW(EulerAngle::RotationMatrix(RotationMatrix::Unit(), EulerAngle::AxisSequence::Undefined)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, QuaternionsFromAngles)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::obj::Matrix4Xd ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    {
+
+        const Matrix3Xd angles = Matrix3Xd::Random(3, 100) * 3.0 ;
+
+        for (const auto& axisSequence : AxisSequences)
+        {
+
+            const Matrix4Xd quaternions = EulerAngle::QuaternionsFromAngles(angles, axisSequence) ;
+
+            ASSERT_EQ(angles.cols(), quaternions.cols()) ;
+
+            for (Eigen::Index index = 0; index < angles.cols(); ++index)
+            {
+                EXPECT_TRUE(quaternions.col(index).isApprox(EulerAngle::Vector(angles.col(index), Angle::Unit::Radian, axisSequence).toQuaternion().toVector(), 1e-15)) ;
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_EQ(0, EulerAngle::QuaternionsFromAngles(Matrix3Xd(3, 0), EulerAngle::AxisSequence::ZYX).cols()) ;
+
+        EXPECT_ANY_THROW(EulerAngle::QuaternionsFromAngles(Matrix3Xd::Zero(3, 1), EulerAngle::AxisSequence::Undefined)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, AnglesFromQuaternions)
+{
+
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::obj::Matrix4Xd ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    {
+
+        const Matrix4Xd quaternions = Matrix4Xd::Random(4, 100) ;
+
+        for (const auto& axisSequence : AxisSequences)
+        {
+
+            const Matrix3Xd angles = EulerAngle::AnglesFromQuaternions(quaternions, axisSequence) ;
+
+            ASSERT_EQ(quaternions.cols(), angles.cols()) ;
+
+            for (Eigen::Index index = 0; index < quaternions.cols(); ++index)
+            {
+
+                // Quaternions do not need to be normalized
+
+                const Quaternion quaternion = Quaternion(quaternions.col(index), Quaternion::Format::XYZS).toNormalized() ;
+
+                EXPECT_TRUE(angles.col(index).isApprox(EulerAngle::Quaternion(quaternion, axisSequence).toVector(Angle::Unit::Radian), 1e-12)) ;
+                EXPECT_TRUE(EulerAngle::Vector(angles.col(index), Angle::Unit::Radian, axisSequence).toQuaternion().isNear(quaternion, Angle::Radians(1e-12))) ;
+
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_EQ(0, EulerAngle::AnglesFromQuaternions(Matrix4Xd(4, 0), EulerAngle::AxisSequence::ZYX).cols()) ;
+
+        EXPECT_ANY_THROW(EulerAngle::AnglesFromQuaternions(Matrix4Xd::Zero(4, 1), EulerAngle::AxisSequence::Undefined)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_EulerAngle, StringFromAxisSequence)
+{
+
+    using ostk::math::geom::d3::trf::rot::EulerAngle ;
+
+    {
+
+        EXPECT_EQ("Undefined", EulerAngle::StringFromAxisSequence(EulerAngle::AxisSequence::Undefined)) ;
+        EXPECT_EQ("XYZ", EulerAngle::StringFromAxisSequence(EulerAngle::AxisSequence::XYZ)) ;
+        EXPECT_EQ("ZXZ", EulerAngle::StringFromAxisSequence(EulerAngle::AxisSequence::ZXZ)) ;
+        EXPECT_EQ("ZYX", EulerAngle::StringFromAxisSequence(EulerAngle::AxisSequence::ZYX)) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
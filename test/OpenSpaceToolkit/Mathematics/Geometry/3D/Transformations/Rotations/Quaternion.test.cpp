@@ -471,44 +471,96 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quatern
 
 // }
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Pow)
-// {
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Pow)
+{
 
-//     using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::core::types::Real ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
 
-//     {
+    {
 
-//         FAIL() ;
+        const Quaternion quaternion = Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(90.0))) ;
 
-//     }
+        EXPECT_TRUE(quaternion.pow(0.5).isNear(Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(45.0))), Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(quaternion.pow(2.0).isNear(quaternion.crossMultiply(quaternion), Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(quaternion.pow(0.0).isNear(Quaternion::Unit(), Angle::Radians(1e-12))) ;
 
-// }
+    }
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Exp)
-// {
+    {
 
-//     using ostk::math::geom::d3::trf::rot::Quaternion ;
+        EXPECT_ANY_THROW(Quaternion::Undefined().pow(1.0)) ;
+        EXPECT_ANY_THROW(Quaternion::Unit().pow(Real::Undefined())) ;
 
-//     {
+    }
 
-//         FAIL() ;
+}
 
-//     }
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Exp)
+{
 
-// }
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
 
-// TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Log)
-// {
+    {
 
-//     using ostk::math::geom::d3::trf::rot::Quaternion ;
+        EXPECT_EQ(Quaternion::Unit(), Quaternion::XYZS(0.0, 0.0, 0.0, 0.0).exp()) ;
 
-//     {
+        const Quaternion quaternion = Quaternion::XYZS(0.0, 0.0, M_PI / 4.0, 0.0).exp() ;
 
-//         FAIL() ;
+        EXPECT_NEAR(0.0, quaternion.x(), 1e-15) ;
+        EXPECT_NEAR(0.0, quaternion.y(), 1e-15) ;
+        EXPECT_NEAR(std::sqrt(0.5), quaternion.z(), 1e-15) ;
+        EXPECT_NEAR(std::sqrt(0.5), quaternion.s(), 1e-15) ;
 
-//     }
+        EXPECT_NEAR(std::exp(2.0), Quaternion::XYZS(0.0, 0.0, 0.0, 2.0).exp().s(), 1e-12) ;
 
-// }
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Quaternion::Undefined().exp()) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Log)
+{
+
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    {
+
+        const Quaternion logarithm = Quaternion::XYZS(0.0, 0.0, std::sqrt(0.5), std::sqrt(0.5)).log() ;
+
+        EXPECT_NEAR(0.0, logarithm.x(), 1e-15) ;
+        EXPECT_NEAR(0.0, logarithm.y(), 1e-15) ;
+        EXPECT_NEAR(M_PI / 4.0, logarithm.z(), 1e-15) ;
+        EXPECT_NEAR(0.0, logarithm.s(), 1e-15) ;
+
+        const Quaternion quaternion = Quaternion::XYZS(1.0, -2.0, 3.0, 4.0) ;
+
+        const Quaternion roundTrip = quaternion.log().exp() ;
+
+        EXPECT_NEAR(1.0, roundTrip.x(), 1e-12) ;
+        EXPECT_NEAR(-2.0, roundTrip.y(), 1e-12) ;
+        EXPECT_NEAR(3.0, roundTrip.z(), 1e-12) ;
+        EXPECT_NEAR(4.0, roundTrip.s(), 1e-12) ;
+
+        EXPECT_EQ(Quaternion::XYZS(0.0, 0.0, 0.0, 0.0), Quaternion::Unit().log()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Quaternion::Undefined().log()) ;
+        EXPECT_ANY_THROW(Quaternion::XYZS(0.0, 0.0, 0.0, 0.0).log()) ;
+
+    }
+
+}
 
 // TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, Norm)
 // {
@@ -562,6 +614,76 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quatern
 
 // }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, RotateVectors)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Matrix3Xd ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+
+    {
+
+        const Quaternion quaternion = Quaternion::XYZS(0.0, 0.0, 0.70710678118654757, 0.70710678118654757) ;
+
+        Matrix3Xd vectors = Matrix3Xd::Zero(3, 3) ;
+
+        vectors.col(0) = Vector3d(1.0, 0.0, 0.0) ;
+        vectors.col(1) = Vector3d(0.0, 1.0, 0.0) ;
+        vectors.col(2) = Vector3d(0.0, 0.0, 1.0) ;
+
+        const Matrix3Xd rotatedVectors = quaternion.rotateVectors(vectors) ;
+
+        ASSERT_EQ(3, rotatedVectors.cols()) ;
+
+        for (Eigen::Index index = 0; index < vectors.cols(); ++index)
+        {
+            EXPECT_TRUE(rotatedVectors.col(index).isApprox(quaternion.rotateVector(vectors.col(index)), 1e-15)) ;
+        }
+
+        quaternion.rotateVectorsInPlace(vectors) ;
+
+        EXPECT_TRUE(vectors.isApprox(rotatedVectors, 1e-15)) ;
+
+    }
+
+    {
+
+        const Matrix3Xd vectors = Matrix3Xd::Random(3, 100) ;
+
+        for (int index = 0; index < 20; ++index)
+        {
+
+            const Quaternion quaternion = Quaternion::XYZS(std::sin(index), std::cos(3.0 * index), std::sin(7.0 * index), std::cos(index)).toNormalized() ;
+
+            const Matrix3Xd rotatedVectors = quaternion.rotateVectors(vectors) ;
+
+            for (Eigen::Index vectorIndex = 0; vectorIndex < vectors.cols(); ++vectorIndex)
+            {
+                EXPECT_NEAR(0.0, (rotatedVectors.col(vectorIndex) - quaternion.rotateVector(vectors.col(vectorIndex))).norm(), 1e-14) ;
+            }
+
+        }
+
+    }
+
+    {
+
+        EXPECT_EQ(0, Quaternion::Unit().rotateVectors(Matrix3Xd::Zero(3, 0)).cols()) ;
+
+    }
+
+    {
+
+        Matrix3Xd vectors = Matrix3Xd::Zero(3, 1) ;
+
+        EXPECT_ANY_THROW(Quaternion::Undefined().rotateVectors(vectors)) ;
+        EXPECT_ANY_THROW(Quaternion::XYZS(0.0, 0.0, 1.0, 1.0).rotateVectors(vectors)) ;
+        EXPECT_ANY_THROW(Quaternion::Undefined().rotateVectorsInPlace(vectors)) ;
+
+    }
+
+}
+
 TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, ToVector)
 {
 
@@ -842,4 +964,131 @@ TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quatern
 
 }
 
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, SLERP)
+{
+
+    using ostk::core::types::Real ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    {
+
+        const Quaternion firstQuaternion = Quaternion::Unit() ;
+        const Quaternion secondQuaternion = Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(120.0))) ;
+
+        EXPECT_TRUE(Quaternion::SLERP(firstQuaternion, secondQuaternion, 0.0).isNear(firstQuaternion, Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(Quaternion::SLERP(firstQuaternion, secondQuaternion, 1.0).isNear(secondQuaternion, Angle::Radians(1e-12))) ;
+
+        for (const double ratio : { 0.1, 0.25, 0.5, 0.9 })
+        {
+
+            const Quaternion quaternion = Quaternion::SLERP(firstQuaternion, secondQuaternion, ratio) ;
+
+            EXPECT_TRUE(quaternion.isUnitary()) ;
+            EXPECT_TRUE(quaternion.isNear(Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(120.0 * ratio))), Angle::Radians(1e-12))) ;
+
+        }
+
+        // Shortest path, whatever the sign of the quaternions
+
+        const Quaternion oppositeQuaternion = Quaternion::XYZS(-secondQuaternion.x(), -secondQuaternion.y(), -secondQuaternion.z(), -secondQuaternion.s()) ;
+
+        EXPECT_TRUE(Quaternion::SLERP(firstQuaternion, oppositeQuaternion, 0.5).isNear(Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(60.0))), Angle::Radians(1e-12))) ;
+
+        // Identical quaternions
+
+        EXPECT_TRUE(Quaternion::SLERP(secondQuaternion, secondQuaternion, 0.3).isNear(secondQuaternion, Angle::Radians(1e-12))) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Quaternion::SLERP(Quaternion::Undefined(), Quaternion::Unit(), 0.5)) ;
+        EXPECT_ANY_THROW(Quaternion::SLERP(Quaternion::Unit(), Quaternion::XYZS(0.0, 0.0, 1.0, 1.0), 0.5)) ;
+        EXPECT_ANY_THROW(Quaternion::SLERP(Quaternion::Unit(), Quaternion::Unit(), Real::Undefined())) ;
+        EXPECT_ANY_THROW(Quaternion::SLERP(Quaternion::Unit(), Quaternion::Unit(), 1.5)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, NLERP)
+{
+
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    {
+
+        const Quaternion firstQuaternion = Quaternion::Unit() ;
+        const Quaternion secondQuaternion = Quaternion::RotationVector(RotationVector({ 1.0, 0.0, 0.0 }, Angle::Degrees(90.0))) ;
+
+        EXPECT_TRUE(Quaternion::NLERP(firstQuaternion, secondQuaternion, 0.0).isNear(firstQuaternion, Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(Quaternion::NLERP(firstQuaternion, secondQuaternion, 1.0).isNear(secondQuaternion, Angle::Radians(1e-12))) ;
+
+        // Same path as SLERP: exact at mid-point, not elsewhere
+
+        EXPECT_TRUE(Quaternion::NLERP(firstQuaternion, secondQuaternion, 0.5).isNear(Quaternion::SLERP(firstQuaternion, secondQuaternion, 0.5), Angle::Radians(1e-12))) ;
+        EXPECT_FALSE(Quaternion::NLERP(firstQuaternion, secondQuaternion, 0.25).isNear(Quaternion::SLERP(firstQuaternion, secondQuaternion, 0.25), Angle::Radians(1e-6))) ;
+
+        EXPECT_TRUE(Quaternion::NLERP(firstQuaternion, secondQuaternion, 0.25).isUnitary()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Quaternion::NLERP(Quaternion::Undefined(), Quaternion::Unit(), 0.5)) ;
+        EXPECT_ANY_THROW(Quaternion::NLERP(Quaternion::Unit(), Quaternion::Unit(), -0.1)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_Quaternion, SQUAD)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::geom::Angle ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::RotationVector ;
+
+    {
+
+        // Constant rotation about a single axis: SQUAD reduces to SLERP
+
+        const auto rotation = [] (const double anAngle) -> Quaternion { return Quaternion::RotationVector(RotationVector({ 0.0, 1.0, 0.0 }, Angle::Degrees(anAngle))) ; } ;
+
+        for (const double ratio : { 0.0, 0.2, 0.5, 0.7, 1.0 })
+        {
+            EXPECT_TRUE(Quaternion::SQUAD(rotation(0.0), rotation(30.0), rotation(60.0), rotation(90.0), ratio).isNear(rotation(30.0 + 30.0 * ratio), Angle::Radians(1e-12))) ;
+        }
+
+    }
+
+    {
+
+        // Passes through the samples
+
+        const Quaternion previousQuaternion = Quaternion::RotationVector(RotationVector({ 1.0, 0.0, 0.0 }, Angle::Degrees(10.0))) ;
+        const Quaternion firstQuaternion = Quaternion::RotationVector(RotationVector({ 0.0, 1.0, 0.0 }, Angle::Degrees(20.0))) ;
+        const Quaternion secondQuaternion = Quaternion::RotationVector(RotationVector({ 0.0, 0.0, 1.0 }, Angle::Degrees(30.0))) ;
+        const Quaternion nextQuaternion = Quaternion::RotationVector(RotationVector(Vector3d(1.0, 1.0, 0.0).normalized(), Angle::Degrees(40.0))) ;
+
+        EXPECT_TRUE(Quaternion::SQUAD(previousQuaternion, firstQuaternion, secondQuaternion, nextQuaternion, 0.0).isNear(firstQuaternion, Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(Quaternion::SQUAD(previousQuaternion, firstQuaternion, secondQuaternion, nextQuaternion, 1.0).isNear(secondQuaternion, Angle::Radians(1e-12))) ;
+        EXPECT_TRUE(Quaternion::SQUAD(previousQuaternion, firstQuaternion, secondQuaternion, nextQuaternion, 0.5).isUnitary()) ;
+
+    }
+
+    {
+
+        EXPECT_ANY_THROW(Quaternion::SQUAD(Quaternion::Undefined(), Quaternion::Unit(), Quaternion::Unit(), Quaternion::Unit(), 0.5)) ;
+        EXPECT_ANY_THROW(Quaternion::SQUAD(Quaternion::Unit(), Quaternion::Unit(), Quaternion::Unit(), Quaternion::Unit(), 2.0)) ;
+
+    }
+
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,229 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/QuaternionKernel.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/QuaternionKernel.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Transformations/Rotations/Quaternion.hpp>
+
+#include <Global.test.hpp>
+
+#include <cstdint>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, AlignedQuaternion)
+{
+
+    using ostk::math::geom::d3::trf::rot::kernel::AlignedQuaternion ;
+
+    {
+
+        EXPECT_EQ(32, alignof(AlignedQuaternion)) ;
+        EXPECT_EQ(32, sizeof(AlignedQuaternion)) ;
+
+        const AlignedQuaternion quaternions[2] = { { { 0.0, 0.0, 0.0, 1.0 } }, { { 1.0, 0.0, 0.0, 0.0 } } } ;
+
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(quaternions[0].components) % 32) ;
+        EXPECT_EQ(0, reinterpret_cast<std::uintptr_t>(quaternions[1].components) % 32) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, SquaredNorm)
+{
+
+    using ostk::math::geom::d3::trf::rot::kernel::SquaredNorm ;
+
+    {
+
+        const double quaternion[4] = { 1.0, 2.0, 3.0, 4.0 } ;
+
+        EXPECT_EQ(30.0, SquaredNorm(quaternion)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, CrossMultiply)
+{
+
+    using ostk::math::obj::Vector4d ;
+    using ostk::math::geom::d3::trf::rot::kernel::CrossMultiply ;
+
+    {
+
+        const Vector4d left = { 1.0, 2.0, 3.0, 4.0 } ;
+        const Vector4d right = { -0.5, 0.1, 0.7, 0.2 } ;
+
+        Vector4d result ;
+
+        CrossMultiply(left.data(), right.data(), result.data()) ;
+
+        EXPECT_TRUE(result.isApprox(Vector4d({ -2.9, 3.0, 2.3, -1.0 }), 1e-15)) ;
+
+    }
+
+    {
+
+        const Vector4d left = { 1.0, 2.0, 3.0, 4.0 } ;
+        const Vector4d right = { -0.5, 0.1, 0.7, 0.2 } ;
+
+        Vector4d expected ;
+
+        CrossMultiply(left.data(), right.data(), expected.data()) ;
+
+        Vector4d leftAliased = left ;
+
+        CrossMultiply(leftAliased.data(), right.data(), leftAliased.data()) ;
+
+        EXPECT_EQ(expected, leftAliased) ;
+
+        Vector4d rightAliased = right ;
+
+        CrossMultiply(left.data(), rightAliased.data(), rightAliased.data()) ;
+
+        EXPECT_EQ(expected, rightAliased) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, DotMultiply)
+{
+
+    using ostk::math::obj::Vector4d ;
+    using ostk::math::geom::d3::trf::rot::kernel::DotMultiply ;
+
+    {
+
+        const Vector4d left = { 1.0, 2.0, 3.0, 4.0 } ;
+        const Vector4d right = { -0.5, 0.1, 0.7, 0.2 } ;
+
+        Vector4d result ;
+
+        DotMultiply(left.data(), right.data(), result.data()) ;
+
+        EXPECT_TRUE(result.isApprox(Vector4d({ -0.7, -1.4, 4.5, -1.0 }), 1e-15)) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, Conjugate)
+{
+
+    using ostk::math::geom::d3::trf::rot::kernel::Conjugate ;
+
+    {
+
+        double quaternion[4] = { 1.0, 2.0, 3.0, 4.0 } ;
+
+        Conjugate(quaternion) ;
+
+        EXPECT_EQ(-1.0, quaternion[0]) ;
+        EXPECT_EQ(-2.0, quaternion[1]) ;
+        EXPECT_EQ(-3.0, quaternion[2]) ;
+        EXPECT_EQ(+4.0, quaternion[3]) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, Normalize)
+{
+
+    using ostk::math::geom::d3::trf::rot::kernel::SquaredNorm ;
+    using ostk::math::geom::d3::trf::rot::kernel::Normalize ;
+
+    {
+
+        double quaternion[4] = { 1.0, 2.0, 3.0, 4.0 } ;
+
+        Normalize(quaternion) ;
+
+        EXPECT_NEAR(1.0, SquaredNorm(quaternion), 1e-15) ;
+        EXPECT_NEAR(1.0 / std::sqrt(30.0), quaternion[0], 1e-15) ;
+        EXPECT_NEAR(4.0 / std::sqrt(30.0), quaternion[3], 1e-15) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, Inverse)
+{
+
+    using ostk::math::geom::d3::trf::rot::kernel::CrossMultiply ;
+    using ostk::math::geom::d3::trf::rot::kernel::Inverse ;
+
+    {
+
+        const double quaternion[4] = { 1.0, 2.0, 3.0, 4.0 } ;
+
+        double inverse[4] = { 1.0, 2.0, 3.0, 4.0 } ;
+
+        Inverse(inverse) ;
+
+        double identity[4] ;
+
+        CrossMultiply(quaternion, inverse, identity) ;
+
+        EXPECT_NEAR(0.0, identity[0], 1e-15) ;
+        EXPECT_NEAR(0.0, identity[1], 1e-15) ;
+        EXPECT_NEAR(0.0, identity[2], 1e-15) ;
+        EXPECT_NEAR(1.0, identity[3], 1e-15) ;
+
+    }
+
+}
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_3D_Transformations_Rotations_QuaternionKernel, RotateVector)
+{
+
+    using ostk::math::obj::Vector3d ;
+    using ostk::math::obj::Vector4d ;
+    using ostk::math::geom::d3::trf::rot::Quaternion ;
+    using ostk::math::geom::d3::trf::rot::kernel::RotateVector ;
+
+    {
+
+        const Quaternion quaternion = Quaternion(1.0, 2.0, 3.0, 4.0, Quaternion::Format::XYZS).toNormalized() ;
+
+        const Vector4d components = quaternion.toVector(Quaternion::Format::XYZS) ;
+        const Vector3d vector = { 0.3, -1.2, 2.5 } ;
+
+        Vector3d result ;
+
+        RotateVector(components.data(), vector.data(), result.data()) ;
+
+        EXPECT_TRUE(result.isApprox(quaternion.crossMultiply(Quaternion(vector, 0.0)).crossMultiply(quaternion.toConjugate()).getVectorPart(), 1e-15)) ;
+
+        Vector3d aliased = vector ;
+
+        RotateVector(components.data(), aliased.data(), aliased.data()) ;
+
+        EXPECT_EQ(result, aliased) ;
+
+    }
+
+    {
+
+        const double identity[4] = { 0.0, 0.0, 0.0, 1.0 } ;
+        const Vector3d vector = { 0.3, -1.2, 2.5 } ;
+
+        Vector3d result ;
+
+        RotateVector(identity, vector.data(), result.data()) ;
+
+        EXPECT_EQ(vector, result) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,142 @@
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+/// @project        Open Space Toolkit ▸ Mathematics
+/// @file           OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.test.cpp
+/// @author         Lucas Brémond <lucas@loftorbital.com>
+/// @license        Apache License 2.0
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <OpenSpaceToolkit/Mathematics/Geometry/SegmentTree.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/2D/Objects/Point.hpp>
+#include <OpenSpaceToolkit/Mathematics/Geometry/3D/Objects/Point.hpp>
+
+#include <Global.test.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+
+using ostk::core::ctnr::Array ;
+
+// Checks projections through the hierarchy and through a linear scan against an exhaustive search over all segments
+
+template <class PointType>
+void                            TestProject                                 (   const   Array<PointType>&           aPointArray,
+                                                                                const   Array<PointType>&           aQueryPointArray                            )
+{
+
+    using ostk::math::geom::SegmentTree ;
+
+    const SegmentTree<PointType> segmentTree = { aPointArray } ;
+
+    EXPECT_EQ(aPointArray.getSize() - 1, segmentTree.getSegmentCount()) ;
+
+    for (const auto& point : aQueryPointArray)
+    {
+
+        double minimumDistance = std::numeric_limits<double>::infinity() ;
+
+        for (std::size_t segmentIndex = 0; segmentIndex + 1 < aPointArray.getSize(); ++segmentIndex)
+        {
+
+            const auto firstVertex = aPointArray[segmentIndex].asVector() ;
+            const auto direction = (aPointArray[segmentIndex + 1].asVector() - firstVertex).eval() ;
+
+            const double parameter = std::clamp((point.asVector() - firstVertex).dot(direction) / direction.squaredNorm(), 0.0, 1.0) ;
+
+            minimumDistance = std::min(minimumDistance, (firstVertex + parameter * direction - point.asVector()).norm()) ;
+
+        }
+
+        const typename SegmentTree<PointType>::Projection projection = segmentTree.project(point.asVector()) ;
+
+        ASSERT_NEAR(minimumDistance, projection.distance, 1e-12) ;
+        ASSERT_NEAR(projection.distance, (projection.point.asVector() - point.asVector()).norm(), 1e-12) ;
+
+        const typename SegmentTree<PointType>::Projection linearProjection = SegmentTree<PointType>::Project(aPointArray, point.asVector()) ;
+
+        ASSERT_NEAR(minimumDistance, linearProjection.distance, 1e-12) ;
+        ASSERT_NEAR(projection.arcLength, linearProjection.arcLength, 1e-9) ;
+
+    }
+
+}
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+TEST (OpenSpaceToolkit_Mathematics_Geometry_SegmentTree, Project)
+{
+
+    {
+
+        using ostk::math::geom::d2::objects::Point ;
+
+        Array<Point> points = Array<Point>::Empty() ;
+        Array<Point> queryPoints = Array<Point>::Empty() ;
+
+        for (int index = 0; index < 5000; ++index)
+        {
+            points.add(Point(index * 0.01, std::sin(index * 0.01))) ;
+        }
+
+        for (int index = 0; index < 100; ++index)
+        {
+            queryPoints.add(Point(index * 0.037 - 1.0, std::cos(index * 0.41))) ;
+        }
+
+        TestProject(points, queryPoints) ;
+        TestProject(Array<Point>(points.begin(), points.begin() + 50), queryPoints) ;
+
+    }
+
+    {
+
+        using ostk::math::geom::d3::objects::Point ;
+
+        Array<Point> points = Array<Point>::Empty() ;
+        Array<Point> queryPoints = Array<Point>::Empty() ;
+
+        for (int index = 0; index < 5000; ++index)
+        {
+            points.add(Point(std::cos(index * 0.01), std::sin(index * 0.01), index * 0.001)) ;
+        }
+
+        for (int index = 0; index < 100; ++index)
+        {
+            queryPoints.add(Point(std::cos(index * 0.41), std::sin(index * 0.29), index * 0.0037)) ;
+        }
+
+        TestProject(points, queryPoints) ;
+        TestProject(Array<Point>(points.begin(), points.begin() + 50), queryPoints) ;
+
+    }
+
+    {
+
+        using ostk::math::geom::SegmentTree ;
+        using ostk::math::geom::d2::objects::Point ;
+
+        const Array<Point> points = { Point(1.0, 1.0) } ;
+
+        EXPECT_EQ(0, SegmentTree<Point>(points).getSegmentCount()) ;
+
+        EXPECT_EQ(Point(1.0, 1.0), SegmentTree<Point>(points).project({ 1.0, 2.0 }).point) ;
+        EXPECT_NEAR(1.0, SegmentTree<Point>(points).project({ 1.0, 2.0 }).distance, 1e-15) ;
+
+        EXPECT_EQ(Point(1.0, 1.0), SegmentTree<Point>::Project(points, { 1.0, 2.0 }).point) ;
+        EXPECT_NEAR(1.0, SegmentTree<Point>::Project(points, { 1.0, 2.0 }).distance, 1e-15) ;
+
+    }
+
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////